@@ -1,9 +1,22 @@
 #include "Fileroad.h"
 #include "Memoroad.h"
+#include "../4-User_Mode/Map_Memory.h"	// map_file_mode(), unmap_file(), free_struct()
+#include <errno.h>		// EINVAL, ENOENT
+#include <fcntl.h>		// open(), O_RDONLY
 #include <limits.h>		// PATH_MAX
 #include <stdbool.h>	// bool, true, false
 #include <stdio.h>		// fprintf
-#include <string.h>		// strcmp
+#include <stdlib.h>		// free(), malloc(), mkdtemp()
+#include <string.h>		// strcmp, memset
+#include <sys/stat.h>	// mkfifo()
+#include <sys/wait.h>	// waitpid()
+#include <unistd.h>		// close(), fork(), rmdir(), unlink(), write()
+
+// Length of the line that has to span several read() refills (Fileroad's FROAD_BUFF_SIZE is 1024)
+#define FRT_LONG_LINE 5000
+
+// Size of a file load_a_file() has to mmap() (Fileroad's FROAD_MMAP_THRESHOLD is 64 KiB)
+#define FRT_MMAP_SIZE (256 * 1024)
 
 #ifndef HARKLE_ERROR
 #define HARKLE_ERROR(header, funcName, msg) do { fprintf(stderr, "<<<ERROR>>> - %s - %s() - %s!\n", #header, #funcName, #msg); } while (0);
@@ -28,6 +41,107 @@ typedef struct slTestStruct
 	char** expectRet;		// Expected return value
 } slTest, *slTest_ptr;
 
+typedef struct liTestStruct
+{
+	char* testName;			// Name and number of test
+	const char* input;		// File contents
+	size_t inputLen;		// Length of input (filled in at run time)
+	char splitChar;			// Input splitChar
+	bool skipEmpty;			// Input skipEmpty
+	bool useFifo;			// If true, feed input through a FIFO so load_a_file() can't size it
+	const char* expectRet[8];	// Expected lines, NULL-terminated
+} liTest, *liTest_ptr;
+
+/*
+	Purpose - Create fileName holding contents
+	Input
+		fileName - Path to create
+		contents - Bytes to write
+		contentsLen - Number of bytes in contents
+		useFifo - If true, fileName is a FIFO and a child process writes contents
+			to it once it's opened (see: wait_for_writer())
+	Output - true on success, false on failure
+ */
+bool write_test_file(const char* fileName, const char* contents, size_t contentsLen, bool useFifo)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	int fileDesc = -1;  // File descriptor to write to
+	pid_t writerPID = 0;  // Return value from fork()
+
+	if (true == useFifo)
+	{
+		retVal = 0 == mkfifo(fileName, 0600);
+		if (true == retVal)
+		{
+			writerPID = fork();
+			retVal = writerPID > -1;
+		}
+		if (0 == writerPID)
+		{
+			// Child: blocks until the reader opens the FIFO
+			fileDesc = open(fileName, O_WRONLY);
+			_exit(fileDesc > -1 && contentsLen == (size_t)write(fileDesc, contents, contentsLen) ? 0 : 1);
+		}
+	}
+	else
+	{
+		fileDesc = open(fileName, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+		retVal = fileDesc > -1 && contentsLen == (size_t)write(fileDesc, contents, contentsLen);
+		if (fileDesc > -1)
+		{
+			close(fileDesc);
+		}
+	}
+
+	return retVal;
+}
+
+/*
+	Purpose - Reap any FIFO writers started by write_test_file()
+ */
+void wait_for_writer(void)
+{
+	while (waitpid(-1, NULL, 0) > 0)
+	{
+		// Keep reaping
+	}
+}
+
+/*
+	Purpose - Drain a lineIter and compare every line it yields
+	Input
+		iter_ptr - Initialized line iterator
+		expect_arr - NULL-terminated array of expected lines
+	Output - true if the iterator yielded exactly expect_arr, false otherwise
+ */
+bool check_lines(lineIter_ptr iter_ptr, const char* const* expect_arr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	const char* line_ptr = NULL;  // [OUT] parameter for next_line()
+	size_t lineLen = 0;  // [OUT] parameter for next_line()
+	int i = 0;  // Iterating variable
+
+	for (i = 0; true == retVal && true == next_line(iter_ptr, &line_ptr, &lineLen); i++)
+	{
+		if (!expect_arr[i] || lineLen != strlen(expect_arr[i]) || memcmp(line_ptr, expect_arr[i], lineLen))
+		{
+			fprintf(stdout, "Line %d: Expect:\t%.40s\n\t\tActual:\t%.*s\n\t", \
+			        i, expect_arr[i] ? expect_arr[i] : "(no more lines)", lineLen > 40 ? 40 : (int)lineLen, line_ptr);
+			retVal = false;
+		}
+	}
+
+	if (true == retVal && expect_arr[i])
+	{
+		fprintf(stdout, "Missing line %d:\t%.40s\n\t", i, expect_arr[i]);
+		retVal = false;
+	}
+
+	return retVal;
+}
+
 int main(void)
 {
 	/***************************************************************************************************/
@@ -169,151 +283,363 @@ int main(void)
 	fprintf(stdout, "Tests Passed:\t%d\n", numTestsPassed);
 	fprintf(stdout, "\n\n");
 	
-	/*
-	typedef struct slTestStruct
-	{
-		char* testName;			// Name and number of test
-		char* inputHS;			// Input haystack
-		char inputSC;			// Input splitChar
-		char** actualRet;		// Actual return value
-		char** expectRet;		// Expected return value
-	} slTest, *slTest_ptr;
-	 */
 	/***************************************************************************************************/
 	/************************************ SPLIT_LINES() UNIT TESTS *************************************/
 	/***************************************************************************************************/
 	// LOCAL VARIABLES
 	slTest_ptr** allSLTests = NULL;  // All of the split_line() test arrays in one array
 	slTest_ptr* currSLTestArr_ptr = NULL;  // Current split_line() test array
-	slTest_ptr slTest = NULL;  // Current split_line() test being run
+	slTest_ptr thisSLTest = NULL;  // Current split_line() test being run
 	int i = 0;  // Incrementing variable for pointer math
 	int numSLTestsRun = 0;
 	int numSLTestsPassed = 0;
 	bool thisTestPassed = true;  // If one strcmp fails, set this to false
-	char* actChar_ptr = NULL;  // Store one char* from the actualRet array here
-	char* expChar_ptr = NULL;  // Store one char* from the expectRet array here
-	
+
 	// Normal Tests
-	slTest normTest01 = { "SL Normal Test 1", "One*Two*Three", '*', NULL, { "One", "Two", "Three", NULL }};
-	
+	slTest slNormTest01 = { "SL Normal Test 1", "One*Two*Three", '*', NULL, (char*[]){ "One", "Two", "Three", NULL } };
+	slTest slNormTest02 = { "SL Normal Test 2", "One**Two*", '*', NULL, (char*[]){ "One", "Two", NULL } };
+
 	// Error Tests
-	// Boundary Tests
-	// Special Tests
+	slTest slErrTest01 = { "SL Error Test 1", NULL, '*', NULL, NULL };
+
 	// Test Arrays
-	slTest_ptr normSLTest_arr[] = { &normTest01, NULL };
-	slTest_ptr* slTestArrays_arr[] = { normSLTest_arr, NULL };
-	
+	slTest_ptr normSLTest_arr[] = { &slNormTest01, &slNormTest02, NULL };
+	slTest_ptr errSLTest_arr[] = { &slErrTest01, NULL };
+	slTest_ptr* slTestArrays_arr[] = { normSLTest_arr, errSLTest_arr, NULL };
+
 	// RUN TESTS
 	allSLTests = slTestArrays_arr;
-	
+
 	while (*allSLTests)
 	{
 		currSLTestArr_ptr = *allSLTests;
-		i = 0;
-		
+
 		while (*currSLTestArr_ptr)
 		{
-			slTest = *currSLTestArr_ptr;
-			thisCharPassed = true;  // Reset temp variable
-			
-			if (slTest)
+			thisSLTest = *currSLTestArr_ptr;
+			thisTestPassed = true;  // Reset temp variable
+
+			if (thisSLTest)
 			{
 				// EXECUTE SPLIT_LINE() TESTS
-				fprintf(stdout, "%s\n\t", slTest->testName);
-				slTest->actualRet = split_lines(slTest->inputHS, slTest->inputSC);
+				fprintf(stdout, "%s\n\t", thisSLTest->testName);
+				thisSLTest->actualRet = split_lines(thisSLTest->inputHS, thisSLTest->inputSC);
 				numSLTestsRun++;
 
-				if (slTest->actualRet && slTest->expectRet)
+				if (thisSLTest->actualRet && thisSLTest->expectRet)
 				{
-					if (*(slTest->actualRet) != NULL && (*(slTest->expectRet) != NULL)
-					{
-						// Walk the char*s in the array, strcmp()ing all the way
-						actChar_ptr = (*(slTest->actualRet));
-						expChar_ptr = (*(slTest->expectRet));
-						
-						while (actChar_ptr && expChar_ptr)
-						{
-							if (0 == strcmp(*actChar_ptr, *expChar_ptr))
-							{
-								actChar_ptr++;
-								expChar_ptr++;
-							}
-							else
-							{
-								thisTestPassed = false;
-								fprintf(stdout, "[ ] FAIL\n\t\t");
-								fprintf(stdout, "Expect: \t%s\n\t\t", *actChar_ptr);
-								fprintf(stdout, "Receive:\t%s\n\t\t", *expChar_ptr);
-								break;
-							}
-						}
-					}
-					else  // At least one is NULL
+					// Walk the char*s in the arrays, strcmp()ing all the way
+					for (i = 0; thisSLTest->actualRet[i] && thisSLTest->expectRet[i]; i++)
 					{
-						if (*(slTest->actualRet) == *(slTest->expectRet))
-						{
-							fprintf(stdout, "[X] Success\n");
-							numSLTestsPassed++;
-						}
-						else
-						{
-							thisTestPassed = false;	
-						}
-					}					
-					
-					// Check for pass or fail
-					if (thisTestPassed == true)
-					{
-						fprintf(stdout, "[X] Success\n");
-						numTestsPassed++;
-					}
-					else
-					{		
-						fprintf(stdout, "[ ] FAIL\n\t\t");
-						if ((*((slTest->expectRet) + i)))
-						{
-							fprintf(stdout, "Expect: \t%s\n\t\t", (*((slTest->expectRet) + i)));
-						}
-						else
-						{
-							fprintf(stdout, "Expect: \t%p\n\t\t", (*((slTest->expectRet) + i)));
-						}
-						if ((*((slTest->actualRet) + i)))
-						{
-							fprintf(stdout, "Receive:\t%s\n\t\t", (*((slTest->actualRet) + i)));
-						}
-						else
+						if (strcmp(thisSLTest->actualRet[i], thisSLTest->expectRet[i]))
 						{
-							fprintf(stdout, "Receive:\t%p\n\t\t", (*((slTest->actualRet) + i)));
+							break;
 						}
 					}
+
+					// Both arrays must end at the same place
+					thisTestPassed = !(thisSLTest->actualRet[i]) && !(thisSLTest->expectRet[i]);
 				}
-				else if (slTest->actualRet != slTest->expectRet)
-				{		
-					fprintf(stdout, "[ ] FAIL\n\t\t");
-					fprintf(stdout, "Expect:\t%p\n\t\t", slTest->actualRet);
-					fprintf(stdout, "Actual:\t%p\n\t\t\n", slTest->expectRet);
+				else
+				{
+					thisTestPassed = thisSLTest->actualRet == thisSLTest->expectRet;
 				}
 
+				// Check for pass or fail
+				if (thisTestPassed == true)
+				{
+					fprintf(stdout, "[X] Success\n");
+					numSLTestsPassed++;
+				}
+				else if (thisSLTest->actualRet && thisSLTest->expectRet)
+				{
+					fprintf(stdout, "[ ] FAIL\n\t\t");
+					fprintf(stdout, "Expect: \t%s\n\t\t", thisSLTest->expectRet[i] ? thisSLTest->expectRet[i] : "(NULL)");
+					fprintf(stdout, "Receive:\t%s\n\t\t\n", thisSLTest->actualRet[i] ? thisSLTest->actualRet[i] : "(NULL)");
+				}
+				else
+				{
+					fprintf(stdout, "[ ] FAIL\n\t\t");
+					fprintf(stdout, "Expect:\t%p\n\t\t", (void*)thisSLTest->expectRet);
+					fprintf(stdout, "Actual:\t%p\n\t\t\n", (void*)thisSLTest->actualRet);
+				}
 
 				// CLEAN UP THIS TEST
-				if (slTest->actualRet)
+				if (thisSLTest->actualRet)
 				{
-					if (false == free_char_arr(&(slTest->actualRet)))
+					if (false == free_char_arr(&(thisSLTest->actualRet)))
 					{
-						HARKLE_ERROR(Fileroad Tests (split_line), main, release_a_string failed);
+						HARKLE_ERROR(Fileroad Tests (split_line), main, free_char_arr failed);
 					}
 				}
 			}
-			
+
 			currSLTestArr_ptr++;  // Next test pointer
 		}
-		
+
 		allSLTests++;  // Next pointer to an array of tests
 	}
-	
+
 	// CLEAN UP
+	fprintf(stdout, "\n\n");
+	fprintf(stdout, "Tests Run:   \t%d\n", numSLTestsRun);
+	fprintf(stdout, "Tests Passed:\t%d\n", numSLTestsPassed);
+	fprintf(stdout, "\n\n");
+
+	/***************************************************************************************************/
+	/*********************************** LINE ITERATOR UNIT TESTS **************************************/
+	/***************************************************************************************************/
+	// LOCAL VARIABLES
+	char tempName[] = "/tmp/fileroad_test_XXXXXX";  // mkdtemp() template
+	char fileName[PATH_MAX] = { 0 };  // Test file inside tempName
+	char longLine[FRT_LONG_LINE + 1] = { 0 };  // Longer than one FROAD_BUFF_SIZE read() refill
+	char longInput[FRT_LONG_LINE + 8] = { 0 };  // longLine plus a short line
+	fileView view = { 0 };  // Reused by every load_a_file() call
+	mapMem_ptr map_ptr = NULL;  // Return value from map_file_mode()
+	lineIter iter = { 0 };  // Iterator under test
+	liTest_ptr thisLITest = NULL;  // Current line iterator test being run
+	liTest_ptr* currLITest_ptr = NULL;  // Iterating variable
+	int numLITestsRun = 0;
+	int numLITestsPassed = 0;
+	int errNum = 0;  // [OUT] parameter for load_a_file()
+
+	memset(longLine, 'L', FRT_LONG_LINE);
+	snprintf(longInput, sizeof(longInput), "%s\nshort\n", longLine);
+
+	// Normal Tests
+	liTest liNormTest01 = { "LI Normal Test 1 - Trailing newline", "One\nTwo\nThree\n", 0, '\n', false, false, \
+	                        { "One", "Two", "Three", NULL } };
+	liTest liNormTest02 = { "LI Normal Test 2 - No trailing newline", "One\nTwo\nThree", 0, '\n', false, false, \
+	                        { "One", "Two", "Three", NULL } };
+	liTest liNormTest03 = { "LI Normal Test 3 - Empty lines kept", "One\n\nTwo\n", 0, '\n', false, false, \
+	                        { "One", "", "Two", NULL } };
+	liTest liNormTest04 = { "LI Normal Test 4 - Empty lines skipped", "\nOne\n\n\nTwo\n\n", 0, '\n', true, false, \
+	                        { "One", "Two", NULL } };
+	liTest liNormTest05 = { "LI Normal Test 5 - CRLF lines keep their \\r", "One\r\nTwo\r\n", 0, '\n', false, false, \
+	                        { "One\r", "Two\r", NULL } };
+	// Boundary Tests
+	liTest liBndTest01 = { "LI Boundary Test 1 - Empty file", "", 0, '\n', false, false, { NULL } };
+	liTest liBndTest02 = { "LI Boundary Test 2 - Only a newline", "\n", 0, '\n', false, false, { "", NULL } };
+	liTest liBndTest03 = { "LI Boundary Test 3 - Line longer than one read() refill", longInput, 0, '\n', false, true, \
+	                       { longLine, "short", NULL } };
+
+	liTest_ptr liTest_arr[] = { &liNormTest01, &liNormTest02, &liNormTest03, &liNormTest04, &liNormTest05, \
+	                            &liBndTest01, &liBndTest02, &liBndTest03, NULL };
+
+	// SETUP
+	if (!mkdtemp(tempName))
+	{
+		HARKLE_ERROR(Fileroad Tests (line iterator), main, mkdtemp failed);
+		return 1;
+	}
+	snprintf(fileName, sizeof(fileName), "%s/lines", tempName);
+
+	// RUN TESTS
+	for (currLITest_ptr = liTest_arr; *currLITest_ptr; currLITest_ptr++)
+	{
+		thisLITest = *currLITest_ptr;
+		thisLITest->inputLen = strlen(thisLITest->input);
+
+		// 1. init_line_iter() over a file read by load_a_file()
+		fprintf(stdout, "%s (init_line_iter)\n\t", thisLITest->testName);
+		numLITestsRun++;
+		if (true == write_test_file(fileName, thisLITest->input, thisLITest->inputLen, thisLITest->useFifo) \
+		    && true == load_a_file(fileName, &view, &errNum) \
+		    && true == init_line_iter(&iter, view.view_ptr, view.viewLen, thisLITest->splitChar, thisLITest->skipEmpty) \
+		    && true == check_lines(&iter, thisLITest->expectRet))
+		{
+			fprintf(stdout, "[X] Success\n");
+			numLITestsPassed++;
+		}
+		else
+		{
+			fprintf(stdout, "[ ] FAIL (errNum %d)\n", errNum);
+		}
+		wait_for_writer();
+		unlink(fileName);
+
+		// 2. init_line_iter_mapMem() over the same file mapped by map_file_mode()
+		//	Map_Memory refuses to map empty files and FIFOs
+		if (thisLITest->inputLen > 0 && false == thisLITest->useFifo)
+		{
+			fprintf(stdout, "%s (init_line_iter_mapMem)\n\t", thisLITest->testName);
+			numLITestsRun++;
+			if (true == write_test_file(fileName, thisLITest->input, thisLITest->inputLen, false) \
+			    && (map_ptr = map_file_mode(fileName, O_RDONLY)) \
+			    && true == init_line_iter_mapMem(&iter, map_ptr, thisLITest->splitChar, thisLITest->skipEmpty) \
+			    && true == check_lines(&iter, thisLITest->expectRet))
+			{
+				fprintf(stdout, "[X] Success\n");
+				numLITestsPassed++;
+			}
+			else
+			{
+				fprintf(stdout, "[ ] FAIL\n");
+			}
+			if (map_ptr)
+			{
+				if (false == unmap_file(map_ptr, false))
+				{
+					HARKLE_ERROR(Fileroad Tests (line iterator), main, unmap_file failed);
+				}
+				free_struct(&map_ptr);
+			}
+			unlink(fileName);
+		}
+	}
+
+	// Error Tests
+	fprintf(stdout, "LI Error Test 1 - NULL buffer\n\t");
+	numLITestsRun++;
+	if (false == init_line_iter(&iter, NULL, 1, '\n', false))
+	{
+		fprintf(stdout, "[X] Success\n");
+		numLITestsPassed++;
+	}
+	else
+	{
+		fprintf(stdout, "[ ] FAIL\n");
+	}
+
+	fprintf(stdout, "LI Error Test 2 - NULL mappedMemory\n\t");
+	numLITestsRun++;
+	if (false == init_line_iter_mapMem(&iter, NULL, '\n', false))
+	{
+		fprintf(stdout, "[X] Success\n");
+		numLITestsPassed++;
+	}
+	else
+	{
+		fprintf(stdout, "[ ] FAIL\n");
+	}
+
+	// CLEAN UP
+	fprintf(stdout, "\n\n");
+	fprintf(stdout, "Tests Run:   \t%d\n", numLITestsRun);
+	fprintf(stdout, "Tests Passed:\t%d\n", numLITestsPassed);
+	fprintf(stdout, "\n\n");
+
+	/***************************************************************************************************/
+	/************************************ LOAD_A_FILE() UNIT TESTS *************************************/
+	/***************************************************************************************************/
+	// LOCAL VARIABLES
+	char* bigInput = NULL;  // Large enough to be mmap()ed
+	size_t bigLen = FRT_MMAP_SIZE;  // Length of bigInput
+	int numLFTestsRun = 0;
+	int numLFTestsPassed = 0;
+	bool loadRet = false;  // Return value from load_a_file()
+
+	// Normal Tests
+	fprintf(stdout, "LF Normal Test 1 - Small file is read()\n\t");
+	numLFTestsRun++;
+	loadRet = write_test_file(fileName, "Hello\n", 6, false) && load_a_file(fileName, &view, &errNum);
+	if (true == loadRet && 0 == errNum && false == view.isMapped && 6 == view.viewLen \
+	    && 0 == strcmp(view.view_ptr, "Hello\n"))
+	{
+		fprintf(stdout, "[X] Success\n");
+		numLFTestsPassed++;
+	}
+	else
+	{
+		fprintf(stdout, "[ ] FAIL (errNum %d, viewLen %zu)\n", errNum, view.viewLen);
+	}
+	unlink(fileName);
+
+	fprintf(stdout, "LF Normal Test 2 - Unsized FIFO larger than the initial read size\n\t");
+	numLFTestsRun++;
+	loadRet = write_test_file(fileName, longInput, strlen(longInput), true) && load_a_file(fileName, &view, &errNum);
+	wait_for_writer();
+	if (true == loadRet && 0 == errNum && false == view.isMapped && strlen(longInput) == view.viewLen \
+	    && 0 == strcmp(view.view_ptr, longInput))
+	{
+		fprintf(stdout, "[X] Success\n");
+		numLFTestsPassed++;
+	}
+	else
+	{
+		fprintf(stdout, "[ ] FAIL (errNum %d, viewLen %zu)\n", errNum, view.viewLen);
+	}
+	unlink(fileName);
+
+	fprintf(stdout, "LF Normal Test 3 - Large file is mmap()ed\n\t");
+	numLFTestsRun++;
+	bigInput = malloc(bigLen);
+	if (bigInput)
+	{
+		for (i = 0; i < (int)bigLen; i++)
+		{
+			bigInput[i] = 'A' + (i % 26);
+		}
+	}
+	loadRet = bigInput && write_test_file(fileName, bigInput, bigLen, false) && load_a_file(fileName, &view, &errNum);
+	if (true == loadRet && 0 == errNum && true == view.isMapped && bigLen == view.viewLen \
+	    && 0 == memcmp(view.view_ptr, bigInput, bigLen))
+	{
+		fprintf(stdout, "[X] Success\n");
+		numLFTestsPassed++;
+	}
+	else
+	{
+		fprintf(stdout, "[ ] FAIL (errNum %d, viewLen %zu)\n", errNum, view.viewLen);
+	}
+	free(bigInput);
+	unlink(fileName);
+
+	// Boundary Tests
+	fprintf(stdout, "LF Boundary Test 1 - Empty file\n\t");
+	numLFTestsRun++;
+	loadRet = write_test_file(fileName, "", 0, false) && load_a_file(fileName, &view, &errNum);
+	if (true == loadRet && 0 == errNum && 0 == view.viewLen && view.view_ptr && '\0' == *(view.view_ptr))
+	{
+		fprintf(stdout, "[X] Success\n");
+		numLFTestsPassed++;
+	}
+	else
+	{
+		fprintf(stdout, "[ ] FAIL (errNum %d, viewLen %zu)\n", errNum, view.viewLen);
+	}
+	unlink(fileName);
+
+	// Error Tests
+	fprintf(stdout, "LF Error Test 1 - Missing file\n\t");
+	numLFTestsRun++;
+	errNum = 0;
+	loadRet = load_a_file(fileName, &view, &errNum);
+	if (false == loadRet && ENOENT == errNum && !(view.view_ptr))
+	{
+		fprintf(stdout, "[X] Success\n");
+		numLFTestsPassed++;
+	}
+	else
+	{
+		fprintf(stdout, "[ ] FAIL    Expected:\tfalse and ENOENT\tReceived:\t%s and %d\n", \
+		        true == loadRet ? "true" : "false", errNum);
+	}
+
+	fprintf(stdout, "LF Error Test 2 - NULL fileName\n\t");
+	numLFTestsRun++;
+	errNum = 0;
+	loadRet = load_a_file(NULL, &view, &errNum);
+	if (false == loadRet && EINVAL == errNum)
+	{
+		fprintf(stdout, "[X] Success\n");
+		numLFTestsPassed++;
+	}
+	else
+	{
+		fprintf(stdout, "[ ] FAIL    Expected:\tfalse and EINVAL\tReceived:\t%s and %d\n", \
+		        true == loadRet ? "true" : "false", errNum);
+	}
+
+	// CLEAN UP
+	release_file_view(&view, false);
+	rmdir(tempName);
+	fprintf(stdout, "\n\n");
+	fprintf(stdout, "Tests Run:   \t%d\n", numLFTestsRun);
+	fprintf(stdout, "Tests Passed:\t%d\n", numLFTestsPassed);
+	fprintf(stdout, "\n\n");
 
 	// DONE
-	return 0;
+	return (numTestsRun == numTestsPassed && numSLTestsRun == numSLTestsPassed \
+	        && numLITestsRun == numLITestsPassed && numLFTestsRun == numLFTestsPassed) ? 0 : 1;
 }
@@ -0,0 +1,280 @@
+#include "Harkledir.h"
+#include "Harklerror.h"
+#include <errno.h>              // ENOENT, ENOMEM
+#include <fcntl.h>              // open()
+#include <stdbool.h>            // bool, true, false
+#include <stdio.h>              // fprintf(), snprintf()
+#include <stdlib.h>             // mkdtemp()
+#include <string.h>             // strlen(), strcmp()
+#include <sys/stat.h>           // mkdir()
+#include <unistd.h>             // close(), symlink(), rmdir(), unlink()
+
+/*
+	The temporary tree every walk_dir_tree() test walks (depth in brackets)
+		a.txt [0], b.c [0], link -> a.txt [0], sub1/ [0], sub4/ [0]
+		sub1/c.txt [1], sub1/sub2/ [1]
+		sub1/sub2/d.txt [2], sub1/sub2/e.c [2], sub1/sub2/sub3/ [2]
+		sub1/sub2/sub3/f.txt [3]
+ */
+#define WDT_NUM_ENTRIES 11
+
+typedef struct walkDirTreeTestStruct
+{
+	char* testName;         // Name and number of test
+	bool useFilter;         // If false, pass NULL as "filter_ptr"
+	hdFilter filter;        // "filter_ptr" input
+	bool stopEarly;         // If true, the callback asks to stop after the first entry
+	size_t expCount;        // Expected return value
+} wdtTest, *wdtTest_ptr;
+
+// Everything the test callback checks and counts
+typedef struct walkDirTreeResultStruct
+{
+	size_t numSeen;         // Entries passed to the callback (atomic)
+	int maxDepth;           // Deepest hw_depth the filter allows, -1 for no limit
+	unsigned int typeFlags; // Types the filter allows, 0 for all
+	bool stopEarly;         // Return false from the callback
+	bool badEntry;          // Set if an entry broke the filter or its own fields
+} wdtResult, *wdtResult_ptr;
+
+/*
+	Purpose - hdWalkCallback that counts entries and checks them against the filter
+ */
+bool count_entry(hwEnt_ptr entry_ptr, void* userData)
+{
+	// LOCAL VARIABLES
+	wdtResult_ptr result_ptr = (wdtResult_ptr)userData;  // What we're checking against
+	size_t pathLen = strlen(entry_ptr->hw_Path);  // Length of hw_Path
+	size_t nameLen = strlen(entry_ptr->hw_Name);  // Length of hw_Name
+
+	__atomic_add_fetch(&(result_ptr->numSeen), 1, __ATOMIC_ACQ_REL);
+
+	if ((result_ptr->maxDepth > -1 && entry_ptr->hw_depth > result_ptr->maxDepth) \
+	    || nameLen > pathLen || 0 != strcmp(entry_ptr->hw_Path + pathLen - nameLen, entry_ptr->hw_Name) \
+	    || (HDIR_DT_REG == result_ptr->typeFlags && DT_REG != entry_ptr->hw_type) \
+	    || (HDIR_DT_DIR == result_ptr->typeFlags && DT_DIR != entry_ptr->hw_type))
+	{
+		__atomic_store_n(&(result_ptr->badEntry), true, __ATOMIC_RELEASE);
+	}
+
+	return false == result_ptr->stopEarly;
+}
+
+/*
+	Purpose - Build the temporary tree described above
+	Output - true on success, false on failure
+ */
+bool make_test_tree(const char* rootName)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	char pathBuff[512] = { 0 };  // Path of the entry being made
+	const char* dir_arr[] = { "sub1", "sub1/sub2", "sub1/sub2/sub3", "sub4", NULL };
+	const char* file_arr[] = { "a.txt", "b.c", "sub1/c.txt", "sub1/sub2/d.txt", "sub1/sub2/e.c", "sub1/sub2/sub3/f.txt", NULL };
+	int fileDesc = -1;  // Return value from open()
+	int i = 0;  // Iterating variable
+
+	for (i = 0; dir_arr[i] && true == retVal; i++)
+	{
+		snprintf(pathBuff, sizeof(pathBuff), "%s/%s", rootName, dir_arr[i]);
+		retVal = 0 == mkdir(pathBuff, 0700);
+	}
+	for (i = 0; file_arr[i] && true == retVal; i++)
+	{
+		snprintf(pathBuff, sizeof(pathBuff), "%s/%s", rootName, file_arr[i]);
+		fileDesc = open(pathBuff, O_WRONLY | O_CREAT | O_EXCL, 0600);
+		retVal = fileDesc > -1;
+		if (fileDesc > -1)
+		{
+			close(fileDesc);
+		}
+	}
+	if (true == retVal)
+	{
+		snprintf(pathBuff, sizeof(pathBuff), "%s/link", rootName);
+		retVal = 0 == symlink("a.txt", pathBuff);
+	}
+
+	return retVal;
+}
+
+/*
+	Purpose - Remove the temporary tree, deepest entries first
+ */
+void remove_test_tree(const char* rootName)
+{
+	// LOCAL VARIABLES
+	char pathBuff[512] = { 0 };  // Path of the entry being removed
+	const char* entry_arr[] = { "sub1/sub2/sub3/f.txt", "sub1/sub2/sub3", "sub1/sub2/d.txt", "sub1/sub2/e.c", \
+	                            "sub1/sub2", "sub1/c.txt", "sub1", "sub4", "link", "a.txt", "b.c", NULL };
+	int i = 0;  // Iterating variable
+
+	for (i = 0; entry_arr[i]; i++)
+	{
+		snprintf(pathBuff, sizeof(pathBuff), "%s/%s", rootName, entry_arr[i]);
+		if (unlink(pathBuff))
+		{
+			rmdir(pathBuff);
+		}
+	}
+	rmdir(rootName);
+}
+
+
+int main(void)
+{
+	/***************************************************************************************************/
+	/****************************************** WALK DIR TREE ******************************************/
+	/***************************************************************************************************/
+	// LOCAL VARIABLES
+	char rootName[] = "/tmp/harkledir_test_XXXXXX";  // mkdtemp() template
+	int numThreads_arr[] = { 1, 2, 4, 0 };  // "numThreads" inputs each test is run with
+	wdtResult result = { 0 };  // Callback's tally
+	size_t walkRet = 0;  // Return value from walk_dir_tree()
+	int errNum = 0;  // [OUT] parameter for walk_dir_tree()
+	int numTestsRun = 0;
+	int numTestsPassed = 0;
+	int i = 0;  // Iterating variable
+	wdtTest_ptr test = NULL;  // Current test being run
+	wdtTest_ptr* currTest_ptr = NULL;  // Iterating variable
+
+	// Normal Tests
+	wdtTest normTest01 = { "Normal Test 01 - Everything", false, { 0, NULL, -1 }, false, WDT_NUM_ENTRIES };
+	wdtTest normTest02 = { "Normal Test 02 - Everything (explicit filter)", true, { HDIR_DT_ALL, NULL, -1 }, false, WDT_NUM_ENTRIES };
+	// Glob Tests
+	wdtTest globTest01 = { "Glob Test 01 - *.txt", true, { 0, "*.txt", -1 }, false, 4 };
+	wdtTest globTest02 = { "Glob Test 02 - sub?", true, { 0, "sub?", -1 }, false, 4 };
+	wdtTest globTest03 = { "Glob Test 03 - No matches", true, { 0, "*.none", -1 }, false, 0 };
+	// Type Tests
+	wdtTest typeTest01 = { "Type Test 01 - Regular files", true, { HDIR_DT_REG, NULL, -1 }, false, 6 };
+	wdtTest typeTest02 = { "Type Test 02 - Directories", true, { HDIR_DT_DIR, NULL, -1 }, false, 4 };
+	wdtTest typeTest03 = { "Type Test 03 - Symbolic links (never followed)", true, { HDIR_DT_LNK, NULL, -1 }, false, 1 };
+	wdtTest typeTest04 = { "Type Test 04 - Regular files matching *.c", true, { HDIR_DT_REG, "*.c", -1 }, false, 2 };
+	// Depth Tests
+	wdtTest depthTest01 = { "Depth Test 01 - maxDepth 0", true, { 0, NULL, 0 }, false, 5 };
+	wdtTest depthTest02 = { "Depth Test 02 - maxDepth 1", true, { 0, NULL, 1 }, false, 7 };
+	wdtTest depthTest03 = { "Depth Test 03 - maxDepth 2", true, { 0, NULL, 2 }, false, 10 };
+	wdtTest depthTest04 = { "Depth Test 04 - maxDepth 3", true, { 0, NULL, 3 }, false, WDT_NUM_ENTRIES };
+	wdtTest depthTest05 = { "Depth Test 05 - maxDepth 1 matching *.txt", true, { 0, "*.txt", 1 }, false, 2 };
+	// Stop Tests
+	wdtTest stopTest01 = { "Stop Test 01 - Callback stops at the first entry", false, { 0, NULL, -1 }, true, 1 };
+
+	wdtTest_ptr test_arr[] = { &normTest01, &normTest02, \
+	                           &globTest01, &globTest02, &globTest03, \
+	                           &typeTest01, &typeTest02, &typeTest03, &typeTest04, \
+	                           &depthTest01, &depthTest02, &depthTest03, &depthTest04, &depthTest05, \
+	                           &stopTest01, NULL };
+
+	// SETUP
+	if (!mkdtemp(rootName) || false == make_test_tree(rootName))
+	{
+		HARKLE_ERROR(Harkledir_Tests, main, Unable to build the test tree);
+		remove_test_tree(rootName);
+		return 1;
+	}
+
+	// RUN TESTS
+	fprintf(stdout, "\nWALK DIR TREE UNIT TESTS\n");
+
+#ifndef HDIR_DENTS_BUFF
+	for (currTest_ptr = test_arr; *currTest_ptr; currTest_ptr++)
+	{
+		test = *currTest_ptr;
+		fprintf(stdout, "\t%s\n", test->testName);
+
+		for (i = 0; i < (int)(sizeof(numThreads_arr) / sizeof(*numThreads_arr)); i++)
+		{
+			// Every thread count sees a stop after exactly one entry only if it's alone
+			if (true == test->stopEarly && numThreads_arr[i] != 1)
+			{
+				continue;
+			}
+
+			memset(&result, 0, sizeof(result));
+			result.maxDepth = true == test->useFilter ? test->filter.maxDepth : -1;
+			result.typeFlags = true == test->useFilter ? test->filter.typeFlags : 0;
+			result.stopEarly = test->stopEarly;
+			errNum = -1;
+
+			walkRet = walk_dir_tree(rootName, true == test->useFilter ? &(test->filter) : NULL, \
+			                        count_entry, &result, numThreads_arr[i], &errNum);
+
+			fprintf(stdout, "\t\t%d thread(s)    ", numThreads_arr[i]);
+			numTestsRun++;
+
+			if (walkRet == test->expCount && result.numSeen == test->expCount \
+			    && false == result.badEntry && 0 == errNum)
+			{
+				fprintf(stdout, "[X] Success\n");
+				numTestsPassed++;
+			}
+			else
+			{
+				fprintf(stdout, "[ ] FAIL    Expected:\t%zu\tReceived:\t%zu (callback saw %zu, errNum %d%s)\n", \
+				        test->expCount, walkRet, result.numSeen, errNum, true == result.badEntry ? ", bad entry" : "");
+			}
+		}
+	}
+
+	// Error Tests
+	fprintf(stdout, "\tError Test 01 - Missing rootName\n\t\t");
+	numTestsRun++;
+	memset(&result, 0, sizeof(result));
+	result.maxDepth = -1;
+	walkRet = walk_dir_tree("/tmp/harkledir_test_missing/nope", NULL, count_entry, &result, 2, &errNum);
+	if (0 == walkRet && ENOENT == errNum)
+	{
+		fprintf(stdout, "[X] Success\n");
+		numTestsPassed++;
+	}
+	else
+	{
+		fprintf(stdout, "[ ] FAIL    Expected:\t0 and ENOENT\tReceived:\t%zu and %d\n", walkRet, errNum);
+	}
+
+	fprintf(stdout, "\tError Test 02 - NULL callback\n\t\t");
+	numTestsRun++;
+	walkRet = walk_dir_tree(rootName, NULL, NULL, &result, 2, &errNum);
+	if (0 == walkRet)
+	{
+		fprintf(stdout, "[X] Success\n");
+		numTestsPassed++;
+	}
+	else
+	{
+		fprintf(stdout, "[ ] FAIL    Expected:\t0\tReceived:\t%zu\n", walkRet);
+	}
+
+#else
+	// Built against a Harkledir.c whose HDIR_DENTS_BUFF can't be allocated (see: Makefile),
+	// so every worker's getdents64 buffer malloc() fails
+	for (i = 0; i < (int)(sizeof(numThreads_arr) / sizeof(*numThreads_arr)); i++)
+	{
+		fprintf(stdout, "\tError Test 03 - Every buffer allocation fails (%d thread(s))\n\t\t", numThreads_arr[i]);
+		numTestsRun++;
+		memset(&result, 0, sizeof(result));
+		result.maxDepth = -1;
+		errNum = 0;
+		walkRet = walk_dir_tree(rootName, NULL, count_entry, &result, numThreads_arr[i], &errNum);
+		if (0 == walkRet && 0 == result.numSeen && ENOMEM == errNum)
+		{
+			fprintf(stdout, "[X] Success\n");
+			numTestsPassed++;
+		}
+		else
+		{
+			fprintf(stdout, "[ ] FAIL    Expected:\t0 and ENOMEM\tReceived:\t%zu and %d\n", walkRet, errNum);
+		}
+	}
+#endif  // HDIR_DENTS_BUFF
+
+	// CLEAN UP
+	remove_test_tree(rootName);
+
+	// REPORT RESULTS
+	fprintf(stdout, "\n\nTests Run:   \t%d\n", numTestsRun);
+	fprintf(stdout,     "Tests Passed:\t%d\n\n", numTestsPassed);
+
+	// DONE
+	return numTestsRun == numTestsPassed ? 0 : 1;
+}
@@ -3,6 +3,8 @@
 		Take a PID as an argument
 		Print the libraries opened by that PID
 	This source is the culmination of all the work completed on 3-10-2.
+	Pass "all" instead of a PID to print the libraries opened by every PID.
+		The symbolic links are resolved through one shared harkleLinkCache.
  */
 
 #include "Fileroad.h"
@@ -14,6 +16,82 @@
 #include <stdbool.h>	// bool, true, false
 #include <string.h>
 
+
+/*
+	Purpose - Print the unique files mapped by one PID
+	Input
+		pidStruct_ptr - PID to parse
+		cache_ptr - Optional.  Link cache shared between PIDs.
+	Output - true on success, false on failure
+ */
+bool print_mapped_files(pidDetails_ptr pidStruct_ptr, hdLinkCache_ptr cache_ptr)
+{
+	// LOCAL VARIABLES
+	bool success = true;  // If anything fails, set this to false
+	char* mapFilesName = NULL;  // /proc/<PID>/map_files/
+	dirDetails_ptr mapFiles_ptr = NULL;  // Return value from open_dir_cached()
+	char** uniqueSymNames = NULL;  // Return value from parse_dirDetails_to_char_arr()
+	char** tempChar_arr = NULL;  // Iterating variable for uniqueSymNames
+
+	// PARSE /proc/<PID>/map_files
+	mapFilesName = os_path_join(pidStruct_ptr->pidName, "/map_files/", false);
+
+	if (!mapFilesName)
+	{
+		HARKLE_ERROR(print_PID_libraries, print_mapped_files, os_path_join has failed);
+		success = false;
+	}
+	else
+	{
+		mapFiles_ptr = open_dir_cached(mapFilesName, cache_ptr, 0);
+
+		if (!mapFiles_ptr)
+		{
+			success = false;  // open_dir_cached() already said why
+		}
+		else if (mapFiles_ptr->numFiles > 0)
+		{
+			uniqueSymNames = parse_dirDetails_to_char_arr(mapFiles_ptr, HDIR_DT_LNK, true, true);
+
+			if (!uniqueSymNames)
+			{
+				HARKLE_ERROR(print_PID_libraries, print_mapped_files, parse_dirDetails_to_char_arr has failed);
+				success = false;
+			}
+		}
+	}
+
+	// PRINT
+	if (success == true)
+	{
+		fprintf(stdout, "\nFiles loaded by %s (%s):\n", pidStruct_ptr->pidName, pidStruct_ptr->pidCmdline ? pidStruct_ptr->pidCmdline : "");
+		tempChar_arr = uniqueSymNames;
+
+		while (tempChar_arr && *tempChar_arr)
+		{
+			fprintf(stdout, "\t%s\n", *tempChar_arr);
+			tempChar_arr++;
+		}
+	}
+
+	// CLEAN UP
+	if (mapFilesName)
+	{
+		release_a_string(&mapFilesName);
+	}
+	if (mapFiles_ptr)
+	{
+		free_dirDetails_ptr(&mapFiles_ptr);
+	}
+	if (uniqueSymNames)
+	{
+		free_char_arr(&uniqueSymNames);
+	}
+
+	// DONE
+	return success;
+}
+
  
  int main(int argc, char* argv[])
  {
@@ -28,6 +106,8 @@
 	char* userProcPIDMapFiles = NULL;  // Will hold char* with user's /proc/<PID>/map_files/ choice
 	char** uniqueSymNames = NULL;  // Return value from parse_dirDetails_to_char_arr()
 	char** tempChar_arr = NULL;  // Iterating variable for uniqueSymNames
+	hdLinkCache_ptr linkCache_ptr = NULL;  // Shared by every PID in "all" mode
+	int numFailed = 0;  // PIDs that could not be parsed in "all" mode
 
 	// INPUT VALIDATION
 	// procPIDStructs
@@ -40,14 +120,40 @@
 
 	if (argc < 2)
 	{
-		fprintf(stderr, "\nToo few arguments!\nusage: print_PID_libraries.exe <PID>\n\n");
+		fprintf(stderr, "\nToo few arguments!\nusage: print_PID_libraries.exe <PID | all>\n\n");
 		success = false;
 	}
 	else if (argc > 2)
 	{
-		fprintf(stderr, "\nToo many arguments!\nusage: print_PID_libraries.exe <PID>\n\n");
+		fprintf(stderr, "\nToo many arguments!\nusage: print_PID_libraries.exe <PID | all>\n\n");
 		success = false;
 	}
+	else if (success == true && 0 == strcmp(argv[1], "all"))
+	{
+		// Every PID, one shared link cache
+		linkCache_ptr = create_link_cache(0);
+
+		if (!linkCache_ptr)
+		{
+			HARKLE_ERROR(print_PID_libraries, main, create_link_cache has failed);
+		}
+		else
+		{
+			while (*temp_arr)
+			{
+				if ((*temp_arr)->stillExists == true && false == print_mapped_files(*temp_arr, linkCache_ptr))
+				{
+					numFailed++;
+				}
+				temp_arr++;
+			}
+
+			fprintf(stdout, "\n%zu unique files, %d PIDs could not be parsed.\n", \
+				    linkCache_ptr->target_ptr->numStrings, numFailed);
+			free_link_cache(&linkCache_ptr);
+		}
+		success = false;  // Nothing left to do below
+	}
 	else if (false == is_it_a_PID(argv[1]))
 	{
 		fprintf(stderr, "\nInvalid PID!\nusage: print_PID_libraries.exe <PID>\nexample: print_PID_libraries.exe 1234\n\n");
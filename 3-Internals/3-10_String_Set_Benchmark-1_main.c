@@ -0,0 +1,172 @@
+/*
+ *	The purpose of this file is to compare deduplicating strings with
+ *	search_char_arr() (linear) against a Memoroad memStrSet (hashed), the way
+ *	parse_dirDetails_to_char_arr() does for uniqueEntries.
+ *
+ *	Usage: str_set_benchmark.exe [number of entries (default 100000)]
+ */
+
+#include "Fileroad.h"							// search_char_arr()
+#include "Harkledir.h"							// parse_dirDetails_to_char_arr()
+#include "Harklerror.h"							// HARKLE_ERROR
+#include "Memoroad.h"							// create_mem_str_set()
+#include <stdbool.h>							// bool, true, false
+#include <stdio.h>								// fprintf(), snprintf()
+#include <stdlib.h>								// strtoul()
+#include <time.h>								// clock_gettime()
+
+#define SS_DEFAULT_ENTRIES 100000				// Default number of entries
+#define SS_NAME_LEN 64							// Buffer size for each fake library name
+
+
+/*
+	Purpose - Monotonic time in seconds
+ */
+double get_seconds(void)
+{
+	struct timespec now = { 0 };
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + (now.tv_nsec / 1e9);
+}
+
+
+int main(int argc, char* argv[])
+{
+	// LOCAL VARIABLES
+	size_t numEntries = SS_DEFAULT_ENTRIES;  // Number of entries to deduplicate
+	char** name_arr = NULL;  // Fake map_files symlink targets, about half of them repeats
+	char** unique_arr = NULL;  // search_char_arr() output
+	char** parsed_arr = NULL;  // parse_dirDetails_to_char_arr() output
+	hdEnt_ptr* ent_arr = NULL;  // Fake dirDetails entries
+	dirDetails fakeDir = { 0 };  // Fake /proc/<PID>/map_files/
+	memStrSet_ptr set_ptr = NULL;  // Hash set
+	char name[SS_NAME_LEN] = { 0 };  // Name buffer
+	size_t numLegacy = 0;  // Unique count from search_char_arr()
+	size_t numSet = 0;  // Unique count from the memStrSet
+	size_t numParsed = 0;  // Unique count from parse_dirDetails_to_char_arr()
+	bool isNew = false;  // str_set_add() output
+	double legacyTime = 0;  // Seconds spent deduplicating with search_char_arr()
+	double setTime = 0;  // Seconds spent deduplicating with a memStrSet
+	double parseTime = 0;  // Seconds spent in parse_dirDetails_to_char_arr()
+	double startTime = 0;  // Timer
+	size_t i = 0;  // Iterating variable
+	bool success = true;  // Make this false if anything fails
+
+	// INPUT VALIDATION
+	if (argc > 1)
+	{
+		numEntries = strtoul(argv[1], NULL, 10);
+
+		if (numEntries < 1)
+		{
+			HARKLE_ERROR(str_set_benchmark, main, Invalid number of entries);
+			return 1;
+		}
+	}
+
+	// BUILD THE ENTRIES
+	name_arr = get_me_a_buffer_array(numEntries, true);
+	unique_arr = get_me_a_buffer_array(numEntries, true);
+	ent_arr = calloc(numEntries + 1, sizeof(hdEnt_ptr));
+
+	if (!name_arr || !unique_arr || !ent_arr)
+	{
+		HARKLE_ERROR(str_set_benchmark, main, Allocation failed);
+		return 1;
+	}
+
+	for (i = 0; i < numEntries && true == success; i++)
+	{
+		snprintf(name, sizeof(name), "/usr/lib/x86_64-linux-gnu/libfake-%zu.so.6", (i * 2654435761UL) % (numEntries / 2 + 1));
+		name_arr[i] = copy_a_string(name);
+		ent_arr[i] = create_hdEnt_ptr();
+
+		if (!name_arr[i] || !ent_arr[i])
+		{
+			HARKLE_ERROR(str_set_benchmark, main, Allocation failed);
+			success = false;
+		}
+		else
+		{
+			ent_arr[i]->hd_Name = copy_a_string(name + 1);
+			ent_arr[i]->hd_symName = copy_a_string(name);
+			ent_arr[i]->hd_type = DT_LNK;
+		}
+	}
+	fakeDir.dirName = "/proc/self/map_files/";
+	fakeDir.fileName_arr = ent_arr;
+	fakeDir.numFiles = (int)numEntries;
+
+	// RUN
+	if (true == success)
+	{
+		fprintf(stdout, "Entries: %zu\n", numEntries);
+
+		// 1. search_char_arr()
+		startTime = get_seconds();
+		for (i = 0; i < numEntries; i++)
+		{
+			if (-1 == search_char_arr(unique_arr, name_arr[i]))
+			{
+				unique_arr[numLegacy++] = name_arr[i];
+			}
+		}
+		legacyTime = get_seconds() - startTime;
+
+		// 2. memStrSet
+		startTime = get_seconds();
+		set_ptr = create_mem_str_set(numEntries, false);
+		for (i = 0; i < numEntries && set_ptr; i++)
+		{
+			if (str_set_add(set_ptr, name_arr[i], &isNew) && true == isNew)
+			{
+				numSet++;
+			}
+		}
+		setTime = get_seconds() - startTime;
+
+		// 3. parse_dirDetails_to_char_arr()
+		startTime = get_seconds();
+		parsed_arr = parse_dirDetails_to_char_arr(&fakeDir, HDIR_DT_LNK, true, true);
+		parseTime = get_seconds() - startTime;
+		while (parsed_arr && parsed_arr[numParsed])
+		{
+			numParsed++;
+		}
+
+		fprintf(stdout, "%-30s %-10s %-10s\n", "Method", "Unique", "Time (s)");
+		fprintf(stdout, "%-30s %-10zu %-10.4f\n", "search_char_arr()", numLegacy, legacyTime);
+		fprintf(stdout, "%-30s %-10zu %-10.4f\n", "memStrSet", numSet, setTime);
+		fprintf(stdout, "%-30s %-10zu %-10.4f\n", "parse_dirDetails_to_char_arr()", numParsed, parseTime);
+		fprintf(stdout, "memStrSet speedup: %.1fx\n", setTime > 0 ? legacyTime / setTime : 0);
+
+		if (numLegacy != numSet || numLegacy != numParsed)
+		{
+			HARKLE_ERROR(str_set_benchmark, main, Results differ);
+			success = false;
+		}
+	}
+
+	// CLEAN UP
+	if (set_ptr)
+	{
+		free_mem_str_set(&set_ptr);
+	}
+	if (parsed_arr)
+	{
+		free_char_arr(&parsed_arr);
+	}
+	for (i = 0; i < numEntries; i++)
+	{
+		if (ent_arr[i])
+		{
+			free_hdEnt_ptr(&(ent_arr[i]));
+		}
+	}
+	free(ent_arr);
+	free(unique_arr);  // Borrowed name_arr's strings
+	free_char_arr(&name_arr);
+
+	// DONE
+	return true == success ? 0 : 1;
+}
@@ -0,0 +1,182 @@
+/*
+ *	The purpose of this file is to compare the original point-by-point ellipse plot
+ *	(calc_ellipse_y_coord() and round_a_dble() per coordinate) against the batched
+ *	plot_ellipse_batch() and round_dble_arr() pipeline.
+ *
+ *	Usage: ellipse_batch_benchmark.exe [largest major axis (default 4000000)]
+ */
+
+#include "Harklerror.h"							// HARKLE_ERROR
+#include "Harklemath.h"							// plot_ellipse_batch(), round_dble_arr()
+#include <limits.h>								// INT_MAX
+#include <stdbool.h>							// bool, true, false
+#include <stdio.h>								// fprintf()
+#include <stdlib.h>								// strtoul()
+#include <time.h>								// clock_gettime()
+
+#define EB_DEFAULT_MAX_AXIS 4000000				// Default largest major axis
+#define EB_MINOR_RATIO 0.37						// Minor axis, as a fraction of the major axis
+
+
+/*
+	Purpose - The original plot_ellipse_points() x-major loop, followed by the original
+		per-coordinate rounding, kept as the control
+	Output - Heap-allocated array of 2 * numPnts rounded coordinates on success, NULL on failure
+ */
+int* legacy_plot(double aVal, double bVal, int numPnts)
+{
+	// LOCAL VARIABLES
+	double* plot_arr = NULL;  // Interleaved coordinate pairs
+	int* retVal = NULL;  // Rounded coordinate pairs
+	double majPnt = -1 * (int)aVal;  // Point along the major axis
+	double flipIt = 1;  // Flips the y coordinate once the top half is done
+	int count = 0;  // Iterating variable
+
+	plot_arr = (double*)calloc(2 * numPnts, sizeof(double));
+	retVal = (int*)calloc(2 * numPnts, sizeof(int));
+
+	if (plot_arr && retVal)
+	{
+		while (count < 2 * numPnts)
+		{
+			plot_arr[count++] = majPnt;
+			plot_arr[count++] = flipIt * calc_ellipse_y_coord(aVal, bVal, majPnt);
+
+			if (majPnt == (int)aVal)
+			{
+				flipIt = -1;
+			}
+			majPnt += flipIt;
+		}
+
+		for (count = 0; count < 2 * numPnts; count++)
+		{
+			retVal[count] = round_a_dble(plot_arr[count], HM_UP);
+		}
+	}
+	else
+	{
+		HARKLE_ERROR(ellipse_batch_benchmark, legacy_plot, calloc failed);
+		free(retVal);
+		retVal = NULL;
+	}
+
+	// DONE
+	free(plot_arr);
+	return retVal;
+}
+
+
+/*
+	Purpose - The batched pipeline
+	Output - Heap-allocated array of 2 * numPnts rounded coordinates on success, NULL on failure
+ */
+int* batch_plot(double aVal, double bVal, int numPnts)
+{
+	// LOCAL VARIABLES
+	hmPlotPnts_ptr batch_ptr = plot_ellipse_batch(aVal, bVal);  // SoA plot points
+	int* retVal = NULL;  // Rounded x coordinates followed by rounded y coordinates
+
+	if (batch_ptr && batch_ptr->numPnts == numPnts)
+	{
+		retVal = (int*)calloc(2 * numPnts, sizeof(int));
+
+		if (!retVal
+			|| false == round_dble_arr(batch_ptr->x_arr, retVal, numPnts, HM_UP)
+			|| false == round_dble_arr(batch_ptr->y_arr, retVal + numPnts, numPnts, HM_UP))
+		{
+			HARKLE_ERROR(ellipse_batch_benchmark, batch_plot, Rounding failed);
+			free(retVal);
+			retVal = NULL;
+		}
+	}
+	else
+	{
+		HARKLE_ERROR(ellipse_batch_benchmark, batch_plot, plot_ellipse_batch failed);
+	}
+
+	// DONE
+	free_hmPlotPnts_ptr(&batch_ptr);
+	return retVal;
+}
+
+
+/*
+	Purpose - Monotonic time in seconds
+ */
+double get_seconds(void)
+{
+	struct timespec now = { 0 };
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + (now.tv_nsec / 1e9);
+}
+
+
+int main(int argc, char* argv[])
+{
+	// LOCAL VARIABLES
+	size_t maxAxis = EB_DEFAULT_MAX_AXIS;  // Largest major axis
+	size_t majAxis = 0;  // Current major axis
+	int numPnts = 0;  // Number of coordinate pairs for the current major axis
+	int* legacyRes = NULL;  // Return value from legacy_plot()
+	int* newRes = NULL;  // Return value from batch_plot()
+	double legacyTime = 0;  // Seconds spent in legacy_plot()
+	double newTime = 0;  // Seconds spent in batch_plot()
+	double startTime = 0;  // Timer
+	int i = 0;  // Iterating variable
+	bool success = true;  // Make this false if any results differ
+
+	// INPUT VALIDATION
+	if (argc > 1)
+	{
+		maxAxis = strtoul(argv[1], NULL, 10);
+
+		if (maxAxis < 1 || maxAxis > (INT_MAX / 4))
+		{
+			HARKLE_ERROR(ellipse_batch_benchmark, main, Invalid major axis);
+			return 1;
+		}
+	}
+
+	// RUN
+	fprintf(stdout, "%-10s %-10s %-12s %-12s %-8s\n", "MajorAxis", "Points", "Legacy (s)", "Batch (s)", "Speedup");
+
+	for (majAxis = 1000; majAxis <= maxAxis && true == success; majAxis *= 4)
+	{
+		numPnts = majAxis * 4;
+
+		startTime = get_seconds();
+		legacyRes = legacy_plot(majAxis, majAxis * EB_MINOR_RATIO, numPnts);
+		legacyTime = get_seconds() - startTime;
+
+		startTime = get_seconds();
+		newRes = batch_plot(majAxis, majAxis * EB_MINOR_RATIO, numPnts);
+		newTime = get_seconds() - startTime;
+
+		if (!legacyRes || !newRes)
+		{
+			success = false;
+		}
+		else
+		{
+			fprintf(stdout, "%-10zu %-10d %-12.4f %-12.4f %.1fx\n", majAxis, numPnts, legacyTime, newTime, \
+			        newTime > 0 ? legacyTime / newTime : 0);
+
+			for (i = 0; i < numPnts; i++)
+			{
+				if (legacyRes[2 * i] != newRes[i] || legacyRes[(2 * i) + 1] != newRes[numPnts + i])
+				{
+					HARKLE_ERROR(ellipse_batch_benchmark, main, Results differ);
+					success = false;
+					break;
+				}
+			}
+		}
+
+		free(legacyRes);
+		free(newRes);
+	}
+
+	// DONE
+	return true == success ? 0 : 1;
+}
@@ -1,5 +1,7 @@
 #include "Harklemath.h"
 #include "Harklerror.h"
+#include <limits.h>             // INT_MAX
+#include <math.h>               // fabs(), sqrt()
 #include <stdbool.h>            // bool, true, false
 #include <stdlib.h>             // free()
 #include <string.h>             // memset()
@@ -29,6 +31,44 @@ typedef struct plotEllipsePointsTestStruct
     double* expArr;         // Array of expected ellipse coordinate points
 } pepTest, *pepTest_ptr;
 
+typedef struct plotEllipseBatchTestStruct
+{
+    char* testName;         // Name and number of test
+    double aIn;             // "a" input
+    double bIn;             // "b" input
+    int expNumPts;          // Expected number of points (0 if plot_ellipse_batch() should fail)
+    double* expXArr;        // Array of expected x coordinates, in plot order
+    double* expYArr;        // Array of expected y coordinates, in plot order
+} pebTest, *pebTest_ptr;
+
+typedef struct roundDoubleArrayTestStruct
+{
+    char* testName;         // Name and number of test
+    double* inArr;          // "roundMe_arr" input
+    int numIn;              // "numDbls" input
+    int rndDir;             // "rndDir" input
+    bool expRet;            // Expected return value
+    int* expArr;            // Array of expected results (if expRet is true)
+} rdaTest, *rdaTest_ptr;
+
+typedef struct doubleCompareArrayTestStruct
+{
+    char* testName;         // Name and number of test
+    int cmpType;            // "cmpType" input
+    bool (*scalarFunc)(double, double, int);  // The single comparison cmpType should match
+} dcaTest, *dcaTest_ptr;
+
+typedef struct doubleCompareArrayErrorTestStruct
+{
+    char* testName;         // Name and number of test
+    double* xArr;           // "x_arr" input
+    bool* resArr;           // "result_arr" input
+    int numIn;              // "numDbls" input
+    int precIn;             // "precision" input
+    int cmpType;            // "cmpType" input
+    bool expRet;            // Expected return value
+} dcaErrTest, *dcaErrTest_ptr;
+
 
 int main(void)
 {
@@ -493,6 +533,357 @@ int main(void)
         pepTests++;
     }
 
+    /***************************************************************************************************/
+    /********************************** PLOT ELLIPSE BATCH UNIT TESTS **********************************/
+    /***************************************************************************************************/
+    // LOCAL VARIABLES
+    pebTest_ptr pebUnitTest = NULL;  // Current test being run
+    pebTest_ptr* pebTestArr_ptr = NULL;  // Current test array
+    hmPlotPnts_ptr pebPnts = NULL;  // Return value from plot_ellipse_batch()
+    bool pebPassed = true;  // Make this false if anything fails
+    int pebPnt = 0;  // Index into the plot points
+    double pebQ1 = sqrt(8.0 / 9);  // Minor axis coordinates that aren't whole numbers
+    double pebQ2 = sqrt(5.0 / 9);
+    double pebQ3 = sqrt(0.84);
+    double pebQ4 = sqrt(0.75);
+
+/******************************************************************************************************************************************/
+/***************************************************************** LEGEND *****************************************************************/
+/******************************************************************************************************************************************/
+/*  Data type  Var Name          Test Name         aIn             bIn           expNum    expXArr          expYArr                       */
+/******************************************************************************************************************************************/
+    // Normal Tests
+    // 1. X-major: (-a, y) through (+a, y) above the x axis, then back to (-a + 1, -y)
+    double     pebNormXArr00[] = { -3, -2, -1, 0, 1, 2, 3, 2, 1, 0, -1, -2 };
+    double     pebNormYArr00[] = { 0, 2 * pebQ2, 2 * pebQ1, 2, 2 * pebQ1, 2 * pebQ2, 0, -2 * pebQ2, -2 * pebQ1, -2, -2 * pebQ1, -2 * pebQ2 };
+    pebTest    pebNormTest00 = { "Normal Test 00", (double)3,     (double)2,     12,       pebNormXArr00,  pebNormYArr00 };
+    // 2. Y-major: (-x, 0) up to (0, b), down to (0, -b) and back up to (-x, -1)
+    double     pebNormXArr01[] = { -1, -pebQ4, 0, pebQ4, 1, pebQ4, 0, -pebQ4 };
+    double     pebNormYArr01[] = { 0, 1, 2, 1, 0, -1, -2, -1 };
+    pebTest    pebNormTest01 = { "Normal Test 01", (double)1,     (double)2,     8,        pebNormXArr01,  pebNormYArr01 };
+    // 3. Non-integer axes: points land on whole major axis coordinates, the minor axis isn't rounded
+    double     pebNormXArr02[] = { -2, -1, 0, 1, 2, 1, 0, -1 };
+    double     pebNormYArr02[] = { 0.9, 1.5 * pebQ3, 1.5, 1.5 * pebQ3, 0.9, -1.5 * pebQ3, -1.5, -1.5 * pebQ3 };
+    pebTest    pebNormTest02 = { "Normal Test 02", (double)2.5,   (double)1.5,   8,        pebNormXArr02,  pebNormYArr02 };
+    double     pebNormXArr03[] = { -1.5, -1.5 * pebQ3, -0.9, 1.5 * pebQ3, 1.5, 1.5 * pebQ3, 0.9, -1.5 * pebQ3 };
+    double     pebNormYArr03[] = { 0, 1, 2, 1, 0, -1, -2, -1 };
+    pebTest    pebNormTest03 = { "Normal Test 03", (double)-1.5,  (double)-2.5,  8,        pebNormXArr03,  pebNormYArr03 };
+    // Error Tests
+    pebTest    pebErrTest00 = { "Error Test 00",  (double)0,     (double)2,     0,        NULL,           NULL };
+    pebTest    pebErrTest01 = { "Error Test 01",  (double)0.5,   (double)0.25,  0,        NULL,           NULL };
+    pebTest    pebErrTest02 = { "Error Test 02",  (double)INT_MAX, (double)2,   0,        NULL,           NULL };
+    pebTest    pebErrTest03 = { "Error Test 03",  (double)2,     (double)INT_MAX / 2, 0,  NULL,           NULL };
+/******************************************************************************************************************************************/
+/***************************************************************** LEGEND *****************************************************************/
+/******************************************************************************************************************************************/
+
+    pebTest_ptr pebTest_arr[] = { \
+        &pebNormTest00, &pebNormTest01, &pebNormTest02, &pebNormTest03, \
+        &pebErrTest00, &pebErrTest01, &pebErrTest02, &pebErrTest03, NULL };
+
+    // RUN TESTS
+    pebTestArr_ptr = pebTest_arr;
+    fprintf(stdout, "\nPLOT ELLIPSE BATCH UNIT TESTS\n");
+
+    while (*pebTestArr_ptr)
+    {
+        pebUnitTest = *pebTestArr_ptr;
+
+        // EXECUTE TEST
+        fprintf(stdout, "%s\n\t", pebUnitTest->testName);
+        pebPassed = true;
+        pebPnts = plot_ellipse_batch(pebUnitTest->aIn, pebUnitTest->bIn);
+        numTestsRun++;
+
+        // 1. Verify failure
+        if (0 == pebUnitTest->expNumPts)
+        {
+            if (pebPnts)
+            {
+                fprintf(stdout, "[ ] FAIL    Expected NULL\n");
+                pebPassed = false;
+            }
+        }
+        // 2. Verify pointer received
+        else if (NULL == pebPnts)
+        {
+            fprintf(stdout, "[ ] FAIL    NULL pointer returned\n");
+            pebPassed = false;
+        }
+        // 3. Verify number of points is correct
+        else if (pebPnts->numPnts != pebUnitTest->expNumPts)
+        {
+            fprintf(stdout, "[ ] FAIL    Number of points\n\t\t");
+            fprintf(stdout, "Expected: %d\n\t\tReceived: %d\n", pebUnitTest->expNumPts, pebPnts->numPnts);
+            pebPassed = false;
+        }
+        // 4. Verify each point, in order
+        else
+        {
+            for (pebPnt = 0; pebPnt < pebPnts->numPnts; pebPnt++)
+            {
+                if (false == dble_equal_to(pebUnitTest->expXArr[pebPnt], pebPnts->x_arr[pebPnt], DBL_PRECISION) \
+                    || false == dble_equal_to(pebUnitTest->expYArr[pebPnt], pebPnts->y_arr[pebPnt], DBL_PRECISION))
+                {
+                    fprintf(stdout, "[ ] FAIL    Point %d mismatch\n\t\t", pebPnt);
+                    fprintf(stdout, "Expected: (%.15f,%.15f)\n\t\tReceived: (%.15f,%.15f)\n", \
+                            pebUnitTest->expXArr[pebPnt], pebUnitTest->expYArr[pebPnt], \
+                            pebPnts->x_arr[pebPnt], pebPnts->y_arr[pebPnt]);
+                    pebPassed = false;
+                    break;
+                }
+            }
+        }
+
+        // Determine pass/fail
+        if (true == pebPassed)
+        {
+            fprintf(stdout, "[X] Success\n");
+            numTestsPassed++;
+        }
+
+        // CLEAN UP TEST RESULT
+        if (pebPnts)
+        {
+            free_hmPlotPnts_ptr(&pebPnts);
+        }
+
+        pebTestArr_ptr++;
+    }
+
+    /***************************************************************************************************/
+    /********************************* ROUND DOUBLE ARRAY UNIT TESTS ***********************************/
+    /***************************************************************************************************/
+    // LOCAL VARIABLES
+    rdaTest_ptr rdaUnitTest = NULL;  // Current test being run
+    rdaTest_ptr* rdaTestArr_ptr = NULL;  // Current test array
+    int rdaResArr[16] = { 0 };  // Results from round_dble_arr()
+    bool rdaPassed = true;  // Make this false if anything fails
+    int rdaIdx = 0;  // Index into the results
+
+/******************************************************************************************************************************************/
+/***************************************************************** LEGEND *****************************************************************/
+/******************************************************************************************************************************************/
+/*  Data type  Var Name          Test Name         inArr          numIn  rndDir  expRet  expArr                                          */
+/******************************************************************************************************************************************/
+    // Long enough to cover the vector engines and their scalar tail
+    double     rdaInArr[]      = { 2.5, -2.5, 0.5, -0.5, 1.4999, -1.5001, 3.0, -3.0, 7.25, -0.25, 1e9 + 0.5 };
+    // Normal Tests
+    // 1. HM_RND rounds halfway cases away from zero
+    int        rdaNormExp00[]  = { 3, -3, 1, -1, 1, -2, 3, -3, 7, 0, 1000000001 };
+    rdaTest    rdaNormTest00 = { "Normal Test 00", rdaInArr,      11,    HM_RND, true,   rdaNormExp00 };
+    // 2. HM_DWN is floor()
+    int        rdaNormExp01[]  = { 2, -3, 0, -1, 1, -2, 3, -3, 7, -1, 1000000000 };
+    rdaTest    rdaNormTest01 = { "Normal Test 01", rdaInArr,      11,    HM_DWN, true,   rdaNormExp01 };
+    // 3. HM_UP is ceil()
+    int        rdaNormExp02[]  = { 3, -2, 1, 0, 2, -1, 3, -3, 8, 0, 1000000001 };
+    rdaTest    rdaNormTest02 = { "Normal Test 02", rdaInArr,      11,    HM_UP,  true,   rdaNormExp02 };
+    // 4. The edges of an int
+    double     rdaInArr03[]    = { (double)INT_MAX, (double)INT_MIN, INT_MAX - 0.5, INT_MIN + 0.5 };
+    int        rdaNormExp03[]  = { INT_MAX, INT_MIN, INT_MAX, INT_MIN };
+    rdaTest    rdaNormTest03 = { "Normal Test 03", rdaInArr03,    4,     HM_RND, true,   rdaNormExp03 };
+    // Error Tests
+    // 1. Doubles that don't fit in an int, wherever they are in the array
+    double     rdaErrArr00[]   = { 1, 2, 3, 4, 5, 6, 7, 8, (double)INT_MAX + 1 };
+    rdaTest    rdaErrTest00 = { "Error Test 00",  rdaErrArr00,   9,     HM_RND, false,  NULL };
+    double     rdaErrArr01[]   = { (double)INT_MIN - 1, 1 };
+    rdaTest    rdaErrTest01 = { "Error Test 01",  rdaErrArr01,   2,     HM_DWN, false,  NULL };
+    double     rdaErrArr02[]   = { 1, INT_MAX + 0.5 };
+    rdaTest    rdaErrTest02 = { "Error Test 02",  rdaErrArr02,   2,     HM_UP,  false,  NULL };
+    double     rdaErrArr03[]   = { 1, NAN };
+    rdaTest    rdaErrTest03 = { "Error Test 03",  rdaErrArr03,   2,     HM_RND, false,  NULL };
+    // 2. Bad input
+    rdaTest    rdaErrTest04 = { "Error Test 04",  NULL,          1,     HM_RND, false,  NULL };
+    rdaTest    rdaErrTest05 = { "Error Test 05",  rdaInArr,      0,     HM_RND, false,  NULL };
+/******************************************************************************************************************************************/
+/***************************************************************** LEGEND *****************************************************************/
+/******************************************************************************************************************************************/
+
+    rdaTest_ptr rdaTest_arr[] = { \
+        &rdaNormTest00, &rdaNormTest01, &rdaNormTest02, &rdaNormTest03, \
+        &rdaErrTest00, &rdaErrTest01, &rdaErrTest02, &rdaErrTest03, &rdaErrTest04, \
+        &rdaErrTest05, NULL };
+
+    // RUN TESTS
+    rdaTestArr_ptr = rdaTest_arr;
+    fprintf(stdout, "\nROUND DOUBLE ARRAY UNIT TESTS\n");
+
+    while (*rdaTestArr_ptr)
+    {
+        rdaUnitTest = *rdaTestArr_ptr;
+
+        // EXECUTE TEST
+        fprintf(stdout, "%s\n\t", rdaUnitTest->testName);
+        rdaPassed = true;
+        memset(rdaResArr, 0x0, sizeof(rdaResArr));
+        numTestsRun++;
+
+        // 1. Verify return value
+        if (rdaUnitTest->expRet != round_dble_arr(rdaUnitTest->inArr, rdaResArr, rdaUnitTest->numIn, rdaUnitTest->rndDir))
+        {
+            fprintf(stdout, "[ ] FAIL    Expected:\t%s\n", (true == rdaUnitTest->expRet) ? "true" : "false");
+            rdaPassed = false;
+        }
+        // 2. Verify each result
+        else if (true == rdaUnitTest->expRet)
+        {
+            for (rdaIdx = 0; rdaIdx < rdaUnitTest->numIn; rdaIdx++)
+            {
+                if (rdaUnitTest->expArr[rdaIdx] != rdaResArr[rdaIdx])
+                {
+                    fprintf(stdout, "[ ] FAIL    Index %d mismatch\n\t\t", rdaIdx);
+                    fprintf(stdout, "Expected: %d\n\t\tReceived: %d\n", rdaUnitTest->expArr[rdaIdx], rdaResArr[rdaIdx]);
+                    rdaPassed = false;
+                    break;
+                }
+            }
+        }
+
+        // Determine pass/fail
+        if (true == rdaPassed)
+        {
+            fprintf(stdout, "[X] Success\n");
+            numTestsPassed++;
+        }
+
+        rdaTestArr_ptr++;
+    }
+
+    /***************************************************************************************************/
+    /******************************** DOUBLE COMPARE ARRAY UNIT TESTS **********************************/
+    /***************************************************************************************************/
+    // LOCAL VARIABLES
+    dcaTest_ptr dcaUnitTest = NULL;  // Current test being run
+    dcaTest_ptr* dcaTestArr_ptr = NULL;  // Current test array
+    dcaErrTest_ptr dcaErrUnitTest = NULL;  // Current error test being run
+    dcaErrTest_ptr* dcaErrTestArr_ptr = NULL;  // Current error test array
+    double dcaXArr[2 * (sizeof(nrmTest_arr) + sizeof(spcTest_arr)) / sizeof(fpcTest_ptr)] = { 0 };  // Every x and y above
+    double dcaYArr[sizeof(dcaXArr) / sizeof(*dcaXArr)] = { 0 };  // Every y and x above
+    bool dcaResArr[sizeof(dcaXArr) / sizeof(*dcaXArr)] = { 0 };  // Results from dble_compare_arr()
+    int dcaNumDbls = 0;  // Number of doubles in dcaXArr and dcaYArr
+    int dcaPrec = 0;  // Current precision
+    int dcaIdx = 0;  // Index into the arrays
+    bool dcaPassed = true;  // Make this false if anything fails
+
+    // Compare every floating point comparison pair above, both ways around
+    for (allTests = testArrays_arr; *allTests; allTests++)
+    {
+        for (currTestArr_ptr = *allTests; *currTestArr_ptr; currTestArr_ptr++)
+        {
+            dcaXArr[dcaNumDbls] = (*currTestArr_ptr)->xIn;
+            dcaYArr[dcaNumDbls++] = (*currTestArr_ptr)->yIn;
+            dcaXArr[dcaNumDbls] = (*currTestArr_ptr)->yIn;
+            dcaYArr[dcaNumDbls++] = (*currTestArr_ptr)->xIn;
+        }
+    }
+
+/******************************************************************************************************************************************/
+/***************************************************************** LEGEND *****************************************************************/
+/******************************************************************************************************************************************/
+/*  Data type   Var Name         Test Name         cmpType  scalarFunc                                                                    */
+/******************************************************************************************************************************************/
+    // Normal Tests
+    dcaTest     dcaNormTest00 = { "Normal Test 00", HM_GT,   dble_greater_than };
+    dcaTest     dcaNormTest01 = { "Normal Test 01", HM_LT,   dble_less_than };
+    dcaTest     dcaNormTest02 = { "Normal Test 02", HM_EQ,   dble_equal_to };
+    dcaTest     dcaNormTest03 = { "Normal Test 03", HM_NEQ,  dble_not_equal };
+    dcaTest     dcaNormTest04 = { "Normal Test 04", HM_GTE,  dble_greater_than_equal_to };
+    dcaTest     dcaNormTest05 = { "Normal Test 05", HM_LTE,  dble_less_than_equal_to };
+/******************************************************************************************************************************************/
+/*  Data type   Var Name         Test Name         xArr      resArr     numIn  precIn                cmpType  expRet                       */
+/******************************************************************************************************************************************/
+    // Error Tests
+    // 1. Invalid precision
+    dcaErrTest  dcaErrTest00 = { "Error Test 00",  dcaXArr,  dcaResArr, 1,     0,                    HM_EQ,   false };
+    dcaErrTest  dcaErrTest01 = { "Error Test 01",  dcaXArr,  dcaResArr, 1,     -1,                   HM_EQ,   false };
+    // 2. Invalid comparison type
+    dcaErrTest  dcaErrTest02 = { "Error Test 02",  dcaXArr,  dcaResArr, 1,     DBL_PRECISION,        0,       false };
+    dcaErrTest  dcaErrTest03 = { "Error Test 03",  dcaXArr,  dcaResArr, 1,     DBL_PRECISION,        HM_LTE + 1, false };
+    // 3. Bad input
+    dcaErrTest  dcaErrTest04 = { "Error Test 04",  NULL,     dcaResArr, 1,     DBL_PRECISION,        HM_EQ,   false };
+    dcaErrTest  dcaErrTest05 = { "Error Test 05",  dcaXArr,  NULL,      1,     DBL_PRECISION,        HM_EQ,   false };
+    dcaErrTest  dcaErrTest06 = { "Error Test 06",  dcaXArr,  dcaResArr, -1,    DBL_PRECISION,        HM_EQ,   false };
+    // 4. Valid edges
+    dcaErrTest  dcaErrTest07 = { "Error Test 07",  dcaXArr,  dcaResArr, 0,     DBL_PRECISION,        HM_EQ,   true };
+    dcaErrTest  dcaErrTest08 = { "Error Test 08",  dcaXArr,  dcaResArr, 1,     HM_MAX_PRECISION + 1, HM_EQ,   true };
+/******************************************************************************************************************************************/
+/***************************************************************** LEGEND *****************************************************************/
+/******************************************************************************************************************************************/
+
+    dcaTest_ptr dcaTest_arr[] = { \
+        &dcaNormTest00, &dcaNormTest01, &dcaNormTest02, &dcaNormTest03, &dcaNormTest04, \
+        &dcaNormTest05, NULL };
+
+    dcaErrTest_ptr dcaErrTest_arr[] = { \
+        &dcaErrTest00, &dcaErrTest01, &dcaErrTest02, &dcaErrTest03, &dcaErrTest04, \
+        &dcaErrTest05, &dcaErrTest06, &dcaErrTest07, &dcaErrTest08, NULL };
+
+    // RUN TESTS
+    fprintf(stdout, "\nDOUBLE COMPARE ARRAY UNIT TESTS\n");
+
+    // Every result must match the single comparison function, at every precision
+    for (dcaTestArr_ptr = dcaTest_arr; *dcaTestArr_ptr; dcaTestArr_ptr++)
+    {
+        dcaUnitTest = *dcaTestArr_ptr;
+
+        // EXECUTE TEST
+        fprintf(stdout, "%s\n\t", dcaUnitTest->testName);
+        dcaPassed = true;
+        numTestsRun++;
+
+        for (dcaPrec = 1; dcaPrec <= HM_MAX_PRECISION && true == dcaPassed; dcaPrec++)
+        {
+            memset(dcaResArr, 0x0, sizeof(dcaResArr));
+
+            if (false == dble_compare_arr(dcaXArr, dcaYArr, dcaResArr, dcaNumDbls, dcaPrec, dcaUnitTest->cmpType))
+            {
+                fprintf(stdout, "[ ] FAIL    dble_compare_arr() failed at precision %d\n", dcaPrec);
+                dcaPassed = false;
+                break;
+            }
+
+            for (dcaIdx = 0; dcaIdx < dcaNumDbls; dcaIdx++)
+            {
+                if (dcaResArr[dcaIdx] != dcaUnitTest->scalarFunc(dcaXArr[dcaIdx], dcaYArr[dcaIdx], dcaPrec))
+                {
+                    fprintf(stdout, "[ ] FAIL    Mismatch at precision %d\n\t\t", dcaPrec);
+                    fprintf(stdout, "x: %.17g\n\t\ty: %.17g\n\t\tReceived: %s\n", dcaXArr[dcaIdx], dcaYArr[dcaIdx], \
+                            (true == dcaResArr[dcaIdx]) ? "true" : "false");
+                    dcaPassed = false;
+                    break;
+                }
+            }
+        }
+
+        // Determine pass/fail
+        if (true == dcaPassed)
+        {
+            fprintf(stdout, "[X] Success\n");
+            numTestsPassed++;
+        }
+    }
+
+    // Invalid input must fail
+    for (dcaErrTestArr_ptr = dcaErrTest_arr; *dcaErrTestArr_ptr; dcaErrTestArr_ptr++)
+    {
+        dcaErrUnitTest = *dcaErrTestArr_ptr;
+
+        // EXECUTE TEST
+        fprintf(stdout, "%s\n\t", dcaErrUnitTest->testName);
+        numTestsRun++;
+
+        if (dcaErrUnitTest->expRet == dble_compare_arr(dcaErrUnitTest->xArr, dcaYArr, dcaErrUnitTest->resArr, \
+                                                       dcaErrUnitTest->numIn, dcaErrUnitTest->precIn, dcaErrUnitTest->cmpType))
+        {
+            fprintf(stdout, "[X] Success\n");
+            numTestsPassed++;
+        }
+        else
+        {
+            fprintf(stdout, "[ ] FAIL    Expected:\t%s\n", (true == dcaErrUnitTest->expRet) ? "true" : "false");
+        }
+    }
+
 	// REPORT RESULTS
 	fprintf(stdout, "\n\nTests Run:   \t%d\n", numTestsRun);
 	fprintf(stdout,     "Tests Passed:\t%d\n\n", numTestsPassed);
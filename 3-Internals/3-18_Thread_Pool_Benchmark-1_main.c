@@ -0,0 +1,406 @@
+/*
+ *	The purpose of this file is to compare running many small tasks on a thread each
+ *	(pthread_create() and pthread_join() per task) against a hThrPool, and to check
+ *	every result the pool hands back through futures and callbacks.
+ *
+ *	Usage: thread_pool_benchmark.exe [number of tasks (default 20000)]
+ */
+
+#include "Harklerror.h"							// HARKLE_ERROR
+#include "Harklethread.h"						// create_a_hThrPool(), submit_hThrTask(), wait_hThrFuture()
+#include <pthread.h>							// pthread_create(), pthread_join()
+#include <stdbool.h>							// bool, true, false
+#include <stdint.h>								// uintptr_t
+#include <stdio.h>								// fprintf()
+#include <stdlib.h>								// calloc(), strtoul()
+#include <time.h>								// clock_gettime()
+
+#define TP_DEFAULT_TASKS 20000					// Default number of tasks per run
+#define TP_TASK_WORK 2000						// Loop iterations per task
+#define TP_SPLIT_DEPTH 6						// Levels of subtasks submitted from inside the pool
+
+
+// Everything a split_task() needs to find its pool and report its total
+typedef struct threadPoolSplitJob
+{
+	hThrPool_ptr pool_ptr;		// Pool the subtasks go to
+	uintptr_t total;			// Sum of every leaf's result (atomic)
+	bool success;				// Made false if a submit fails
+} tpSplitJob, *tpSplitJob_ptr;
+
+// One split_task(): a level and the job it belongs to
+typedef struct threadPoolSplitTask
+{
+	tpSplitJob_ptr job_ptr;		// Shared job
+	uintptr_t taskNum;			// Passed to small_task() at the leaves
+	int depth;					// Levels of subtasks left to submit
+} tpSplitTask, *tpSplitTask_ptr;
+
+
+/*
+	Purpose - A small, deterministic unit of work
+	Input - taskArg - The task's number
+	Output - A value that only depends on the task's number
+ */
+void* small_task(void* taskArg)
+{
+	// LOCAL VARIABLES
+	uintptr_t taskNum = (uintptr_t)taskArg;  // Task number
+	uintptr_t retVal = taskNum;  // Running value
+	int i = 0;  // Iterating variable
+
+	for (i = 0; i < TP_TASK_WORK; i++)
+	{
+		retVal = (retVal * 31) + (i ^ taskNum);
+	}
+
+	// DONE
+	return (void*)retVal;
+}
+
+
+/*
+	Purpose - pthread_create() wrapper around small_task()
+ */
+void* small_thread(void* taskArg)
+{
+	return small_task(taskArg);
+}
+
+
+/*
+	Purpose - submit_hThrTask() callback that adds a result to a running total
+ */
+void add_result(void* result, void* userData)
+{
+	__atomic_add_fetch((uintptr_t*)userData, (uintptr_t)result, __ATOMIC_RELAXED);
+}
+
+
+/*
+	Purpose - Submit two copies of itself, one level down, from inside the pool.
+		The leaves run small_task() and add their result to the job's total.
+ */
+void* split_task(void* taskArg)
+{
+	// LOCAL VARIABLES
+	tpSplitTask_ptr task_ptr = (tpSplitTask_ptr)taskArg;  // This level
+	tpSplitTask_ptr child_ptr = NULL;  // Next level
+	int i = 0;  // Iterating variable
+
+	if (0 == task_ptr->depth)
+	{
+		add_result(small_task((void*)task_ptr->taskNum), &(task_ptr->job_ptr->total));
+	}
+	else
+	{
+		for (i = 0; i < 2; i++)
+		{
+			child_ptr = calloc(1, sizeof(tpSplitTask));
+
+			if (!child_ptr)
+			{
+				task_ptr->job_ptr->success = false;
+				break;
+			}
+			child_ptr->job_ptr = task_ptr->job_ptr;
+			child_ptr->taskNum = (task_ptr->taskNum * 2) + i;
+			child_ptr->depth = task_ptr->depth - 1;
+
+			if (submit_hThrTask(task_ptr->job_ptr->pool_ptr, split_task, child_ptr, NULL, NULL, NULL))
+			{
+				task_ptr->job_ptr->success = false;
+				free(child_ptr);
+				break;
+			}
+		}
+	}
+
+	// DONE
+	free(task_ptr);
+	return NULL;
+}
+
+
+/*
+	Purpose - Monotonic time in seconds
+ */
+double get_seconds(void)
+{
+	struct timespec now = { 0 };
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + (now.tv_nsec / 1e9);
+}
+
+
+/*
+	Purpose - Run numTasks small_task()s on a thread each, a batch at a time
+	Output - Seconds taken, or -1 on failure (to include a wrong result)
+ */
+double time_threads(size_t numTasks, uintptr_t* expected_arr)
+{
+	// LOCAL VARIABLES
+	double retVal = get_seconds();
+	pthread_t thread_arr[64];  // One batch of threads
+	void* result = NULL;  // Return value from a thread
+	size_t numBatch = 0;  // Threads in the current batch
+	size_t i = 0;  // Iterating variable
+	size_t j = 0;  // Iterating variable
+	bool success = true;  // Make this false if anything fails
+
+	for (i = 0; i < numTasks && true == success; i += numBatch)
+	{
+		for (numBatch = 0; numBatch < 64 && i + numBatch < numTasks; numBatch++)
+		{
+			if (pthread_create(thread_arr + numBatch, NULL, small_thread, (void*)(i + numBatch)))
+			{
+				HARKLE_ERROR(thread_pool_benchmark, time_threads, pthread_create failed);
+				success = false;
+				break;
+			}
+		}
+
+		for (j = 0; j < numBatch; j++)
+		{
+			pthread_join(thread_arr[j], &result);
+
+			if ((uintptr_t)result != expected_arr[i + j])
+			{
+				HARKLE_ERROR(thread_pool_benchmark, time_threads, Wrong result);
+				success = false;
+			}
+		}
+	}
+
+	// DONE
+	return true == success ? get_seconds() - retVal : -1;
+}
+
+
+/*
+	Purpose - Run numTasks small_task()s on a pool, collecting each result with a future
+	Output - Seconds taken, or -1 on failure (to include a wrong result)
+ */
+double time_pool_futures(hThrPool_ptr pool_ptr, size_t numTasks, hThrFuture_ptr* future_arr, uintptr_t* expected_arr)
+{
+	// LOCAL VARIABLES
+	double retVal = get_seconds();
+	size_t i = 0;  // Iterating variable
+	bool success = true;  // Make this false if anything fails
+
+	for (i = 0; i < numTasks; i++)
+	{
+		if (submit_hThrTask(pool_ptr, small_task, (void*)i, NULL, NULL, future_arr[i]))
+		{
+			HARKLE_ERROR(thread_pool_benchmark, time_pool_futures, submit_hThrTask failed);
+			success = false;
+			break;
+		}
+	}
+
+	// Wait for everything that was submitted
+	numTasks = i;
+
+	for (i = 0; i < numTasks; i++)
+	{
+		if ((uintptr_t)wait_hThrFuture(future_arr[i]) != expected_arr[i])
+		{
+			HARKLE_ERROR(thread_pool_benchmark, time_pool_futures, Wrong result);
+			success = false;
+		}
+	}
+
+	// DONE
+	return true == success ? get_seconds() - retVal : -1;
+}
+
+
+/*
+	Purpose - Run numTasks small_task()s on a pool, adding up the results with a callback
+	Output - Seconds taken, or -1 on failure (to include a wrong total)
+ */
+double time_pool_callbacks(hThrPool_ptr pool_ptr, size_t numTasks, uintptr_t expectedTotal)
+{
+	// LOCAL VARIABLES
+	double retVal = get_seconds();
+	uintptr_t total = 0;  // Sum of every result (atomic)
+	size_t i = 0;  // Iterating variable
+	bool success = true;  // Make this false if anything fails
+
+	for (i = 0; i < numTasks; i++)
+	{
+		if (submit_hThrTask(pool_ptr, small_task, (void*)i, add_result, &total, NULL))
+		{
+			HARKLE_ERROR(thread_pool_benchmark, time_pool_callbacks, submit_hThrTask failed);
+			success = false;
+			break;
+		}
+	}
+
+	if (wait_hThrPool(pool_ptr) || total != expectedTotal)
+	{
+		HARKLE_ERROR(thread_pool_benchmark, time_pool_callbacks, Wrong total);
+		success = false;
+	}
+
+	// DONE
+	return true == success ? get_seconds() - retVal : -1;
+}
+
+
+/*
+	Purpose - Split one task into 2 ** TP_SPLIT_DEPTH leaves, per root, from inside the pool
+	Output - Seconds taken, or -1 on failure (to include a wrong total)
+ */
+double time_pool_split(hThrPool_ptr pool_ptr, size_t numRoots)
+{
+	// LOCAL VARIABLES
+	double retVal = get_seconds();
+	tpSplitJob job = { pool_ptr, 0, true };  // Shared by every split_task()
+	tpSplitTask_ptr root_ptr = NULL;  // One root task
+	uintptr_t expectedTotal = 0;  // Sum of every leaf's result
+	size_t numLeaves = numRoots << TP_SPLIT_DEPTH;  // Number of leaves
+	size_t i = 0;  // Iterating variable
+
+	for (i = 0; i < numRoots && true == job.success; i++)
+	{
+		root_ptr = calloc(1, sizeof(tpSplitTask));
+
+		if (!root_ptr)
+		{
+			job.success = false;
+			break;
+		}
+		root_ptr->job_ptr = &job;
+		root_ptr->taskNum = i;
+		root_ptr->depth = TP_SPLIT_DEPTH;
+
+		if (submit_hThrTask(pool_ptr, split_task, root_ptr, NULL, NULL, NULL))
+		{
+			job.success = false;
+			free(root_ptr);
+		}
+	}
+
+	// Subtasks count as pending as soon as they're submitted, so this waits for every level
+	wait_hThrPool(pool_ptr);
+	retVal = get_seconds() - retVal;
+
+	for (i = 0; i < numLeaves; i++)
+	{
+		expectedTotal += (uintptr_t)small_task((void*)i);
+	}
+
+	if (false == job.success || job.total != expectedTotal)
+	{
+		HARKLE_ERROR(thread_pool_benchmark, time_pool_split, Wrong total);
+		retVal = -1;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+int main(int argc, char* argv[])
+{
+	// LOCAL VARIABLES
+	size_t numTasks = TP_DEFAULT_TASKS;  // Tasks per run
+	uintptr_t* expected_arr = NULL;  // small_task()'s result for each task number
+	uintptr_t expectedTotal = 0;  // Sum of expected_arr
+	hThrFuture_ptr* future_arr = NULL;  // One future per task
+	hThrPool_ptr pool_ptr = NULL;  // One worker per CPU
+	hThrPool_ptr pinned_ptr = NULL;  // One pinned worker per CPU
+	double threadTime = 0;  // Seconds spent on a thread per task
+	double futureTime = 0;  // Seconds spent on the pool, with futures
+	double callbackTime = 0;  // Seconds spent on the pool, with callbacks
+	double pinnedTime = 0;  // Seconds spent on the pinned pool, with futures
+	double splitTime = 0;  // Seconds spent splitting tasks inside the pool
+	size_t i = 0;  // Iterating variable
+	bool success = true;  // Make this false if anything fails
+
+	// INPUT VALIDATION
+	if (argc > 1)
+	{
+		numTasks = strtoul(argv[1], NULL, 10);
+
+		if (numTasks < 1)
+		{
+			HARKLE_ERROR(thread_pool_benchmark, main, Invalid number of tasks);
+			return 1;
+		}
+	}
+
+	// SETUP
+	expected_arr = calloc(numTasks, sizeof(uintptr_t));
+	future_arr = calloc(numTasks, sizeof(hThrFuture_ptr));
+	pool_ptr = create_a_hThrPool(0, false);
+	pinned_ptr = create_a_hThrPool(0, true);
+
+	if (!expected_arr || !future_arr || !pool_ptr || !pinned_ptr)
+	{
+		HARKLE_ERROR(thread_pool_benchmark, main, Setup failed);
+		success = false;
+	}
+
+	for (i = 0; i < numTasks && true == success; i++)
+	{
+		expected_arr[i] = (uintptr_t)small_task((void*)i);
+		expectedTotal += expected_arr[i];
+		future_arr[i] = create_a_hThrFuture();
+
+		if (!future_arr[i])
+		{
+			HARKLE_ERROR(thread_pool_benchmark, main, create_a_hThrFuture failed);
+			success = false;
+		}
+	}
+
+	// RUN
+	if (true == success)
+	{
+		threadTime = time_threads(numTasks, expected_arr);
+		futureTime = time_pool_futures(pool_ptr, numTasks, future_arr, expected_arr);
+		callbackTime = time_pool_callbacks(pool_ptr, numTasks, expectedTotal);
+		// The futures were reset by wait_hThrFuture(), so they can be reused
+		pinnedTime = time_pool_futures(pinned_ptr, numTasks, future_arr, expected_arr);
+		splitTime = time_pool_split(pool_ptr, (numTasks >> TP_SPLIT_DEPTH) + 1);
+
+		if (threadTime < 0 || futureTime < 0 || callbackTime < 0 || pinnedTime < 0 || splitTime < 0)
+		{
+			success = false;
+		}
+		else
+		{
+			fprintf(stdout, "Tasks: %zu\tWorkers: %d\n", numTasks, pool_ptr->numWorkers);
+			fprintf(stdout, "%-20s %-12s %-8s\n", "Runner", "Seconds", "Speedup");
+			fprintf(stdout, "%-20s %-12.4f %-8s\n", "Thread per task", threadTime, "1.0x");
+			fprintf(stdout, "%-20s %-12.4f %.1fx\n", "Pool (futures)", futureTime, threadTime / futureTime);
+			fprintf(stdout, "%-20s %-12.4f %.1fx\n", "Pool (callbacks)", callbackTime, threadTime / callbackTime);
+			fprintf(stdout, "%-20s %-12.4f %.1fx\n", "Pinned pool", pinnedTime, threadTime / pinnedTime);
+			fprintf(stdout, "%-20s %-12.4f\n", "Pool (split tasks)", splitTime);
+		}
+	}
+
+	// CLEAN UP
+	if (pool_ptr)
+	{
+		free_a_hThrPool(&pool_ptr);
+	}
+	if (pinned_ptr)
+	{
+		free_a_hThrPool(&pinned_ptr);
+	}
+	for (i = 0; future_arr && i < numTasks; i++)
+	{
+		if (future_arr[i])
+		{
+			free_a_hThrFuture(future_arr + i);
+		}
+	}
+	free(future_arr);
+	free(expected_arr);
+
+	// DONE
+	return true == success ? 0 : 1;
+}
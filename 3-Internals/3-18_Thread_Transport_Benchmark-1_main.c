@@ -0,0 +1,173 @@
+/*
+ *	The purpose of this file is to compare how many messages per second a thread can
+ *	send the main thread over each Harklethread transport: the original pipe (write()
+ *	under pipeMutex, read through a harklePipeReader) and the lock-free hThrRing.
+ *
+ *	Usage: thread_transport_benchmark.exe [number of messages (default 2000000)]
+ */
+
+#include <errno.h>								// EAGAIN
+#include "Harklerror.h"							// HARKLE_ERROR
+#include "Harklethread.h"						// create_a_hThrDetails_ptr(), send_harklethread()
+#include <sched.h>								// sched_yield()
+#include <stdbool.h>							// bool, true, false
+#include <stdio.h>								// fprintf()
+#include <stdlib.h>								// strtoul()
+#include <time.h>								// clock_gettime()
+#include <unistd.h>								// close()
+
+#define TT_DEFAULT_MESSAGES 2000000				// Default number of messages per transport
+
+
+/*
+	Purpose - Producer thread: send tArgSize messages, 1 through tArgSize, then stop
+ */
+void* send_messages(hThrDetails_ptr self)
+{
+	// LOCAL VARIABLES
+	uint64_t message = 0;  // Current message
+	int errNum = 0;  // Return value from send_harklethread()
+
+	for (message = 1; message <= self->tArgSize; message++)
+	{
+		while (EAGAIN == (errNum = send_harklethread(self, message)))
+		{
+			sched_yield();
+		}
+
+		if (errNum)
+		{
+			HARKLE_ERROR(thread_transport_benchmark, send_messages, send_harklethread failed);
+			break;
+		}
+	}
+
+	// DONE
+	return NULL;
+}
+
+
+/*
+	Purpose - Monotonic time in seconds
+ */
+double get_seconds(void)
+{
+	struct timespec now = { 0 };
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + (now.tv_nsec / 1e9);
+}
+
+
+/*
+	Purpose - Time numMessages sent over one transport
+	Output - Seconds taken, or -1 on failure (to include out of order messages)
+ */
+double time_transport(int transport, size_t numMessages)
+{
+	// LOCAL VARIABLES
+	double retVal = -1;
+	hThrDetails_ptr producer = NULL;  // Producer thread's details
+	uint64_t message = 0;  // Received message
+	uint64_t expected = 1;  // Next message that should arrive
+	int errNum = 0;  // Return value from receive_harklethread()
+	double startTime = 0;  // Timer
+
+	// SETUP
+	producer = create_a_hThrDetails_ptr(NULL, 1, (void*)send_messages, NULL, 0, transport);
+
+	if (!producer)
+	{
+		HARKLE_ERROR(thread_transport_benchmark, time_transport, create_a_hThrDetails_ptr failed);
+		return retVal;
+	}
+
+	// Make this thread self-aware
+	producer->tArgvString = producer;
+	producer->tArgSize = numMessages;
+
+	// RUN
+	startTime = get_seconds();
+
+	if (0 == spawn_harklethread(producer))
+	{
+		while (expected <= numMessages)
+		{
+			errNum = receive_harklethread(producer, &message);
+
+			if (EAGAIN == errNum)
+			{
+				sched_yield();
+			}
+			else if (errNum || message != expected)
+			{
+				HARKLE_ERROR(thread_transport_benchmark, time_transport, Unexpected message);
+				break;
+			}
+			else
+			{
+				expected++;
+			}
+		}
+
+		if (expected > numMessages)
+		{
+			retVal = get_seconds() - startTime;
+		}
+		pthread_join(producer->threadID, NULL);
+	}
+	else
+	{
+		HARKLE_ERROR(thread_transport_benchmark, time_transport, spawn_harklethread failed);
+	}
+
+	// CLEAN UP
+	if (HTHR_TRANSPORT_PIPE == transport)
+	{
+		close(producer->pipeFDs[HPIPE_READ]);
+		close(producer->pipeFDs[HPIPE_WRITE]);
+	}
+	free_a_hThrDetails_ptr(&producer);
+
+	// DONE
+	return retVal;
+}
+
+
+int main(int argc, char* argv[])
+{
+	// LOCAL VARIABLES
+	size_t numMessages = TT_DEFAULT_MESSAGES;  // Messages per transport
+	double pipeTime = 0;  // Seconds spent on HTHR_TRANSPORT_PIPE
+	double ringTime = 0;  // Seconds spent on HTHR_TRANSPORT_RING
+
+	// INPUT VALIDATION
+	if (argc > 1)
+	{
+		numMessages = strtoul(argv[1], NULL, 10);
+
+		if (numMessages < 1)
+		{
+			HARKLE_ERROR(thread_transport_benchmark, main, Invalid number of messages);
+			return 1;
+		}
+	}
+
+	// RUN
+	pipeTime = time_transport(HTHR_TRANSPORT_PIPE, numMessages);
+	ringTime = time_transport(HTHR_TRANSPORT_RING, numMessages);
+
+	if (pipeTime <= 0 || ringTime <= 0)
+	{
+		HARKLE_ERROR(thread_transport_benchmark, main, time_transport failed);
+		return 1;
+	}
+
+	fprintf(stdout, "Messages: %zu\n", numMessages);
+	fprintf(stdout, "%-10s %-12s %-14s\n", "Transport", "Seconds", "Messages/sec");
+	fprintf(stdout, "%-10s %-12.4f %-14.0f\n", "Pipe", pipeTime, numMessages / pipeTime);
+	fprintf(stdout, "%-10s %-12.4f %-14.0f\n", "Ring", ringTime, numMessages / ringTime);
+	fprintf(stdout, "Speedup: %.1fx\n", pipeTime / ringTime);
+
+	// DONE
+	return 0;
+}
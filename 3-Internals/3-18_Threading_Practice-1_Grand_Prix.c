@@ -97,10 +97,10 @@ IDEAS
 
 #include <errno.h>
 #include "Harklecurse.h"		// kill_a_window()
-#include "Harklepipe.h"			// read_a_pipe()
+#include "Harklepipe.h"			// read_pipe_message()
 #include "Harklemath.h"			// determine_center(), NUM_PRIMES_ULLONG
 #include "Harklerror.h"			// HARKLE_ERROR()
-#include "Harklethread.h"
+#include "Harklethread.h"		// send_harklethread(), receive_harklethread(), HTHR_TRANSPORT_RING
 #include <limits.h>				// ULLONG_MAX
 #include <math.h>				// sqrt()
 #include "Memoroad.h"
@@ -112,6 +112,7 @@ IDEAS
 #include <stdint.h>				// intptr_t
 #include <stdio.h>				// printf
 #include <stdlib.h>				// calloc()
+#include <sched.h>				// sched_yield()
 #include <sys/syscall.h>		// syscall
 #include <sys/types.h>
 #include "Thread_Racer.h"
@@ -129,12 +130,25 @@ IDEAS
 #endif // GRAND_PRIX_MAX_TRIES
 
 #define SIG_START SIGUSR1	// This signal will start the threads racing
-#define SLEEPY_OFFICIALS 0	// Number of seconds for the main thread to sleep each evaluation
+#define OFFICIALS_TIMEOUT_MS 250	// Longest the main thread waits for racer updates before redrawing
+#define OFFICIALS_IDLE_US 1000	// Microseconds the main thread naps when no racer ring had an update
+
+#ifndef RACE_TRANSPORT
+// MACRO to choose how the racers report to the main thread (see: Harklethread.h)
+// Build with -DRACE_TRANSPORT=0 (HTHR_TRANSPORT_PIPE) to race over the epoll pipe loop instead
+#define RACE_TRANSPORT HTHR_TRANSPORT_RING
+#endif  // RACE_TRANSPORT
+
+#ifndef RACE_MAX_FPS
+// MACRO to cap how often the main thread redraws the race, 0 for no cap
+#define RACE_MAX_FPS 30
+#endif  // RACE_MAX_FPS
 #define SLEEPY_RACER 0  	// Number of seconds for racer_sleepy_func() to sleep
 #define FAST_RACER 10000	// Multiple to increase the number of calculations, minimum 1
 #define SLEEPY_BUFF 20  	// Local buffer size
 
 // bool startTheRace = false;  // Global variable for the signal handler to set
+bool raceOver = false;  // Set (atomically) by the main thread once the race ends so the racers stop
 
 
 /*
@@ -196,6 +210,47 @@ void racer_sleepy_func(tgpRacer_ptr threadDets);
 void racer_rando_prime(tgpRacer_ptr threadDets);
 
 
+/*
+	PURPOSE - Apply one position update to a racer's tgpRacer struct
+	INPUT
+		racer_ptr - tgpRacer struct pointer to update
+		newPos - Track position the racer reported
+	OUTPUT
+		true to keep reading, false once the racer has won
+ */
+bool advance_racer(tgpRacer_ptr racer_ptr, int newPos);
+
+
+/*
+	PURPOSE - Apply one racer's pipe update to its tgpRacer struct
+	INPUT
+		pipeRead - One newline-stripped message from the racer's pipe
+		msgLen - Length of pipeRead
+		userData - The tgpRacer struct pointer that owns the pipe
+	OUTPUT
+		true to keep reading, false once the racer has won
+	NOTES
+		This is the hpMessageCallback given to watch_harklethread()
+			when RACE_TRANSPORT is HTHR_TRANSPORT_PIPE
+ */
+bool read_racer_update(char* pipeRead, size_t msgLen, void* userData);
+
+
+/*
+	PURPOSE - Apply every update waiting in the racers' rings
+	INPUT
+		racerArr_ptr - Array of tgpRacer struct pointers
+		numRacers - Number of racers in racerArr_ptr
+	OUTPUT
+		On success, 0
+		On failure, errno (ECANCELED once a racer has won)
+	NOTES
+		Naps for OFFICIALS_IDLE_US if no ring had an update
+		Used when RACE_TRANSPORT is HTHR_TRANSPORT_RING
+ */
+int read_racer_rings(tgpRacer_ptr* racerArr_ptr, int numRacers);
+
+
 // void starting_gun(int shot)
 // {
 // 	if (shot == SIG_START)
@@ -220,17 +275,18 @@ int main(int argc, char** argv)
 
 	// Main thread
 	int retVal = 0;  // Function's return value, also holds ncurses return values
-	int errNum = 0;  // Holds errno returned from read_a_pipe()
 	bool foundWinner = false;  // Update to true if any thread wins
 	bool success = true;  // Make this false if anything fails
 	winDetails_ptr stdWin = NULL;  // hCurseWinDetails struct pointer for the stdscr window
 	winDetails_ptr trackWin = NULL;  // hCurseWinDetails struct pointer for the track window
 	winDetails_ptr rankBarWin = NULL;  // hCurseWinDetails struct pointer for the rank bar window
+	hcFrameTimer_ptr raceClock = NULL;  // Caps and times the race's frames
+	WINDOW* raceWin_arr[3] = { NULL };  // NULL-terminated array of windows presented each frame
 	int numCols = 0;  // Number of columns available
 	int numRows = 0;  // Number of rows available
 	int i = 0;  // Iterating variable
-	int j = 0;  // Iterating variable
 	int numTries = 0;  // Counter for memory allocation function calls
+	int numStarted = 0;  // Number of racer threads actually started
 	int tmpInt = 0;  // Holds various return values
 	struct sigaction sigact;  // Used to specify actions for specific signals
 	
@@ -238,7 +294,8 @@ int main(int argc, char** argv)
 	tgpRacer_ptr* racerArr_ptr = NULL;  // Array of racer struct pointers
 	tgpRacer_ptr racer_ptr = NULL;  // Index from the array of racer struct pointers
 	hThrDetails_ptr tmpMember = NULL;  // Temp variable to hold the F1Details during creation
-	char* pipeReads = NULL;  // Returned values from read_a_pipe() calls
+	hpLoop_ptr raceControl = NULL;  // Reads the racers' pipes as updates arrive
+	tgpRanking_ptr raceRanking = NULL;  // Racers in ranking order, updated as they report in
 	char* racerNames[] = {
 		"L. Torvalds", "H. Sweeten", "G. Uytterhoeven", "A. Bergmann", "A. Viro", "T. Iwai", \
 		"L. Clausen", "M. Chehab", "V. Syrjala", "L. Walleij", "D. Carpenter", "Intel", \
@@ -246,7 +303,7 @@ int main(int argc, char** argv)
 	};
 	char* tmpRacerName = NULL;  // Temp racer name to assign
 	int tmpNameIndex = 0;  // Temp variable to hold a randomized index into racerNames
-	size_t numNames = sizeof(racerNames) / sizeof(*racerNames);  // Dimension of racerNames
+	int numNames = sizeof(racerNames) / sizeof(*racerNames);  // Names left to draw from racerNames
 	int highLap = 0;  // Current lap of the front runner
 
 	// Race Track
@@ -262,6 +319,12 @@ int main(int argc, char** argv)
 	hcCartCoord_ptr tmpNode = NULL;  // Holds the return value from function calls
 	
 	// INPUT VALIDATION
+	// Optionally, the number of racers (e.g., thousands, to stress the race engine)
+	if (argc > 1)
+	{
+		numF1s = atoi(argv[1]);
+	}
+
 	if (numF1s < 1)
 	{
 		HARKLE_ERROR(Grand_Prix, main, Invalid parameter);
@@ -489,41 +552,28 @@ int main(int argc, char** argv)
 			for (i = 0; i < numF1s; i++)
 			{
 				// 2.0. Randomize a name for the racer
-				do
+				// Names are drawn without replacement from racerNames[0, numNames).  Once they
+				// run out, the remaining racers go unnamed and are ranked as "Thread #"
+				tmpRacerName = NULL;
+
+				if (numNames > 0)
 				{
 					tmpNameIndex = rando_me(0, numNames);
-					
-					if (tmpNameIndex < 0 || tmpNameIndex > numNames)
+
+					if (tmpNameIndex < 0 || tmpNameIndex >= numNames)
 					{
 						HARKLE_ERROR(Grand_Prix, main, rando_me failed);
 						success = false;
 						break;
 					}
-					else if (racerNames[tmpNameIndex])
-					{
-						tmpRacerName = racerNames[tmpNameIndex];
-					}
 					else
 					{
-						// Verify a name still exists in the list
-						for (j = 0; j < numNames; j++)
-						{
-							if (racerNames[j])
-							{
-								break;  // Found one	
-							}
-						}
-						// Did we find at least one left?
-						if (!(racerNames[j]))
-						{
-							// Apparently, we're out of names
-							break;
-						}
+						tmpRacerName = racerNames[tmpNameIndex];
 					}
-				} while (!tmpRacerName && true == success);
+				}
 				
 				// 2.1. Create struct data
-				tmpMember = create_a_hThrDetails_ptr(tmpRacerName, i + 1, (void*)racer_rando_prime, NULL, 0);
+				tmpMember = create_a_hThrDetails_ptr(tmpRacerName, i + 1, (void*)racer_rando_prime, NULL, 0, RACE_TRANSPORT);
 				// tmpMember = create_a_hThrDetails_ptr(NULL, i + 1, (void*)racer_rando_prime, NULL, 0);
 				// tmpMember = create_a_hThrDetails_ptr(NULL, i + 1, (void*)racer_sleepy_func, NULL, 0);
 				// tmpMember = create_a_hThrDetails_ptr(NULL, i + 1, (void*)racer_sleepy_func, (void*)numTrackPnts, sizeof(int));
@@ -538,10 +588,15 @@ int main(int argc, char** argv)
 				else
 				{
 					// Remove the name we chose so we don't reuse it
-					// fprintf(stdout, "Before: %s\n", racerNames[tmpNameIndex]);  // DEBUGGING
-					racerNames[tmpNameIndex] = NULL;
-					tmpRacerName = NULL;
-					// fprintf(stdout, "After:  %s\n", racerNames[tmpNameIndex]);  // DEBUGGING
+					if (tmpRacerName)
+					{
+						// fprintf(stdout, "Before: %s\n", racerNames[tmpNameIndex]);  // DEBUGGING
+						numNames--;
+						racerNames[tmpNameIndex] = racerNames[numNames];
+						racerNames[numNames] = NULL;
+						tmpRacerName = NULL;
+						// fprintf(stdout, "After:  %s\n", racerNames[tmpNameIndex]);  // DEBUGGING
+					}
 				}
 
 				// 2.1. Create a populated struct
@@ -600,7 +655,41 @@ int main(int argc, char** argv)
 		// }
 
 		// 1. Line Up The Cars
-		for (i = 0; i < numF1s; i++)
+		raceRanking = create_tgpRanking_ptr(racerArr_ptr);
+
+		if (!raceRanking)
+		{
+			HARKLE_ERROR(Grand_Prix, main, create_tgpRanking_ptr failed);
+			success = false;
+		}
+		else
+		{
+			raceClock = create_hcFrameTimer_ptr(RACE_MAX_FPS);
+
+			if (!raceClock)
+			{
+				HARKLE_ERROR(Grand_Prix, main, create_hcFrameTimer_ptr failed);
+				success = false;
+			}
+			else
+			{
+				raceWin_arr[0] = trackWin->win_ptr;
+				raceWin_arr[1] = rankBarWin->win_ptr;
+			}
+		}
+
+		if (true == success && HTHR_TRANSPORT_PIPE == RACE_TRANSPORT)
+		{
+			raceControl = create_pipe_loop();
+		}
+
+		if (true == success && HTHR_TRANSPORT_PIPE == RACE_TRANSPORT && !raceControl)
+		{
+			HARKLE_ERROR(Grand_Prix, main, create_pipe_loop failed);
+			success = false;
+		}
+
+		for (i = 0; true == success && i < numF1s; i++)
 		{
 			racer_ptr = racerArr_ptr[i];
 
@@ -612,6 +701,17 @@ int main(int argc, char** argv)
 				HARKLE_ERROR(Grand_Prix, main, spawn_harklethread failed);
 				fprintf(stderr, "spawn_harklethread() returned errno:\t%s\n", strerror(tmpInt));
 				success = false;
+				continue;
+			}
+			numStarted++;
+
+			// Put the car on race control's monitors
+			if (raceControl && (tmpInt = watch_harklethread(raceControl, racer_ptr->F1Details, '\n', \
+				                                  read_racer_update, racer_ptr)))
+			{
+				HARKLE_ERROR(Grand_Prix, main, watch_harklethread failed);
+				fprintf(stderr, "watch_harklethread() returned errno:\t%s\n", strerror(tmpInt));
+				success = false;
 			}
 			else
 			{
@@ -669,152 +769,39 @@ int main(int argc, char** argv)
 		// 3. RACE!
 		while (true == success)
 		{
-			// Give the threads a moment to execute
-			sleep(SLEEPY_OFFICIALS);
-
-			// Read what the thread has done so far
-			for (i = 0; i < numF1s; i++)
+			// Read whatever the threads have reported
+			if (HTHR_TRANSPORT_RING == RACE_TRANSPORT)
 			{
-				racer_ptr = racerArr_ptr[i];
-
-				// 1. Lock the mutex
-				tmpInt = pthread_mutex_lock(&(racer_ptr->F1Details->pipeMutex));
-
-				if (tmpInt)
-				{
-					HARKLE_ERROR(Grand_Prix, main, pthread_mutex_lock failed);
-					fprintf(stderr, "pthread_mutex_lock() returned errno:\t%s\n", strerror(tmpInt));
-					success = false;
-					break;
-				}
-				else
-				{
-					// 2. Read the pipe
-					do
-					{
-						// Free any previous reads
-						if (pipeReads)
-						{
-							if (false == release_a_string(&pipeReads))
-							{
-								HARKLE_ERROR(Grand_Prix, main, release_a_string failed);
-								success = false;
-								break;
-							}
-						}
-						// puts("ENTERING READ_A_PIPE()");  // DEBUGGING
-						//////////////////////////////// BUG ////////////////////////////////
-						// Second function call to pipe reads is hanging
-						// I now believe that read_a_pipe() is blocking on an empty socket.
-						//	With the mutex locked, it will hang forever.  Seems like I need
-						//	to include some functionality inside make_a_pipe() to utilize
-						//	fcntl() to set the pipe to "F_GETFL and F_SETFL plus O_NONBLOCK"
-						// see: https://stackoverflow.com/questions/13811614/c-how-to-see-if-a-pipe-is-empty
-						/////////////////////////////////////////////////////////////////////
-						pipeReads = read_a_pipe(racer_ptr->F1Details->pipeFDs[HPIPE_READ], '\n', &errNum);
-
-						if (!pipeReads || errNum)
-						{
-							// Apparently, a read from an empty pipe could return
-							//	EACCES, EAGAIN, or EWOULDBLOCK
-							if (errNum & (EACCES | EAGAIN | EWOULDBLOCK))
-							{
-								// fprintf(stdout, "Thread #%d's pipe responded '%s'", racer_ptr->F1Details->tNum, strerror(errNum));  // DEBUGGING
-								continue;
-							}
-							else
-							{
-								HARKLE_ERROR(Grand_Prix, main, read_a_pipe failed);
-								fprintf(stderr, "read_a_pipe() returned errno:\t%s\n", strerror(errNum));
-								success = false;
-								break;
-							}
-						}
-						else
-						{
-							// Remove the newline
-							// fprintf(stdout, "Before:\t%s\n", pipeReads);  // DEBUGGING
-							if (pipeReads[strlen(pipeReads - 1)] == '\n')
-							{
-								pipeReads[strlen(pipeReads - 1)] = 0;
-							}
-							// fprintf(stdout, "After: \t%s\n", pipeReads);  // DEBUGGING
-
-							// Convert the string to an integer
-							tmpInt = atoi(pipeReads);
-							// if (!tmpInt)
-							// {
-							// 	fprintf(stdout, "pipeReads (%s) just translated into %d.\n", pipeReads, tmpInt);  // DEBUGGING
-							// }
-							// fprintf(stderr, "pipeReads (%s) just translated into %d.\n", pipeReads, tmpInt);  // DEBUGGING
-
-							// Update the struct
-
-							// Ignore the starting positions
-							// if (racer_ptr->currPos >= tmpInt && tmpInt != 1)
-							// {
-							// 	fprintf(stderr, "pipeReads (%s) just translated into %d.\n", pipeReads, tmpInt);  // DEBUGGING
-							// 	HARKLE_ERROR(Grand_Prix, main, atoi (or the thread logic) failed);
-							// 	fprintf(stderr, "Thread Racer #%d was previously at %d but is now reading at position %d.\n", \
-							// 		    racer_ptr->F1Details->tNum, racer_ptr->currPos, tmpInt);  // DEBUGGING
-							// 	success = false;
-							// 	break;
-							// }
-							// else
-
-							if (1)
-							{
-								// fprintf(stdout, "Thread Racer #%d was previously at %d but is now reading at position %d.\n", \
-									    racer_ptr->F1Details->tNum, racer_ptr->currPos, tmpInt);  // DEBUGGING
-								// fprintf(stdout, "The track size is %d\n", numTrackPnts);  // DEBUGGING
-								// fprintf(stdout, "This racer is on lap %d of %d\n", racer_ptr->currLap, racer_ptr->numLaps);  // DEBUGGING
-								// if (racer_ptr->trackLen == racer_ptr->currPos)
-								// fprintf(stderr, "\n%d == %d && 1 == %d\n", racer_ptr->trackLen, racer_ptr->currPos, tmpInt);  // DEBUGGING
-								if (racer_ptr->trackLen == racer_ptr->currPos && 1 == tmpInt)
-								{
-									// fprintf(stdout, "Moving up a lap from %d to %d\n", racer_ptr->currLap, racer_ptr->currLap + 1);  // DEBUGGING
-									racer_ptr->currLap++;
-									tmpInt++;
-								}
-								racer_ptr->currPos = tmpInt;
-								// if (racer_ptr->currPos == racer_ptr->trackLen && racer_ptr->numLaps == racer_ptr->currLap || \
-								// 	racer_ptr->currPos == 1 && racer_ptr->numLaps <= racer_ptr->currLap)
-								if (racer_ptr->currPos == racer_ptr->trackLen && racer_ptr->numLaps == racer_ptr->currLap)
-								// if (racer_ptr->currPos == numTrackPnts / 2 && racer_ptr->numLaps == racer_ptr->currLap)
-								{
-									// fprintf(stdout, "This racer is on lap %d of %d\n", racer_ptr->currLap, racer_ptr->numLaps);  // DEBUGGING
-									foundWinner = true;
-									racer_ptr->winner = true;
-									// fprintf(stdout, "It appears that Thread #%d has won!\n", racer_ptr->F1Details->tNum);
-									break;
-								}
-							}
-						}
-					} while (pipeReads);
-
-					// 3. Unlock the mutex
-					tmpInt = pthread_mutex_unlock(&(racer_ptr->F1Details->pipeMutex));
+				tmpInt = read_racer_rings(racerArr_ptr, numF1s);
+			}
+			else
+			{
+				// Wait at most OFFICIALS_TIMEOUT_MS
+				tmpInt = run_pipe_loop(raceControl, OFFICIALS_TIMEOUT_MS, NULL);
+			}
 
-					if (tmpInt)
-					{
-						HARKLE_ERROR(Grand_Prix, main, pthread_mutex_unlock failed);
-						fprintf(stderr, "pthread_mutex_unlock() returned errno:\t%s\n", strerror(tmpInt));
-						success = false;
-						break;
-					}
-				}
+			if (ECANCELED == tmpInt)
+			{
+				// advance_racer() saw a racer finish
+				foundWinner = true;
 			}
-			
-			// Determine current lap
-			highLap = highest_lap(racerArr_ptr);
-			
-			if (-1 == highLap)
+			else if (tmpInt)
 			{
-				HARKLE_ERROR(Grand_Prix, main, highest_lap failed);
+				HARKLE_ERROR(Grand_Prix, main, reading racer updates failed);
+				fprintf(stderr, "Reading racer updates returned errno:\t%s\n", strerror(tmpInt));
 				success = false;
 				break;
 			}
 
+			// Keep reading until the next frame is due
+			if (false == foundWinner && false == frame_is_due(raceClock))
+			{
+				continue;
+			}
+			
+			// Determine current lap
+			highLap = raceRanking->rank_arr[0]->currLap;
+
 			// Update race details
 			if (false == update_all_racer_pos(racerArr_ptr, trkHeadNode, highLap))
 			{
@@ -833,14 +820,14 @@ int main(int argc, char** argv)
 
 			// UDPATE THE WINDOWS
 			// Update the trackWin
-			if (false == print_plot_list(trackWin->win_ptr, trkHeadNode))
+			if (false == print_plot_changes(trackWin->win_ptr, trkHeadNode))
 			{
-				HARKLE_ERROR(Grand_Prix, main, print_plot_list failed);
+				HARKLE_ERROR(Grand_Prix, main, print_plot_changes failed);
 				success = false;
 				break;
 			}
 			// Update the rankWin
-			if (false == update_ranking_win(rankBarWin, racerArr_ptr))
+			if (false == update_ranking_win(rankBarWin, raceRanking))
 			{
 				HARKLE_ERROR(Grand_Prix, main, print_plot_list failed);
 				success = false;
@@ -848,17 +835,10 @@ int main(int argc, char** argv)
 			}
 			
 			// PRINT THE WINDOWS
-			// Print the trackWin
-			if (OK != wrefresh(trackWin->win_ptr))  // Print it on the real screen
+			// Print the trackWin and rankWin in one terminal update
+			if (OK != present_frame(raceClock, raceWin_arr))
 			{
-				HARKLE_ERROR(Grand_Prix, main, wrefresh failed on trackWin);
-				success = false;
-				break;
-			}
-			// Print the rankWin
-			if (OK != wrefresh(rankBarWin->win_ptr))
-			{
-				HARKLE_ERROR(Grand_Prix, main, wrefresh failed on rankBar);
+				HARKLE_ERROR(Grand_Prix, main, present_frame failed);
 				success = false;
 				break;
 			}
@@ -872,6 +852,21 @@ int main(int argc, char** argv)
 		}
 	}
 	
+	// STOP THE RACERS
+	// Nobody reads their updates from here on, so they have to stop before their details are freed
+	__atomic_store_n(&raceOver, true, __ATOMIC_RELEASE);
+
+	for (i = 0; i < numStarted; i++)
+	{
+		tmpInt = pthread_join(racerArr_ptr[i]->F1Details->threadID, NULL);
+
+		if (tmpInt)
+		{
+			HARKLE_ERROR(Grand_Prix, main, pthread_join failed);
+			HARKLE_ERRNO(Grand_Prix, pthread_join, tmpInt);
+		}
+	}
+
 	// END THE RACE
 	if (true == success)
 		{
@@ -883,10 +878,16 @@ int main(int argc, char** argv)
 			HARKLE_ERROR(Grand_Prix.c, main, mvwaddstr failed);
 			success = false;
 		}
+		// Print the frame timer
+		else if (raceClock->numFrames > 0)
+		{
+			mvwprintw(stdWin->win_ptr, 2, 1, "%lu frames, %.3f ms average frame", \
+			          raceClock->numFrames, raceClock->totalFrameNs / 1e6 / raceClock->numFrames);
+		}
 		getch();  // Wait for the user to press a key
 		clear();  // Clear the screen
 		// Print race results page
-		if (false == update_results_win(stdWin, racerArr_ptr))
+		if (false == update_results_win(stdWin, raceRanking))
 		{
 			HARKLE_ERROR(Grand_Prix.c, main, update_results_win failed);
 			success = false;
@@ -959,6 +960,22 @@ int main(int argc, char** argv)
 
 	// Allocation
 	// 5. Free the racers
+	if (raceClock)
+	{
+		if (false == free_hcFrameTimer_ptr(&raceClock))
+		{
+			HARKLE_ERROR(Grand_Prix, main, free_hcFrameTimer_ptr failed);
+		}
+	}
+
+	if (raceRanking)
+	{
+		if (false == free_tgpRanking_ptr(&raceRanking))
+		{
+			HARKLE_ERROR(Grand_Prix, main, free_tgpRanking_ptr failed);
+		}
+	}
+
 	if (racerArr_ptr)
 	{
 		for (i = 0; i < numF1s; i++)
@@ -1020,12 +1037,12 @@ int main(int argc, char** argv)
 		}
 	}
 
-	// 9. Free this temp variable if it's still around
-	if (pipeReads)
+	// 9. Free the pipe loop
+	if (raceControl)
 	{
-		if (false == release_a_string(&pipeReads))
+		if (false == free_pipe_loop(&raceControl))
 		{
-			HARKLE_ERROR(Grand_Prix, main, release_a_string failed);
+			HARKLE_ERROR(Grand_Prix, main, free_pipe_loop failed);
 		}
 	}
 
@@ -1034,6 +1051,115 @@ int main(int argc, char** argv)
 }
 
 
+bool advance_racer(tgpRacer_ptr racer_ptr, int newPos)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;  // Keep reading until someone wins
+
+	// INPUT VALIDATION
+	if (!racer_ptr)
+	{
+		HARKLE_ERROR(Grand_Prix, advance_racer, NULL pointer);
+	}
+	else if (false == racer_ptr->winner)
+	{
+		if (racer_ptr->trackLen == racer_ptr->currPos && 1 == newPos)
+		{
+			racer_ptr->currLap++;
+			newPos++;
+		}
+		racer_ptr->currPos = newPos;
+
+		if (false == rerank_racer(racer_ptr))
+		{
+			HARKLE_ERROR(Grand_Prix, advance_racer, rerank_racer failed);
+		}
+
+		if (racer_ptr->currPos == racer_ptr->trackLen && racer_ptr->numLaps == racer_ptr->currLap)
+		{
+			racer_ptr->winner = true;
+			retVal = false;
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool read_racer_update(char* pipeRead, size_t msgLen, void* userData)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;  // Keep reading until someone wins
+	char* end_ptr = NULL;  // End of the number, per strtol()
+	long newPos = 0;  // Track position the racer reported
+
+	// INPUT VALIDATION
+	if (!pipeRead || !userData)
+	{
+		HARKLE_ERROR(Grand_Prix, read_racer_update, NULL pointer);
+	}
+	else
+	{
+		// read_pipe_message() already removed the newline, so the whole message is the number
+		newPos = strtol(pipeRead, &end_ptr, 10);
+
+		if (0 == msgLen || end_ptr != pipeRead + msgLen || newPos < 0 || newPos > INT_MAX)
+		{
+			HARKLE_ERROR(Grand_Prix, read_racer_update, Malformed update);
+		}
+		else
+		{
+			retVal = advance_racer((tgpRacer_ptr)userData, (int)newPos);
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+int read_racer_rings(tgpRacer_ptr* racerArr_ptr, int numRacers)
+{
+	// LOCAL VARIABLES
+	int retVal = 0;
+	uint64_t newPos = 0;  // Update from a racer's ring
+	int numUpdates = 0;  // Updates applied this call
+	int i = 0;  // Iterating variable
+
+	// INPUT VALIDATION
+	if (!racerArr_ptr)
+	{
+		HARKLE_ERROR(Grand_Prix, read_racer_rings, NULL pointer);
+		retVal = EINVAL;
+	}
+
+	// DRAIN THE RINGS
+	for (i = 0; 0 == retVal && i < numRacers; i++)
+	{
+		while (0 == receive_harklethread(racerArr_ptr[i]->F1Details, &newPos))
+		{
+			numUpdates++;
+
+			if (false == advance_racer(racerArr_ptr[i], (int)newPos))
+			{
+				retVal = ECANCELED;
+				break;
+			}
+		}
+	}
+
+	// NOTHING NEW
+	if (0 == retVal && 0 == numUpdates)
+	{
+		usleep(OFFICIALS_IDLE_US);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
 void racer_func(int racerNum)
 {
 	// LOCAL VARIABLES
@@ -1409,8 +1535,6 @@ void racer_rando_prime(tgpRacer_ptr threadDets)
 	int subCounter = 0;  // Require more calculations than before
 	int fastMult = 0;  // Multiple to increase the number of calculations, minimum 1
 	int errNum = 0;  // Capture errno here during error conditions
-	char localNum[SLEEPY_BUFF + 1] = { 0 };  // ULLONG_MAX as a placeholder
-	int numBytes = 0;  // Return value from snprintf()
 	bool success = true;  // Set this to false if anything fails
 	bool isThisPrime = true;  // Reset this to true
 	////////////////////// DATA TYPE DEPENDENT VARIABLES /////////////////////
@@ -1505,7 +1629,8 @@ void racer_rando_prime(tgpRacer_ptr threadDets)
 	// START RACING
 	if (true == success)
 	{
-		while (counter != threadDets->trackLen || currentLap != threadDets->numLaps)
+		while ((counter != threadDets->trackLen || currentLap != threadDets->numLaps) \
+		       && false == __atomic_load_n(&raceOver, __ATOMIC_ACQUIRE))
 		{
 			// 𝄞 Why are you sleepy? ♬
 			// ♩ Sleepy thread ♪
@@ -1516,7 +1641,7 @@ void racer_rando_prime(tgpRacer_ptr threadDets)
 			// fprintf(stdout, "Thread #%d is sleepy...  zzzZZZzzz... %d\n", threadDets->F1Details->tNum, counter);  // DEBUGGING
 
 			// FIND A RANDOM PRIME
-			while (1)
+			while (false == __atomic_load_n(&raceOver, __ATOMIC_RELAXED))
 			{
 				isThisPrime = true;  // Reset temp var
 				// randoNum = rando_a_uint(1, UINT_MAX);
@@ -1589,59 +1714,25 @@ void racer_rando_prime(tgpRacer_ptr threadDets)
 				}
 			}
 
-			// OUTPUT TO THE PIPE
-			// 1. Lock the mutex
-			errNum = pthread_mutex_lock(&(threadDets->F1Details->pipeMutex));
-
-			if (errNum)
+			// REPORT TO THE OFFICIALS
+			// Wait for room rather than drop an update (a dropped lap never gets counted),
+			// unless the race is over and nobody is reading anymore
+			while (EAGAIN == (errNum = send_harklethread(threadDets->F1Details, (uint64_t)counter)))
 			{
-				HARKLE_ERROR(Grand_Prix, racer_rando_prime, pthread_mutex_lock failed);
-				fprintf(stderr, "pthread_mutex_lock() returned errno:\t%s\n", strerror(errNum));
-				success = false;
-				break;
-			}
-			else
-			{
-				// 2. Write the counter
-				// 2.1. Convert counter to a string
-				numBytes = snprintf(localNum, SLEEPY_BUFF, "%d\n", counter);
-
-				if (numBytes >= SLEEPY_BUFF)
-				{
-					HARKLE_ERROR(Grand_Prix, racer_rando_prime, snprintf truncated the output);
-					success = false;
-					break;
-				}
-				else if (numBytes < 0)
+				if (true == __atomic_load_n(&raceOver, __ATOMIC_ACQUIRE))
 				{
-					HARKLE_ERROR(Grand_Prix, racer_rando_prime, snprintf failed);
-					success = false;
+					errNum = 0;
 					break;
 				}
-				else
-				{
-					// 2.2. Write that string to the pipe
-					errNum = write_a_pipe(threadDets->F1Details->pipeFDs[HPIPE_WRITE], (void*)localNum, numBytes);
-
-					if (errNum)
-					{
-						HARKLE_ERROR(Grand_Prix, racer_rando_prime, write_a_pipe failed);
-						fprintf(stderr, "write_a_pipe() returned errno:\t%s\n", strerror(errNum));
-						success = false;
-						break;
-					}
-				}
-
-				// 3. Unlock the mutex
-				errNum = pthread_mutex_unlock(&(threadDets->F1Details->pipeMutex));
+				sched_yield();
+			}
 
-				if (errNum)
-				{
-					HARKLE_ERROR(Grand_Prix, racer_rando_prime, pthread_mutex_unlock failed);
-					fprintf(stderr, "pthread_mutex_lock() returned errno:\t%s\n", strerror(errNum));
-					success = false;
-					break;
-				}
+			if (errNum)
+			{
+				HARKLE_ERROR(Grand_Prix, racer_rando_prime, send_harklethread failed);
+				fprintf(stderr, "send_harklethread() returned errno:\t%s\n", strerror(errNum));
+				success = false;
+				break;
 			}
 		}
 	}
@@ -0,0 +1,145 @@
+/*
+ *	The purpose of this file is to compare the original byte-by-byte mem_hunt() loop
+ *	against the current Memoroad mem_hunt() search engine.
+ *
+ *	Usage: mem_hunt_benchmark.exe [haystack size in MiB (default 1024)]
+ */
+
+#include "Harklerror.h"							// HARKLE_ERROR
+#include "Memoroad.h"							// mem_hunt()
+#include <stdbool.h>							// bool, true, false
+#include <stdio.h>								// fprintf()
+#include <stdlib.h>								// strtoul()
+#include <string.h>								// memcmp(), memcpy()
+#include <time.h>								// clock_gettime()
+
+#define MH_DEFAULT_MIB 1024						// Default haystack size
+#define MH_ALPHABET "abcdefghijklmnopqrstuvwxyz"	// Haystack 'text'
+
+
+/*
+	Purpose - The original mem_hunt() search loop, kept as the control
+ */
+void* legacy_mem_hunt(void* haystack_ptr, void* needle_ptr, size_t haystackLen, size_t needleLen)
+{
+	// LOCAL VARIABLES
+	void* retVal = NULL;
+	size_t i = 0;  // Iterating variable
+
+	for (i = 0; i <= (haystackLen - needleLen); i++)
+	{
+		if (0 == memcmp(haystack_ptr + i, needle_ptr, needleLen))
+		{
+			retVal = haystack_ptr + i;
+			break;
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+/*
+	Purpose - Monotonic time in seconds
+ */
+double get_seconds(void)
+{
+	struct timespec now = { 0 };
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + (now.tv_nsec / 1e9);
+}
+
+
+int main(int argc, char* argv[])
+{
+	// LOCAL VARIABLES
+	size_t needleLens[] = { 1, 4, 8, 16, 32, 64, 256, 0 };  // 0 terminated
+	size_t* currLen_ptr = needleLens;  // Current needle length
+	size_t numMiB = MH_DEFAULT_MIB;  // Haystack size in MiB
+	size_t haystackLen = 0;  // Haystack size in bytes
+	unsigned char* haystack_ptr = NULL;  // Haystack
+	unsigned char needle[256] = { 0 };  // Needle
+	size_t i = 0;  // Iterating variable
+	unsigned int seed = 0x1337;  // Deterministic haystack
+	void* legacyRes = NULL;  // Return value from legacy_mem_hunt()
+	void* newRes = NULL;  // Return value from mem_hunt()
+	double legacyTime = 0;  // Seconds spent in legacy_mem_hunt()
+	double newTime = 0;  // Seconds spent in mem_hunt()
+	double startTime = 0;  // Timer
+	bool success = true;  // Make this false if any results differ
+
+	// INPUT VALIDATION
+	if (argc > 1)
+	{
+		numMiB = strtoul(argv[1], NULL, 10);
+
+		if (numMiB < 1)
+		{
+			HARKLE_ERROR(mem_hunt_benchmark, main, Invalid haystack size);
+			return 1;
+		}
+	}
+	haystackLen = numMiB * 1024 * 1024;
+
+	// BUILD THE HAYSTACK
+	haystack_ptr = get_me_memory(haystackLen);
+
+	if (!haystack_ptr)
+	{
+		HARKLE_ERROR(mem_hunt_benchmark, main, get_me_memory failed);
+		return 1;
+	}
+
+	for (i = 0; i < haystackLen; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		haystack_ptr[i] = MH_ALPHABET[(seed >> 16) % (sizeof(MH_ALPHABET) - 1)];
+	}
+
+	// The needle is 'text' that only appears at the very end of the haystack
+	for (i = 0; i < sizeof(needle); i++)
+	{
+		needle[i] = MH_ALPHABET[i % (sizeof(MH_ALPHABET) - 1)];
+	}
+	needle[0] = 'A';
+
+	// RUN
+	fprintf(stdout, "Haystack: %zu MiB\n", numMiB);
+	fprintf(stdout, "%-10s %-12s %-12s %-8s\n", "NeedleLen", "Legacy (s)", "mem_hunt (s)", "Speedup");
+
+	while (*currLen_ptr)
+	{
+		memcpy(haystack_ptr + haystackLen - *currLen_ptr, needle, *currLen_ptr);
+
+		startTime = get_seconds();
+		legacyRes = legacy_mem_hunt(haystack_ptr, needle, haystackLen, *currLen_ptr);
+		legacyTime = get_seconds() - startTime;
+
+		startTime = get_seconds();
+		newRes = mem_hunt(haystack_ptr, needle, haystackLen, *currLen_ptr);
+		newTime = get_seconds() - startTime;
+
+		fprintf(stdout, "%-10zu %-12.4f %-12.4f %.1fx\n", *currLen_ptr, legacyTime, newTime, \
+		        newTime > 0 ? legacyTime / newTime : 0);
+
+		if (legacyRes != newRes)
+		{
+			HARKLE_ERROR(mem_hunt_benchmark, main, Results differ);
+			success = false;
+		}
+
+		// Restore the 'text'
+		for (i = haystackLen - *currLen_ptr; i < haystackLen; i++)
+		{
+			haystack_ptr[i] = 'z';
+		}
+		currLen_ptr++;
+	}
+
+	// CLEAN UP
+	free(haystack_ptr);
+
+	// DONE
+	return true == success ? 0 : 1;
+}
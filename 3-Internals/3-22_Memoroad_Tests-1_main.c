@@ -0,0 +1,254 @@
+#include "Harklerror.h"
+#include "Memoroad.h"
+#include <errno.h>              // EINVAL
+#include <stdbool.h>            // bool, true, false
+#include <stdio.h>              // fprintf()
+#include <stdlib.h>             // free()
+#include <string.h>             // strlen()
+
+// Most needles or hits any one test uses
+#define MHM_MAX_ENTRIES 8
+
+typedef struct memHuntMultiTestStruct
+{
+	char* testName;                             // Name and number of test
+	const char* haystack;                       // "haystack_ptr" input (nul-terminated for convenience)
+	const char* needle_arr[MHM_MAX_ENTRIES];    // build_mem_hunter() needles, NULL-terminated
+	memHit expHit_arr[MHM_MAX_ENTRIES];         // Expected hits, in any order
+	size_t expNumHits;                          // Number of entries in expHit_arr
+} mhmTest, *mhmTest_ptr;
+
+/*
+	Purpose - memHuntCallback that counts hits and asks to stop after the first one
+ */
+bool stop_at_first(size_t needleID, size_t offset, void* userData)
+{
+	(*(size_t*)userData)++;
+	return false;
+}
+
+/*
+	Purpose - Verify every expected hit was found exactly as many times as it was expected
+	Output - true if hit_arr and test->expHit_arr hold the same hits, false otherwise
+ */
+bool compare_hits(mhmTest_ptr test, memHit_ptr hit_arr, size_t numHits)
+{
+	// LOCAL VARIABLES
+	bool retVal = numHits == test->expNumHits;
+	bool found = false;  // Current expected hit was found
+	size_t i = 0;  // Iterating variable
+	size_t j = 0;  // Iterating variable
+
+	for (i = 0; i < test->expNumHits && true == retVal; i++)
+	{
+		found = false;
+		for (j = 0; j < numHits && false == found; j++)
+		{
+			found = hit_arr[j].needleID == test->expHit_arr[i].needleID \
+			        && hit_arr[j].offset == test->expHit_arr[i].offset;
+		}
+		retVal = found;
+	}
+
+	return retVal;
+}
+
+int main(void)
+{
+	/***************************************************************************************************/
+	/***************************************** MEM HUNT MULTI ******************************************/
+	/***************************************************************************************************/
+	// LOCAL VARIABLES
+	void* needle_arr[MHM_MAX_ENTRIES] = { NULL };  // build_mem_hunter() input
+	size_t needleLen_arr[MHM_MAX_ENTRIES] = { 0 };  // build_mem_hunter() input
+	size_t numNeedles = 0;  // build_mem_hunter() input
+	memHunter_ptr hunter_ptr = NULL;  // Return value from build_mem_hunter()
+	memHit_ptr hit_arr = NULL;  // Return value from mem_hunt_multi_arr()
+	size_t numHits = 0;  // [OUT] parameter for mem_hunt_multi_arr()
+	size_t huntRet = 0;  // Return value from mem_hunt_multi()
+	int errNum = 0;  // [OUT] parameter for mem_hunt_multi*()
+	int numTestsRun = 0;
+	int numTestsPassed = 0;
+	size_t i = 0;  // Iterating variable
+	mhmTest_ptr test = NULL;  // Current test being run
+	mhmTest_ptr* currTest_ptr = NULL;  // Iterating variable
+
+	// Normal Tests
+	mhmTest normTest01 = { "Normal Test 01 - One needle", "xxabcxx", { "abc", NULL }, { { 0, 2 } }, 1 };
+	mhmTest normTest02 = { "Normal Test 02 - Two needles, each found twice", "cat dog cat dog", { "dog", "cat", NULL }, \
+	                       { { 1, 0 }, { 0, 4 }, { 1, 8 }, { 0, 12 } }, 4 };
+	mhmTest normTest03 = { "Normal Test 03 - Duplicate needles both report", "xaby", { "ab", "ab", NULL }, \
+	                       { { 0, 1 }, { 1, 1 } }, 2 };
+	// Overlap Tests
+	mhmTest overTest01 = { "Overlap Test 01 - One needle overlapping itself", "aaaa", { "aa", NULL }, \
+	                       { { 0, 0 }, { 0, 1 }, { 0, 2 } }, 3 };
+	mhmTest overTest02 = { "Overlap Test 02 - Two needles sharing bytes", "abcdef", { "abcd", "cdef", NULL }, \
+	                       { { 0, 0 }, { 1, 2 } }, 2 };
+	// Suffix Tests (failure and output links)
+	mhmTest suffTest01 = { "Suffix Test 01 - Needle is a suffix of another", "xabc", { "abc", "bc", "c", NULL }, \
+	                       { { 0, 1 }, { 1, 2 }, { 2, 3 } }, 3 };
+	mhmTest suffTest02 = { "Suffix Test 02 - he/she/his/hers", "ushers", { "he", "she", "his", "hers", NULL }, \
+	                       { { 1, 1 }, { 0, 2 }, { 3, 2 } }, 3 };
+	mhmTest suffTest03 = { "Suffix Test 03 - Mismatch falls back to a suffix state", "abce", { "abcd", "bce", NULL }, \
+	                       { { 1, 1 } }, 1 };
+	// Edge Tests
+	mhmTest edgeTest01 = { "Edge Test 01 - Needle at the start and the end", "abxxab", { "ab", NULL }, \
+	                       { { 0, 0 }, { 0, 4 } }, 2 };
+	mhmTest edgeTest02 = { "Edge Test 02 - Needle is the whole haystack", "needle", { "needle", NULL }, \
+	                       { { 0, 0 } }, 1 };
+	mhmTest edgeTest03 = { "Edge Test 03 - Needle longer than the haystack", "abc", { "abcd", NULL }, { { 0 } }, 0 };
+	mhmTest edgeTest04 = { "Edge Test 04 - Empty haystack", "", { "a", NULL }, { { 0 } }, 0 };
+	// No Match Tests
+	mhmTest noneTest01 = { "No Match Test 01 - Nothing found", "abcabcabc", { "xyz", "cab!", "bb", NULL }, { { 0 } }, 0 };
+
+	mhmTest_ptr test_arr[] = { &normTest01, &normTest02, &normTest03, \
+	                           &overTest01, &overTest02, \
+	                           &suffTest01, &suffTest02, &suffTest03, \
+	                           &edgeTest01, &edgeTest02, &edgeTest03, &edgeTest04, \
+	                           &noneTest01, NULL };
+
+	// RUN TESTS
+	fprintf(stdout, "\nMEM HUNT MULTI UNIT TESTS\n");
+
+	for (currTest_ptr = test_arr; *currTest_ptr; currTest_ptr++)
+	{
+		test = *currTest_ptr;
+		fprintf(stdout, "\t%s\n\t\t", test->testName);
+		numTestsRun++;
+
+		for (numNeedles = 0; test->needle_arr[numNeedles]; numNeedles++)
+		{
+			needle_arr[numNeedles] = (void*)test->needle_arr[numNeedles];
+			needleLen_arr[numNeedles] = strlen(test->needle_arr[numNeedles]);
+		}
+
+		hunter_ptr = build_mem_hunter(needle_arr, needleLen_arr, numNeedles);
+		errNum = -1;
+		numHits = 0;
+		hit_arr = hunter_ptr ? mem_hunt_multi_arr(hunter_ptr, (void*)test->haystack, strlen(test->haystack), &numHits, &errNum) : NULL;
+
+		if (hunter_ptr && 0 == errNum && true == compare_hits(test, hit_arr, numHits))
+		{
+			fprintf(stdout, "[X] Success\n");
+			numTestsPassed++;
+		}
+		else
+		{
+			fprintf(stdout, "[ ] FAIL    Expected:\t%zu hits\tReceived:\t%zu hits (errNum %d)\n", \
+			        test->expNumHits, numHits, errNum);
+			for (i = 0; i < numHits; i++)
+			{
+				fprintf(stdout, "\t\t\tneedle %zu at offset %zu\n", hit_arr[i].needleID, hit_arr[i].offset);
+			}
+		}
+
+		free(hit_arr);
+		hit_arr = NULL;
+		free_mem_hunter(&hunter_ptr);
+	}
+
+	// Stop Tests
+	fprintf(stdout, "\tStop Test 01 - Callback stops at the first hit\n\t\t");
+	numTestsRun++;
+	needle_arr[0] = "aa";
+	needleLen_arr[0] = 2;
+	hunter_ptr = build_mem_hunter(needle_arr, needleLen_arr, 1);
+	numHits = 0;
+	huntRet = hunter_ptr ? mem_hunt_multi(hunter_ptr, "aaaa", 4, stop_at_first, &numHits, &errNum) : 0;
+	if (1 == huntRet && 1 == numHits && 0 == errNum)
+	{
+		fprintf(stdout, "[X] Success\n");
+		numTestsPassed++;
+	}
+	else
+	{
+		fprintf(stdout, "[ ] FAIL    Expected:\t1\tReceived:\t%zu (callback saw %zu)\n", huntRet, numHits);
+	}
+	free_mem_hunter(&hunter_ptr);
+
+	// Error Tests
+	fprintf(stdout, "\tError Test 01 - NULL needle_arr\n\t\t");
+	numTestsRun++;
+	hunter_ptr = build_mem_hunter(NULL, needleLen_arr, 1);
+	if (!hunter_ptr)
+	{
+		fprintf(stdout, "[X] Success\n");
+		numTestsPassed++;
+	}
+	else
+	{
+		fprintf(stdout, "[ ] FAIL    Expected:\tNULL\tReceived:\t%p\n", (void*)hunter_ptr);
+		free_mem_hunter(&hunter_ptr);
+	}
+
+	fprintf(stdout, "\tError Test 02 - Zero needles\n\t\t");
+	numTestsRun++;
+	hunter_ptr = build_mem_hunter(needle_arr, needleLen_arr, 0);
+	if (!hunter_ptr)
+	{
+		fprintf(stdout, "[X] Success\n");
+		numTestsPassed++;
+	}
+	else
+	{
+		fprintf(stdout, "[ ] FAIL    Expected:\tNULL\tReceived:\t%p\n", (void*)hunter_ptr);
+		free_mem_hunter(&hunter_ptr);
+	}
+
+	fprintf(stdout, "\tError Test 03 - NULL needle in needle_arr\n\t\t");
+	numTestsRun++;
+	needle_arr[0] = "abc";
+	needleLen_arr[0] = 3;
+	needle_arr[1] = NULL;
+	needleLen_arr[1] = 3;
+	hunter_ptr = build_mem_hunter(needle_arr, needleLen_arr, 2);
+	if (!hunter_ptr)
+	{
+		fprintf(stdout, "[X] Success\n");
+		numTestsPassed++;
+	}
+	else
+	{
+		fprintf(stdout, "[ ] FAIL    Expected:\tNULL\tReceived:\t%p\n", (void*)hunter_ptr);
+		free_mem_hunter(&hunter_ptr);
+	}
+
+	fprintf(stdout, "\tError Test 04 - Empty needle\n\t\t");
+	numTestsRun++;
+	needle_arr[1] = "";
+	needleLen_arr[1] = 0;
+	hunter_ptr = build_mem_hunter(needle_arr, needleLen_arr, 2);
+	if (!hunter_ptr)
+	{
+		fprintf(stdout, "[X] Success\n");
+		numTestsPassed++;
+	}
+	else
+	{
+		fprintf(stdout, "[ ] FAIL    Expected:\tNULL\tReceived:\t%p\n", (void*)hunter_ptr);
+		free_mem_hunter(&hunter_ptr);
+	}
+
+	fprintf(stdout, "\tError Test 05 - NULL hunter_ptr\n\t\t");
+	numTestsRun++;
+	errNum = 0;
+	numHits = 1;
+	hit_arr = mem_hunt_multi_arr(NULL, "abc", 3, &numHits, &errNum);
+	if (!hit_arr && 0 == numHits && EINVAL == errNum)
+	{
+		fprintf(stdout, "[X] Success\n");
+		numTestsPassed++;
+	}
+	else
+	{
+		fprintf(stdout, "[ ] FAIL    Expected:\tNULL and EINVAL\tReceived:\t%p and %d\n", (void*)hit_arr, errNum);
+		free(hit_arr);
+	}
+
+	// REPORT RESULTS
+	fprintf(stdout, "\n\nTests Run:   \t%d\n", numTestsRun);
+	fprintf(stdout,     "Tests Passed:\t%d\n\n", numTestsPassed);
+
+	// DONE
+	return numTestsRun == numTestsPassed ? 0 : 1;
+}
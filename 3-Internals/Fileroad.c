@@ -2,6 +2,7 @@
 #include <errno.h>		// errno
 #include <fcntl.h>	 	// open() flags
 #include "Fileroad.h"
+#include "../4-User_Mode/Map_Memory.h"	// mapMem_ptr
 #include "Harklerror.h"	// HARKLE_ERROR
 #include <inttypes.h>	// intmax_t
 #include <libgen.h>		// basename, dirname
@@ -11,6 +12,7 @@
 #include <stdio.h>		// fscanf, getchar
 #include <stdlib.h>	 	// calloc
 #include <string.h>	 	// strlen, strstr, strerror
+#include <sys/mman.h>	// mmap, madvise, munmap
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>		// read, stream macros
@@ -30,6 +32,11 @@
 #define FROAD_SML_BUFF_SIZE 32
 #endif  // FROAD_SML_BUFF_SIZE
 
+#ifndef FROAD_MMAP_THRESHOLD
+// MACRO defining the smallest regular file load_a_file() will mmap() instead of read()
+#define FROAD_MMAP_THRESHOLD (64 * 1024)
+#endif  // FROAD_MMAP_THRESHOLD
+
 #ifndef HARKLE_ERROR
 #define HARKLE_ERROR(header, funcName, msg) do { fprintf(stderr, "<<<ERROR>>> - %s - %s() - %s!\n", #header, #funcName, #msg); } while (0);
 #endif  // HARKLE_ERROR
@@ -39,6 +46,21 @@
 //////////////////////////////////////////////////////////////////////////////
 
 
+/*
+	Purpose - read() an open file descriptor to EOF into a fileView's reusable buffer
+	Input
+		fileDesc - Open file descriptor positioned at the start of the file
+		view_ptr - fileView whose buff_ptr will be (re)used and grown as needed
+		sizeHint - Expected size of the file (e.g., st_size), 0 if unknown
+		errNum - [OUT] Memory location to store errno value
+	Output - true on success, false on failure
+	Notes:
+		The buffer doubles whenever it fills so unknown sizes cost O(log n)
+			reallocations instead of a rewind and re-read per FROAD_BUFF_SIZE
+		The contents are nul-terminated
+ */
+bool read_into_file_view(int fileDesc, fileView_ptr view_ptr, size_t sizeHint, int* errNum);
+
 
 //////////////////////////////////////////////////////////////////////////////
 ////////////////////// LOCAL FUNCTION PROTOTYPES STOP ////////////////////////
@@ -161,13 +183,11 @@ char** split_lines(char* haystack, char splitChar)
 	// LOCAL VARIABLES
 	char** retVal = NULL;
 	char** tempArr_ptr = NULL;  // A copy of retVal for the purposes of iterating
-	char* temp_ptr = NULL;  // Return value from string.h function calls
 	bool success = true;
-	int charCount = 0;  // Number of splitChars in haystack (concurrent splitChars count as one)
-	char* hsCopy = NULL;  // A copy of the haystack to aid in parsing
-	size_t hsLen = 0;  // Length of the original haystack
-	char* currStr = NULL;  // Memory address of the current string truncated from hsCopy
-	char* currNul = NULL;  // Memory address of the current artificial nul terminator in hsCopy
+	size_t lineCount = 0;  // Number of non-empty lines in haystack
+	lineIter iter;  // Iterates haystack without copying it
+	const char* line_ptr = NULL;  // Current line inside haystack
+	size_t lineLen = 0;  // Length of the current line
 
 	// INPUT VALIDATION
 	if (!haystack)
@@ -185,77 +205,23 @@ char** split_lines(char* haystack, char splitChar)
 		HARKLE_ERROR(Fileroad, split_lines, Invalid split character);
 		success = false;
 	}
-	else
-	{
-		temp_ptr = strchr(haystack, splitChar);
-		
-		if (!temp_ptr)
-		{
-			HARKLE_ERROR(Fileroad, split_lines, Split character not found);
-			success = false;
-		}
-	}
-	
-	// Size haystack
-	if (success == true)
-	{
-		hsLen = strlen(haystack);
-			
-		if (hsLen < 1)
-		{
-			HARKLE_ERROR(Fileroad, split_lines, strlen failed);
-			success = false;
-		}
-	}
-	
-	// Copy haystack
-	if (success == true)
+	else if (!strchr(haystack, splitChar))
 	{
-		hsCopy = copy_a_string(haystack);
-		
-		if (!hsCopy)
-		{
-			HARKLE_ERROR(Fileroad, split_lines, copy_a_string failed);
-			success = false;
-		}
-		else if (strlen(hsCopy) != hsLen)
-		{
-			HARKLE_ERROR(Fileroad, split_lines, String length mismatch between haystack and hsCopy);
-			success = false;
-		}
+		HARKLE_ERROR(Fileroad, split_lines, Split character not found);
+		success = false;
 	}
 	
-	// PARSE haystack
+	// 1. Count the lines
 	if (success == true)
 	{
-		// 1. Count occurrences of the splitChar
-		// NOTE: Count only the final concurrent splitChar occurrence as long as it does
-		//	not begin or end the string.
-		temp_ptr = haystack;
+		success = init_line_iter(&iter, haystack, strlen(haystack), splitChar, true);
 
-		while(*temp_ptr != '\0')
+		while (success == true && true == next_line(&iter, &line_ptr, &lineLen))
 		{
-			if (*temp_ptr == splitChar)
-			{
-				if (temp_ptr > haystack)
-				{
-					if ((*(temp_ptr - 1)) != splitChar)
-					{
-						// Don't count splitChar if it's last because that would yield an empty string
-						if ((*(temp_ptr + 1)) != splitChar && (*(temp_ptr + 1)) != '\0')
-						{
-							charCount++;
-						}
-					}
-				}
-				else
-				{
-					// Don't count splitChar if it's first because that would yield an empty string
-				}
-			}
+			lineCount++;
 		}
-		
-		if (charCount == 0)
+
+		if (lineCount == 0)
 		{
 			success = false;	
 		}
@@ -264,9 +230,7 @@ char** split_lines(char* haystack, char splitChar)
 	// 2. Allocate the array of char*s into retVal
 	if (success == true)
 	{
-		// charCount + 1 because 3 splitChars make 4 strings
-		// SSSScSSSScSSSScSSSS if c == char && S == string
-		retVal = get_me_a_buffer_array(charCount + 1, true);
+		retVal = get_me_a_buffer_array(lineCount, true);
 		
 		if (!retVal)
 		{
@@ -275,75 +239,29 @@ char** split_lines(char* haystack, char splitChar)
 		}
 	}
 	
-	// 3. Parse each substring from the haystack
+	// 3. Copy each line out of the haystack
 	if (success == true)
 	{
-		if (!hsCopy)
-		{
-			success = false;	
-		}
-		else
+		tempArr_ptr = retVal;
+		iter.offset = 0;  // Rewind
+
+		while (true == next_line(&iter, &line_ptr, &lineLen))
 		{
-			// Copy retVal
-			tempArr_ptr = retVal;
-			// Start parsing hsCopy
-			currStr = hsCopy;
-			
-			while (*currStr && success == true)
+			(*tempArr_ptr) = get_me_a_buffer(lineLen);
+
+			if (!(*tempArr_ptr))
 			{
-				// Find the first splitChar
-				temp_ptr = strchr(currStr, splitChar);
-				
-				if (!temp_ptr)
-				{
-					// This is the last string to parse
-					if (*currStr)
-					{
-						(*tempArr_ptr) = copy_a_string(currStr);
-						
-						if (!(*tempArr_ptr))
-						{
-							HARKLE_ERROR(Fileroad, split_lines, copy_a_string failed);
-							success = false;
-						}
-						else
-						{
-							break;
-						}
-					}
-				}
-				else
-				{
-					currNul = temp_ptr;  // Save the address
-					*currNul = '\0';  // Truncate currStr
-					temp_ptr = currStr;  // Reset temp_ptr to start of string
-					(*tempArr_ptr) = copy_a_string(temp_ptr);
-					
-					if (!(*tempArr_ptr))
-					{
-						HARKLE_ERROR(Fileroad, split_lines, copy_a_string failed);
-						success = false;
-					}
-					else
-					{
-						tempArr_ptr++;  // Next char* index in retVal
-						currStr = currNul + 1;  // Start of the next string
-						temp_ptr = NULL;  // Empty temp_ptr
-					}
-				}
+				HARKLE_ERROR(Fileroad, split_lines, get_me_a_buffer failed);
+				success = false;
+				break;
 			}
+
+			memcpy(*tempArr_ptr, line_ptr, lineLen);
+			tempArr_ptr++;  // Next char* index in retVal
 		}
 	}	
 
 	// CLEAN UP
-	// hsCopy
-	if (hsCopy)
-	{
-		if (false == release_a_string_len(&hsCopy, hsLen))
-		{
-			HARKLE_ERROR(Fileroad, split_lines, release_a_string_len failed);
-		}
-	}
 	if (success == false)
 	{
 		if (retVal)
@@ -352,6 +270,7 @@ char** split_lines(char* haystack, char splitChar)
 			{
 				HARKLE_ERROR(Fileroad, split_lines, free_char_arr failed);
 			}
+			retVal = NULL;
 		}
 	}
 	
@@ -360,6 +279,98 @@ char** split_lines(char* haystack, char splitChar)
 }
 
 
+bool init_line_iter(lineIter_ptr iter_ptr, const char* buff_ptr, size_t buffLen, char splitChar, bool skipEmpty)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+
+	// INPUT VALIDATION
+	if (!iter_ptr || !buff_ptr)
+	{
+		HARKLE_ERROR(Fileroad, init_line_iter, NULL pointer);
+		retVal = false;
+	}
+	else
+	{
+		iter_ptr->buff_ptr = buff_ptr;
+		iter_ptr->buffLen = buffLen;
+		iter_ptr->offset = 0;
+		iter_ptr->splitChar = splitChar;
+		iter_ptr->skipEmpty = skipEmpty;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool init_line_iter_mapMem(lineIter_ptr iter_ptr, mapMem_ptr memStruct_ptr, char splitChar, bool skipEmpty)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+
+	// INPUT VALIDATION
+	if (!memStruct_ptr || !(memStruct_ptr->fileMem_ptr))
+	{
+		HARKLE_ERROR(Fileroad, init_line_iter_mapMem, NULL pointer);
+		retVal = false;
+	}
+	else
+	{
+		retVal = init_line_iter(iter_ptr, memStruct_ptr->fileMem_ptr, memStruct_ptr->memSize, splitChar, skipEmpty);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool next_line(lineIter_ptr iter_ptr, const char** line_ptr, size_t* lineLen)
+{
+	// LOCAL VARIABLES
+	bool retVal = false;
+	const char* start_ptr = NULL;  // Start of the current line
+	const char* split_ptr = NULL;  // Next splitChar
+	size_t remaining = 0;  // Bytes left in the buffer
+
+	// INPUT VALIDATION
+	if (!iter_ptr || !line_ptr || !lineLen || !(iter_ptr->buff_ptr))
+	{
+		HARKLE_ERROR(Fileroad, next_line, NULL pointer);
+	}
+	else
+	{
+		while (iter_ptr->offset < iter_ptr->buffLen)
+		{
+			start_ptr = iter_ptr->buff_ptr + iter_ptr->offset;
+			remaining = iter_ptr->buffLen - iter_ptr->offset;
+			split_ptr = memchr(start_ptr, iter_ptr->splitChar, remaining);
+
+			if (split_ptr)
+			{
+				*lineLen = split_ptr - start_ptr;
+				iter_ptr->offset += *lineLen + 1;
+			}
+			else
+			{
+				*lineLen = remaining;
+				iter_ptr->offset = iter_ptr->buffLen;
+			}
+
+			if (*lineLen > 0 || false == iter_ptr->skipEmpty)
+			{
+				*line_ptr = start_ptr;
+				retVal = true;
+				break;
+			}
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
 int search_char_arr(char** haystack_arr, char* needle_ptr)
 {
 	// LOCAL VARIABLES
@@ -426,6 +437,7 @@ char* fread_a_file(char* fileName)
 	FILE* theFile = NULL;
 	size_t fileSize = 0;  // Holds the return value from size_a_file_ptr()
 	size_t bytesRead = 0;  // Bytes read by fread()
+	struct stat fileStat;  // Used to size regular files
 
 	// INPUT VALIDATION
 	if (!fileName)
@@ -455,7 +467,15 @@ char* fread_a_file(char* fileName)
 	// 2. Size it
 	if (success == true)
 	{
-		fileSize = size_a_file_ptr(theFile);
+		// Trust fstat() for regular files instead of counting bytes with fgetc()
+		if (0 == fstat(fileno(theFile), &fileStat) && S_ISREG(fileStat.st_mode) && fileStat.st_size > 0)
+		{
+			fileSize = fileStat.st_size;
+		}
+		else
+		{
+			fileSize = size_a_file_ptr(theFile);
+		}
 
 		if (fileSize < 0)
 		{
@@ -518,178 +538,312 @@ char* read_a_file(char* fileName)
 {
 	// LOCAL VARIABLES
 	char* retVal = NULL;
-	int fileDesc = 0;  // Holds the file descriptor returned by open()
+	int fileDesc = -1;  // Holds the file descriptor returned by open()
 	bool success = true;  // If anything fails, set this to false
-	ssize_t numBytesRead = 0;  // Return value from read()
-	ssize_t prevNumBytesRead = 0;  // Return value from read()
-	int numTries = 0;  // Keeps track of allocation attempts
 	char* temp_ptr = NULL;  // Return values from string.h function calls
-	off_t fileSize = 0;  // File size read from file descriptor
-	int errNum = 0;  // [OUT] parameter for size_a_file_desc()
-	bool guessingSize = false;  // Set this to true if file size comes back 0
+	int errNum = 0;  // [OUT] parameter for read_into_file_view()
+	fileView view = { 0 };  // Buffer the file is read into
 
 	// INPUT VALIDATION
-	if (fileName)
+	if (!fileName || !(*fileName))
+	{
+		HARKLE_ERROR(Fileroad, read_a_file, NULL fileName);
+		success = false;
+	}
+
+	// READ THE FILE
+	// 1. Open the file
+	if (success == true)
 	{
-		if (*fileName)
+		fileDesc = open(fileName, O_RDONLY);
+
+		if (fileDesc < 0)
 		{
-			// READ THE FILE
-			// 1. Open the file
-			if (success == true)
-			{
-				fileDesc = open(fileName, O_RDONLY);
+			HARKLE_ERROR(Fileroad, read_a_file, open failed);
+			success = false;
+		}
+	}
 
-				if (fileDesc < 0)
-				{
-					HARKLE_ERROR(Fileroad, read_a_file, open failed);
-					success = false;
-				}
-			}
+	// 2. Read the file
+	if (success == true)
+	{
+		if (false == read_into_file_view(fileDesc, &view, 0, &errNum))
+		{
+			HARKLE_ERROR(Fileroad, read_a_file, read_into_file_view failed);
+			HARKLE_ERRNO(Fileroad, read, errNum);
+			success = false;
+		}
+		else if (view.viewLen == 0)
+		{
+			// It's ok if 0 bytes were read.  Some cmdline files are empty.
+			temp_ptr = strcpy(view.buff_ptr, "<EMPTY>");
 
-			// 2. Size the file
-			if (success == true)
+			if (temp_ptr != view.buff_ptr)
 			{
-				fileSize = size_a_file_desc(fileDesc, &errNum);
-
-				if (fileSize == -1)
-				{
-					HARKLE_ERROR(Fileroad, read_a_file, size_a_file_desc failed);
-					fprintf(stderr, "size_a_file_desc() set errNum to %d\n", errNum);
-					success = false;
-				}
-				else if (fileSize == 0)
-				{
-					fileSize = FROAD_BUFF_SIZE + 1;
-					guessingSize = true;
-				}
+				HARKLE_ERROR(Fileroad, read_a_file, strcpy failed);
+				success = false;
 			}
+		}
+	}
 
-			// 3. Allocate a buffer
-			if (success == true)
-			{
-				retVal = get_me_a_buffer(fileSize);
+	// 3. Keep the buffer
+	if (success == true)
+	{
+		retVal = take_file_view(&view);
 
-				if (!retVal)
-				{
-					HARKLE_ERROR(Fileroad, read_a_file, get_me_a_buffer failed);
-					success = false;
-				}
-			}
+		if (!retVal)
+		{
+			HARKLE_ERROR(Fileroad, read_a_file, take_file_view failed);
+			success = false;
+		}
+	}
 
-			// 4. Read the file
-			if (success == true)
-			{
-				numBytesRead = read(fileDesc, retVal, fileSize);
+	// CLEAN UP
+	if (view.buff_ptr)
+	{
+		if (false == release_file_view(&view, false))
+		{
+			HARKLE_ERROR(Fileroad, read_a_file, release_file_view failed);
+		}
+	}
 
-				if (numBytesRead < 0)
-				{
-					HARKLE_ERROR(Fileroad, read_a_file, read failed);
-					success = false;
-				}
-				else if (numBytesRead == 0)
-				{
-					// It's ok if 0 bytes were read.  Some cmdline files are empty.
-					temp_ptr = strcpy(retVal, "<EMPTY>");
-
-					if (temp_ptr != retVal)
-					{
-						HARKLE_ERROR(Fileroad, read_a_file, strcpy failed);
-						success = false;
-					}
-					else
-					{
-						numBytesRead = strlen(retVal);
-					}
-				}
-				else if (numBytesRead == fileSize && guessingSize == true)
-				{
-					// There may be more to read
-					do
-					{
-						// 0. Record previous number of bytes read
-						prevNumBytesRead = numBytesRead;
-
-						// 1. Increase the buffer size
-						temp_ptr = realloc(retVal, fileSize + FROAD_BUFF_SIZE);
-
-						if (!temp_ptr)
-						{
-							HARKLE_ERROR(Fileroad, read_a_file, realloc failed);
-							success = false;
-						}
-						else
-						{
-							retVal = temp_ptr;
-							temp_ptr = NULL;
-							fileSize += FROAD_BUFF_SIZE;
-						}
-
-						// 2. Rewind the file descriptor
-						if (false == rewind_a_file_desc(fileDesc, &errNum))
-						{
-							HARKLE_ERROR(Fileroad, read_a_file, rewind_a_file_desc failed);
-							fprintf(stderr, "rewind_a_file_desc() set errNum to %d\n", errNum);
-							success = false;
-						}
-						else
-						{
-							// 3. Read the file descriptor again
-							numBytesRead = read(fileDesc, retVal, fileSize);
-
-							if (numBytesRead <= 0)
-							{
-								HARKLE_ERROR(Fileroad, read_a_file, (re)read failed);
-								success = false;
-							}
-							else
-							{
-
-							}
-						}
-					}
-					while (numBytesRead == fileSize && guessingSize == true && success == true && prevNumBytesRead != numBytesRead);
-				}
-			}
+	// Close the file descriptor regardless of the success status
+	if (fileDesc >= 0)
+	{
+		if (close(fileDesc) < 0)
+		{
+			HARKLE_ERROR(Fileroad, read_a_file, close failed);
 		}
 	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool load_a_file(const char* fileName, fileView_ptr view_ptr, int* errNum)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	int fileDesc = -1;  // Holds the file descriptor returned by open()
+	struct stat fileStat;  // Used to size the file and check its type
+	void* map_ptr = MAP_FAILED;  // Return value from mmap()
+
+	// INPUT VALIDATION
+	if (!errNum)
+	{
+		HARKLE_ERROR(Fileroad, load_a_file, NULL errNum pointer);
+		retVal = false;
+	}
+	else if (!fileName || !(*fileName) || !view_ptr)
+	{
+		HARKLE_ERROR(Fileroad, load_a_file, NULL pointer);
+		*errNum = EINVAL;
+		retVal = false;
+	}
 	else
 	{
-		HARKLE_ERROR(Fileroad, read_a_file, NULL fileName);
-		success = false;
+		*errNum = 0;
+
+		// Let go of the previous view, but not the buffer
+		if (false == release_file_view(view_ptr, true))
+		{
+			HARKLE_ERROR(Fileroad, load_a_file, release_file_view failed);
+		}
+	}
+
+	// 1. Open it
+	if (retVal == true)
+	{
+		fileDesc = open(fileName, O_RDONLY | O_CLOEXEC);
+
+		if (fileDesc < 0)
+		{
+			*errNum = errno;
+			HARKLE_ERROR(Fileroad, load_a_file, open failed);
+			retVal = false;
+		}
+		else if (fstat(fileDesc, &fileStat))
+		{
+			*errNum = errno;
+			HARKLE_ERROR(Fileroad, load_a_file, fstat failed);
+			retVal = false;
+		}
+	}
+
+	// 2. Map large regular files
+	if (retVal == true && S_ISREG(fileStat.st_mode) && fileStat.st_size >= FROAD_MMAP_THRESHOLD)
+	{
+#ifdef MAP_POPULATE
+		map_ptr = mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fileDesc, 0);
+#else
+		map_ptr = mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, fileDesc, 0);
+#endif  // MAP_POPULATE
+
+		if (MAP_FAILED != map_ptr)
+		{
+			madvise(map_ptr, fileStat.st_size, MADV_SEQUENTIAL);  // Advisory only
+			view_ptr->view_ptr = map_ptr;
+			view_ptr->viewLen = fileStat.st_size;
+			view_ptr->isMapped = true;
+		}
+		// Otherwise, fall back to read()
+	}
+
+	// 3. read() everything else
+	if (retVal == true && false == view_ptr->isMapped)
+	{
+		retVal = read_into_file_view(fileDesc, view_ptr, \
+		                             S_ISREG(fileStat.st_mode) ? fileStat.st_size : 0, errNum);
+
+		if (retVal == false)
+		{
+			HARKLE_ERROR(Fileroad, load_a_file, read_into_file_view failed);
+		}
 	}
 
 	// CLEAN UP
-	if (success == false)
+	if (fileDesc >= 0)
 	{
-		if (retVal)
+		close(fileDesc);  // The mapping, if any, survives the close
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool read_into_file_view(int fileDesc, fileView_ptr view_ptr, size_t sizeHint, int* errNum)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	ssize_t numBytesRead = 0;  // Return value from read()
+	size_t totalRead = 0;  // Bytes read so far
+	size_t newSize = 0;  // New buffer capacity
+	char* temp_ptr = NULL;  // Return value from realloc()
+
+	// INITIAL SIZE
+	// +1 for the nul.  A hinted size also gets +1 spare so a file that matches the hint
+	// never fills the buffer, and the next read() sees EOF instead of forcing a realloc.
+	newSize = sizeHint > 0 ? sizeHint + 2 : FROAD_BUFF_SIZE + 1;
+
+	// READ
+	while (retVal == true)
+	{
+		// 1. Grow the buffer (leaving room for the nul terminator)
+		if (!(view_ptr->buff_ptr) || view_ptr->buffSize < newSize)
 		{
-			// memset
-			if (*retVal)
+			temp_ptr = realloc(view_ptr->buff_ptr, newSize);
+
+			if (!temp_ptr)
 			{
-				temp_ptr = memset(retVal, 0x0, strlen(retVal));
+				*errNum = ENOMEM;
+				HARKLE_ERROR(Fileroad, read_into_file_view, realloc failed);
+				retVal = false;
+				break;
+			}
+			view_ptr->buff_ptr = temp_ptr;
+			view_ptr->buffSize = newSize;
+		}
 
-				if (temp_ptr != retVal)
-				{
-					HARKLE_ERROR(Fileroad, read_a_file, memset failed);
-				}
+		// 2. Read what fits
+		numBytesRead = read(fileDesc, view_ptr->buff_ptr + totalRead, view_ptr->buffSize - totalRead - 1);
 
-				temp_ptr = NULL;
+		if (numBytesRead < 0)
+		{
+			if (EINTR != errno)
+			{
+				*errNum = errno;
+				HARKLE_ERROR(Fileroad, read_into_file_view, read failed);
+				retVal = false;
 			}
+		}
+		else if (numBytesRead == 0)
+		{
+			break;  // EOF
+		}
+		else
+		{
+			totalRead += numBytesRead;
 
-			// free
-			free(retVal);
-
-			// NULL
-			retVal = NULL;
+			if (totalRead == view_ptr->buffSize - 1)
+			{
+				newSize = view_ptr->buffSize * 2;  // Full.  There may be more.
+			}
 		}
 	}
 
-	// Close the file descriptor regardless of the success status
-	if (fileDesc >= 0)
+	// DONE
+	if (retVal == true)
 	{
-		if (close(fileDesc) < 0)
+		view_ptr->buff_ptr[totalRead] = '\0';
+		view_ptr->view_ptr = view_ptr->buff_ptr;
+		view_ptr->viewLen = totalRead;
+		view_ptr->isMapped = false;
+	}
+	return retVal;
+}
+
+
+char* take_file_view(fileView_ptr view_ptr)
+{
+	// LOCAL VARIABLES
+	char* retVal = NULL;
+
+	// INPUT VALIDATION
+	if (!view_ptr || !(view_ptr->buff_ptr) || true == view_ptr->isMapped)
+	{
+		HARKLE_ERROR(Fileroad, take_file_view, Invalid view);
+	}
+	else
+	{
+		retVal = view_ptr->buff_ptr;
+		view_ptr->buff_ptr = NULL;
+		view_ptr->buffSize = 0;
+		view_ptr->view_ptr = NULL;
+		view_ptr->viewLen = 0;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool release_file_view(fileView_ptr view_ptr, bool keepBuffer)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+
+	// INPUT VALIDATION
+	if (!view_ptr)
+	{
+		HARKLE_ERROR(Fileroad, release_file_view, NULL pointer);
+		retVal = false;
+	}
+	else
+	{
+		// 1. Unmap
+		if (true == view_ptr->isMapped && view_ptr->view_ptr)
 		{
-			HARKLE_ERROR(Fileroad, read_a_file, close failed);
+			if (munmap((void*)view_ptr->view_ptr, view_ptr->viewLen))
+			{
+				HARKLE_ERROR(Fileroad, release_file_view, munmap failed);
+				retVal = false;
+			}
+		}
+		view_ptr->view_ptr = NULL;
+		view_ptr->viewLen = 0;
+		view_ptr->isMapped = false;
+
+		// 2. Free the buffer
+		if (false == keepBuffer && view_ptr->buff_ptr)
+		{
+			if (false == release_a_string_len(&(view_ptr->buff_ptr), view_ptr->buffSize))
+			{
+				HARKLE_ERROR(Fileroad, release_file_view, release_a_string_len failed);
+				retVal = false;
+			}
+			view_ptr->buffSize = 0;
 		}
 	}
 
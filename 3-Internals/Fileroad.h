@@ -8,9 +8,33 @@
 #define __FILEROAD__
 
 #include <stdbool.h>	// bool, true, false
+#include <stddef.h>		// size_t
 #include <stdio.h>		// FILE*
 #include <sys/types.h>	// off_t
 
+// Map_Memory's mapMem (see: init_line_iter_mapMem())
+struct mappedMemory;
+
+// Non-allocating (ptr, len) line iterator over a buffer
+typedef struct fileroadLineIterator
+{
+	const char* buff_ptr;				// Buffer being iterated (not owned)
+	size_t buffLen;						// Length of buff_ptr
+	size_t offset;						// Offset of the next unread byte
+	char splitChar;						// Line separator
+	bool skipEmpty;						// If true, empty lines are not yielded
+} lineIter, *lineIter_ptr;
+
+// Contents of a file loaded by load_a_file(), either mapped or read into a reusable buffer
+typedef struct fileroadFileView
+{
+	const char* view_ptr;				// File contents
+	size_t viewLen;						// Number of bytes at view_ptr
+	bool isMapped;						// true if view_ptr is a read-only mmap()
+	char* buff_ptr;						// Reusable read() buffer, kept between loads
+	size_t buffSize;					// Capacity of buff_ptr, including a nul terminator
+} fileView, *fileView_ptr;
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// INPUT FUNCTIONS START ////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -65,10 +89,56 @@ char* buff_a_num(void);
 		The caller is responsible for free()ing all of the char pointers
 			in the array in addition to the array itself.
 		Successive occurrences of splitChar will be treated as one
+		Prefer init_line_iter()/next_line() for large buffers since they do
+			not allocate
  */
 char** split_lines(char* haystack, char splitChar);
 
 
+/*
+	Purpose: Prepare a lineIter to yield each line of a buffer as a view
+		into that buffer
+	Input
+		iter_ptr - [OUT] lineIter struct to initialize
+		buff_ptr - Buffer to split (need not be nul-terminated)
+		buffLen - Length of buff_ptr
+		splitChar - Character separating the lines
+		skipEmpty - If true, successive splitChars are treated as one (like
+			split_lines())
+	Output - true on success, false on failure
+	Notes:
+		Nothing is allocated or copied.  buff_ptr must outlive the iterator.
+ */
+bool init_line_iter(lineIter_ptr iter_ptr, const char* buff_ptr, size_t buffLen, char splitChar, bool skipEmpty);
+
+
+/*
+	Purpose: Wrap init_line_iter() for a Map_Memory mappedMemory struct
+	Input
+		iter_ptr - [OUT] lineIter struct to initialize
+		memStruct_ptr - Mapped file (e.g., map_file()) to split
+		splitChar - Character separating the lines
+		skipEmpty - If true, empty lines are not yielded
+	Output - true on success, false on failure
+ */
+bool init_line_iter_mapMem(lineIter_ptr iter_ptr, struct mappedMemory* memStruct_ptr, char splitChar, bool skipEmpty);
+
+
+/*
+	Purpose: Yield the next line from a lineIter
+	Input
+		iter_ptr - Iterator initialized by init_line_iter()
+		line_ptr - [OUT] Start of the line inside the iterator's buffer
+		lineLen - [OUT] Length of the line, not including splitChar
+	Output - true if a line was yielded, false at the end of the buffer
+	Notes:
+		*line_ptr is NOT nul-terminated
+		Only splitChar is stripped, so CRLF lines split on '\n' keep their '\r'
+		Separators are located with memchr(), which the C library vectorizes
+ */
+bool next_line(lineIter_ptr iter_ptr, const char** line_ptr, size_t* lineLen);
+
+
 /*
 	Purpose: Find a needle_ptr in a haystack_arr
 	Input
@@ -79,6 +149,8 @@ char** split_lines(char* haystack, char splitChar);
 		-1 otherwise
 	Notes:
 		This function utilizes strcmp()
+		This is a linear search.  To deduplicate strings in a loop, use a
+			memStrSet (see: Memoroad's create_mem_str_set()) instead.
  */
 int search_char_arr(char** haystack_arr, char* needle_ptr);
 
@@ -118,6 +190,56 @@ char* fread_a_file(char* fileName);
 char* read_a_file(char* fileName);
 
 
+/*
+	Purpose - Load a file's contents as cheaply as the file allows
+	Input
+		fileName - nul-terminated char array of the file to load
+		view_ptr - [IN/OUT] fileView to load into.  Zero it (fileView x = { 0 };)
+			before its first use and reuse it for later loads.
+		errNum - [OUT] Memory location to store errno value
+	Output
+		On success, true and view_ptr->view_ptr/viewLen describe the contents
+		On failure, false and errno is stored in errNum
+	Notes:
+		Regular files of at least FROAD_MMAP_THRESHOLD bytes are mmap()ed
+			read-only with MAP_POPULATE and madvise(MADV_SEQUENTIAL).  These
+			views are NOT nul-terminated.
+		Everything else (small files, /proc entries that report a size of 0,
+			pipes) is read() into view_ptr->buff_ptr, which only grows, and is
+			nul-terminated
+		Any previous view held by view_ptr is released first
+		Call release_file_view() when finished
+ */
+bool load_a_file(const char* fileName, fileView_ptr view_ptr, int* errNum);
+
+
+/*
+	Purpose - Take ownership of the read() buffer behind a fileView
+	Input
+		view_ptr - fileView populated by load_a_file()
+	Output
+		On success, the heap-allocated, nul-terminated buffer holding the
+			contents.  view_ptr no longer references it.
+		On failure (including mapped views), NULL
+	Notes:
+		It is the caller's responsibility to free() the return value
+ */
+char* take_file_view(fileView_ptr view_ptr);
+
+
+/*
+	Purpose - Release the resources held by a fileView
+	Input
+		view_ptr - fileView populated by load_a_file()
+		keepBuffer - If true, the reusable read() buffer is kept for the next
+			load_a_file() call
+	Output - true on success, false on failure
+	Notes:
+		Mapped views are munmap()ed
+ */
+bool release_file_view(fileView_ptr view_ptr, bool keepBuffer);
+
+
 /*
 	Purpose - Utilize stat to size a file
 	Input
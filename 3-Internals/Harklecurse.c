@@ -3,13 +3,29 @@
 #include "Memoroad.h"
 #include <ncurses.h>			// WINDOW
 #include <stdbool.h>			// bool, true, false
-#include <stdlib.h>				// calloc()
+#include <stdlib.h>				// calloc(), realloc()
+#include <string.h>				// memset()
+#include <time.h>				// clock_gettime()
 
 #ifndef HARKLECURSE_MAX_TRIES
 // MACRO to limit repeated allocation attempts
 #define HARKLECURSE_MAX_TRIES 3
 #endif  // HARKLECURSE_MAX_TRIES
 
+#define HC_NSEC_PER_SEC 1000000000L  // Nanoseconds per second
+
+
+/*
+	PURPOSE - Nanoseconds between two CLOCK_MONOTONIC timestamps
+ */
+long hc_elapsed_ns(const struct timespec* start_ptr, const struct timespec* stop_ptr);
+
+
+/*
+	PURPOSE - Forget every dirty point on a track
+ */
+void clear_track_dirt(hcTrack_ptr track_ptr);
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// STRUCT FUNCTIONS START ///////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -94,6 +110,12 @@ hcCartCoord_ptr build_new_cartCoord_struct(int xVal, int yVal, char pntChar, uns
 		retVal->hcFlags = initStatus;
 		// struct hcCartesianCoordinate* nextPnt; 	// Next node in the linked list
 		retVal->nextPnt = NULL;
+		// struct hcCartesianTrack* track_ptr;		// Track holding this node, if any
+		retVal->track_ptr = NULL;
+		// char shownGraph;						// Character last printed here (tracks only)
+		retVal->shownGraph = 0;
+		// bool isDirty;							// In its track's dirty_arr
+		retVal->isDirty = false;
 	}
 	
 	// CLEAN UP
@@ -135,6 +157,11 @@ hcCartCoord_ptr add_cartCoord_node(hcCartCoord_ptr headPnt, hcCartCoord_ptr newP
 		HARKLE_ERROR(Harklecurse, add_cartCoord_node, Invalid pntPos);
 		success = false;
 	}
+	else if (newPnt->track_ptr || (headPnt && headPnt->track_ptr))
+	{
+		HARKLE_ERROR(Harklecurse, add_cartCoord_node, Track nodes are added by append_hcTrack_pnt);
+		success = false;
+	}
 	
 	// DETERMINE HEAD NODE
 	if (true == success)
@@ -225,7 +252,12 @@ int get_num_cartCoord_nodes(hcCartCoord_ptr headPnt)
 	hcCartCoord_ptr tmp_ptr = NULL;  // Walk the linked list with this variable
 	
 	// INPUT VALIDATION
-	if (headPnt)
+	if (headPnt && headPnt->track_ptr)
+	{
+		// COUNT TRACK POINTS
+		retVal = headPnt->track_ptr->numPnts - (headPnt - headPnt->track_ptr->pnt_arr);
+	}
+	else if (headPnt)
 	{
 		// COUNT NODES
 		tmp_ptr = headPnt;
@@ -281,6 +313,7 @@ bool free_cartCoord_struct(hcCartCoord_ptr* oldStruct_ptr)
 {
 	// LOCAL VARIABLES
 	bool retVal = true;  // Set this to false if anything fails
+	hcTrack_ptr oldTrack_ptr = NULL;  // Track to free, if *oldStruct_ptr heads one
 
 	// INPUT VALIDATION
 	if (NULL == oldStruct_ptr || NULL == *oldStruct_ptr)
@@ -288,6 +321,21 @@ bool free_cartCoord_struct(hcCartCoord_ptr* oldStruct_ptr)
 		HARKLE_ERROR(Harklecurse, free_cartCoord_struct, NULL pointer);
 		retVal = false;
 	}
+	else if ((*oldStruct_ptr)->track_ptr)
+	{
+		// FREE TRACK
+		if (*oldStruct_ptr == (*oldStruct_ptr)->track_ptr->pnt_arr)
+		{
+			oldTrack_ptr = (*oldStruct_ptr)->track_ptr;  // The node is freed with the track
+			*oldStruct_ptr = NULL;
+			retVal = free_hcTrack_ptr(&oldTrack_ptr);
+		}
+		else
+		{
+			HARKLE_ERROR(Harklecurse, free_cartCoord_struct, Only the head node frees a track);
+			retVal = false;
+		}
+	}
 	else
 	{
 		// FREE NODE
@@ -314,6 +362,10 @@ bool free_cartCoord_struct(hcCartCoord_ptr* oldStruct_ptr)
 		(*oldStruct_ptr)->defGraph = 0;
 		// unsigned long hcFlags;					// Implementation-defined coordinate details
 		(*oldStruct_ptr)->hcFlags = 0;
+		// char shownGraph;						// Character last printed here (tracks only)
+		(*oldStruct_ptr)->shownGraph = 0;
+		// bool isDirty;							// In its track's dirty_arr
+		(*oldStruct_ptr)->isDirty = false;
 		// struct hcCartesianCoordinate* nextPnt;  // Next node in the linked list
 		// Handled recursively above (or below, depending on how you look at it... recursively)
 		// 3. Free/NULL this node
@@ -366,9 +418,24 @@ hcCartCoord_ptr get_pos_num(hcCartCoord_ptr startPnt, int posNumber)
 	}
 
 	// FIND THE NODE
-	retVal = startPnt;
+	// Index it
+	if (true == success && startPnt->track_ptr)
+	{
+		retVal = get_hcTrack_pnt(startPnt->track_ptr, posNumber);
 
-	while (retVal)
+		// Preserve the 'search forward from startPnt' behavior
+		if (retVal < startPnt)
+		{
+			retVal = NULL;
+		}
+	}
+	// Search for it
+	else if (true == success)
+	{
+		retVal = startPnt;
+	}
+
+	while (retVal && !(retVal->track_ptr))
 	{
 		// fprintf(stdout, "Current position number:\t%d\n", retVal->posNum);  // DEBUGGING
 		if (retVal->posNum == posNumber)
@@ -386,8 +453,264 @@ hcCartCoord_ptr get_pos_num(hcCartCoord_ptr startPnt, int posNumber)
 }
 
 
+bool mark_cartCoord_dirty(hcCartCoord_ptr hcCoord)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;  // Set this to false if anything fails
+	hcTrack_ptr track_ptr = NULL;  // hcCoord's track
+
+	// INPUT VALIDATION
+	if (!hcCoord)
+	{
+		HARKLE_ERROR(Harklecurse, mark_cartCoord_dirty, NULL pointer);
+		retVal = false;
+	}
+	// MARK IT
+	else if (hcCoord->track_ptr && false == hcCoord->isDirty)
+	{
+		track_ptr = hcCoord->track_ptr;
+		track_ptr->dirty_arr[track_ptr->numDirty] = hcCoord - track_ptr->pnt_arr;
+		track_ptr->numDirty++;
+		hcCoord->isDirty = true;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
 ////////////////////// CARTESIAN COORDINATE STRUCT STOP //////////////////////
 
+//////////////////////// CARTESIAN TRACK STRUCT START ////////////////////////
+
+
+hcTrack_ptr create_hcTrack_ptr(int numPnts)
+{
+	// LOCAL VARIABLES
+	hcTrack_ptr retVal = NULL;
+	bool success = true;  // Set this to false if anything fails
+	int numTries = 0;  // Number of allocation attempts
+
+	// INPUT VALIDATION
+	if (numPnts < 1)
+	{
+		HARKLE_ERROR(Harklecurse, create_hcTrack_ptr, Invalid numPnts);
+		success = false;
+	}
+
+	// ALLOCATION
+	if (true == success)
+	{
+		while (numTries < HARKLECURSE_MAX_TRIES && NULL == retVal)
+		{
+			retVal = (hcTrack_ptr)calloc(1, sizeof(hcTrack));
+			numTries++;
+		}
+
+		numTries = 0;
+		while (retVal && numTries < HARKLECURSE_MAX_TRIES && NULL == retVal->pnt_arr)
+		{
+			retVal->pnt_arr = (hcCartCoord_ptr)calloc(numPnts, sizeof(hcCartCoord));
+			numTries++;
+		}
+
+		numTries = 0;
+		while (retVal && numTries < HARKLECURSE_MAX_TRIES && NULL == retVal->dirty_arr)
+		{
+			retVal->dirty_arr = (int*)calloc(numPnts, sizeof(int));
+			numTries++;
+		}
+
+		if (NULL == retVal || NULL == retVal->pnt_arr || NULL == retVal->dirty_arr)
+		{
+			HARKLE_ERROR(Harklecurse, create_hcTrack_ptr, calloc failed);
+			if (retVal)
+			{
+				free(retVal->pnt_arr);
+				free(retVal->dirty_arr);
+			}
+			free(retVal);
+			retVal = NULL;
+		}
+		else
+		{
+			retVal->arrLen = numPnts;
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+hcCartCoord_ptr append_hcTrack_pnt(hcTrack_ptr track_ptr, int xVal, int yVal, char pntChar, unsigned long initStatus)
+{
+	// LOCAL VARIABLES
+	hcCartCoord_ptr retVal = NULL;
+	hcCartCoord_ptr newArr = NULL;  // Return value from realloc()
+	int* newDirtyArr = NULL;  // Return value from realloc()
+	bool success = true;  // Set this to false if anything fails
+	int i = 0;  // Iterating variable
+
+	// INPUT VALIDATION
+	if (!track_ptr || !(track_ptr->pnt_arr))
+	{
+		HARKLE_ERROR(Harklecurse, append_hcTrack_pnt, NULL pointer);
+		success = false;
+	}
+	else if (xVal < 0)
+	{
+		HARKLE_ERROR(Harklecurse, append_hcTrack_pnt, Invalid xVal);
+		success = false;
+	}
+	else if (yVal < 0)
+	{
+		HARKLE_ERROR(Harklecurse, append_hcTrack_pnt, Invalid yVal);
+		success = false;
+	}
+
+	// GROW THE TRACK
+	if (true == success && track_ptr->numPnts == track_ptr->arrLen)
+	{
+		// Every point may be dirty at once
+		newDirtyArr = (int*)realloc(track_ptr->dirty_arr, 2 * track_ptr->arrLen * sizeof(int));
+
+		if (newDirtyArr)
+		{
+			track_ptr->dirty_arr = newDirtyArr;
+			newArr = (hcCartCoord_ptr)realloc(track_ptr->pnt_arr, \
+			                                  2 * track_ptr->arrLen * sizeof(hcCartCoord));
+		}
+
+		if (!newArr)
+		{
+			HARKLE_ERROR(Harklecurse, append_hcTrack_pnt, realloc failed);
+			success = false;
+		}
+		else
+		{
+			track_ptr->pnt_arr = newArr;
+			track_ptr->arrLen *= 2;
+
+			// The points moved so relink them
+			for (i = 1; i < track_ptr->numPnts; i++)
+			{
+				track_ptr->pnt_arr[i - 1].nextPnt = &(track_ptr->pnt_arr[i]);
+			}
+		}
+	}
+
+	// ADD THE POINT
+	if (true == success)
+	{
+		retVal = &(track_ptr->pnt_arr[track_ptr->numPnts]);
+		retVal->absX = xVal;
+		retVal->absY = yVal;
+		retVal->posNum = track_ptr->numPnts + 1;
+		retVal->graphic = pntChar;
+		retVal->defGraph = pntChar;
+		retVal->hcFlags = initStatus;
+		retVal->nextPnt = NULL;
+		retVal->track_ptr = track_ptr;
+		retVal->shownGraph = 0;
+		retVal->isDirty = false;
+
+		// It's never been printed
+		mark_cartCoord_dirty(retVal);
+
+		// Link it
+		if (track_ptr->numPnts > 0)
+		{
+			track_ptr->pnt_arr[track_ptr->numPnts - 1].nextPnt = retVal;
+		}
+		track_ptr->numPnts++;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+hcCartCoord_ptr get_hcTrack_head(hcTrack_ptr track_ptr)
+{
+	// LOCAL VARIABLES
+	hcCartCoord_ptr retVal = NULL;
+
+	// INPUT VALIDATION
+	if (!track_ptr || !(track_ptr->pnt_arr))
+	{
+		HARKLE_ERROR(Harklecurse, get_hcTrack_head, NULL pointer);
+	}
+	else if (track_ptr->numPnts > 0)
+	{
+		retVal = track_ptr->pnt_arr;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+hcCartCoord_ptr get_hcTrack_pnt(hcTrack_ptr track_ptr, int posNumber)
+{
+	// LOCAL VARIABLES
+	hcCartCoord_ptr retVal = NULL;
+
+	// INPUT VALIDATION
+	if (!track_ptr || !(track_ptr->pnt_arr))
+	{
+		HARKLE_ERROR(Harklecurse, get_hcTrack_pnt, NULL pointer);
+	}
+	else if (posNumber >= 1 && posNumber <= track_ptr->numPnts)
+	{
+		retVal = &(track_ptr->pnt_arr[posNumber - 1]);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool free_hcTrack_ptr(hcTrack_ptr* oldStruct_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;  // Set this to false if anything fails
+
+	// INPUT VALIDATION
+	if (NULL == oldStruct_ptr || NULL == *oldStruct_ptr)
+	{
+		HARKLE_ERROR(Harklecurse, free_hcTrack_ptr, NULL pointer);
+		retVal = false;
+	}
+	else
+	{
+		// 1. Zeroize/Free/NULL the points
+		if ((*oldStruct_ptr)->pnt_arr)
+		{
+			memset((*oldStruct_ptr)->pnt_arr, 0, (*oldStruct_ptr)->arrLen * sizeof(hcCartCoord));
+			free((*oldStruct_ptr)->pnt_arr);
+			(*oldStruct_ptr)->pnt_arr = NULL;
+		}
+		(*oldStruct_ptr)->numPnts = 0;
+		(*oldStruct_ptr)->arrLen = 0;
+
+		// 2. Free/NULL the dirty points
+		free((*oldStruct_ptr)->dirty_arr);
+		(*oldStruct_ptr)->dirty_arr = NULL;
+		(*oldStruct_ptr)->numDirty = 0;
+
+		// 3. Free/NULL the track
+		free(*oldStruct_ptr);
+		*oldStruct_ptr = NULL;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+//////////////////////// CARTESIAN TRACK STRUCT STOP /////////////////////////
+
 ///////////////////////// NCURSES WINDOW STRUCT START ////////////////////////
 
 
@@ -552,6 +875,98 @@ bool kill_a_winDetails_ptr(winDetails_ptr* oldStruct_ptr)
 
 ///////////////////////// NCURSES WINDOW STRUCT STOP /////////////////////////
 
+////////////////////////// FRAME TIMER STRUCT START //////////////////////////
+
+
+hcFrameTimer_ptr create_hcFrameTimer_ptr(int maxFps)
+{
+	// LOCAL VARIABLES
+	hcFrameTimer_ptr retVal = NULL;
+	int numTries = 0;  // Number of allocation attempts
+
+	// INPUT VALIDATION
+	if (maxFps < 0)
+	{
+		HARKLE_ERROR(Harklecurse, create_hcFrameTimer_ptr, Invalid maxFps);
+	}
+	else
+	{
+		// ALLOCATION
+		while (numTries < HARKLECURSE_MAX_TRIES && NULL == retVal)
+		{
+			retVal = (hcFrameTimer_ptr)calloc(1, sizeof(hcFrameTimer));
+			numTries++;
+		}
+
+		if (NULL == retVal)
+		{
+			HARKLE_ERROR(Harklecurse, create_hcFrameTimer_ptr, calloc failed);
+		}
+		else if (maxFps > 0)
+		{
+			retVal->minFrameNs = HC_NSEC_PER_SEC / maxFps;
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool frame_is_due(hcFrameTimer_ptr timer_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;  // Frames are due unless the cap says otherwise
+	struct timespec now = { 0 };  // Current time
+
+	// INPUT VALIDATION
+	if (!timer_ptr)
+	{
+		HARKLE_ERROR(Harklecurse, frame_is_due, NULL pointer);
+	}
+	// CHECK THE CAP
+	else if (timer_ptr->numFrames > 0 && timer_ptr->minFrameNs > 0)
+	{
+		clock_gettime(CLOCK_MONOTONIC, &now);
+
+		if (hc_elapsed_ns(&(timer_ptr->lastFrame), &now) < timer_ptr->minFrameNs)
+		{
+			timer_ptr->numSkipped++;
+			retVal = false;
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool free_hcFrameTimer_ptr(hcFrameTimer_ptr* oldStruct_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+
+	// INPUT VALIDATION
+	if (!oldStruct_ptr || NULL == *oldStruct_ptr)
+	{
+		HARKLE_ERROR(Harklecurse, free_hcFrameTimer_ptr, NULL pointer);
+		retVal = false;
+	}
+	else
+	{
+		// ZEROIZE/FREE/NULL
+		memset(*oldStruct_ptr, 0, sizeof(hcFrameTimer));
+		free(*oldStruct_ptr);
+		*oldStruct_ptr = NULL;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+/////////////////////////// FRAME TIMER STRUCT STOP ///////////////////////////
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// STRUCT FUNCTIONS STOP ////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -711,6 +1126,7 @@ bool print_plot_list(WINDOW* currWin, hcCartCoord_ptr headNode)
 	// LOCAL VARIABLES
 	bool retVal = true;  // If anything fails, make this false
 	hcCartCoord_ptr currNode = NULL;  // Current node being printed
+	hcCartCoord_ptr lastNode = NULL;  // Last point on headNode's track, if any
 
 	// INPUT VALIDATION
 	if (NULL == currWin || NULL == headNode)
@@ -723,6 +1139,33 @@ bool print_plot_list(WINDOW* currWin, hcCartCoord_ptr headNode)
 		currNode = headNode;
 	}
 
+	// WALK TRACK ARRAY
+	if (true == retVal && headNode->track_ptr)
+	{
+		lastNode = headNode->track_ptr->pnt_arr + headNode->track_ptr->numPnts;
+
+		for (; currNode < lastNode; currNode++)
+		{
+			if (OK != mvwaddch(currWin, currNode->absY, currNode->absX, currNode->graphic))
+			{
+				HARKLE_ERROR(Harklecurse, print_plot_list, mvwaddch failed);
+				retVal = false;
+				break;
+			}
+			else
+			{
+				currNode->shownGraph = currNode->graphic;
+			}
+		}
+
+		// Every point was just printed
+		if (true == retVal && headNode == headNode->track_ptr->pnt_arr)
+		{
+			clear_track_dirt(headNode->track_ptr);
+		}
+		currNode = NULL;  // Skip the linked list
+	}
+
 	// WALK LINKED LIST
 	while (currNode && true == retVal)
 	{
@@ -744,6 +1187,158 @@ bool print_plot_list(WINDOW* currWin, hcCartCoord_ptr headNode)
 }
 
 
+bool print_plot_changes(WINDOW* currWin, hcCartCoord_ptr headNode)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;  // If anything fails, make this false
+	hcTrack_ptr track_ptr = NULL;  // headNode's track
+	hcCartCoord_ptr currNode = NULL;  // Current dirty node
+	int i = 0;  // Iterating variable
+
+	// INPUT VALIDATION
+	if (NULL == currWin || NULL == headNode)
+	{
+		HARKLE_ERROR(Harklecurse, print_plot_changes, NULL pointer);
+		retVal = false;
+	}
+	else if (NULL == headNode->track_ptr)
+	{
+		// Nothing is tracked so print everything
+		retVal = print_plot_list(currWin, headNode);
+	}
+	else
+	{
+		track_ptr = headNode->track_ptr;
+	}
+
+	// PRINT THE DIRTY POINTS
+	if (true == retVal && track_ptr)
+	{
+		for (i = 0; i < track_ptr->numDirty; i++)
+		{
+			currNode = &(track_ptr->pnt_arr[track_ptr->dirty_arr[i]]);
+
+			if (currNode->graphic != currNode->shownGraph)
+			{
+				if (OK != mvwaddch(currWin, currNode->absY, currNode->absX, currNode->graphic))
+				{
+					HARKLE_ERROR(Harklecurse, print_plot_changes, mvwaddch failed);
+					retVal = false;
+					break;
+				}
+				else
+				{
+					currNode->shownGraph = currNode->graphic;
+				}
+			}
+			currNode->isDirty = false;
+		}
+
+		// Keep whatever wasn't printed
+		if (false == retVal)
+		{
+			memmove(track_ptr->dirty_arr, track_ptr->dirty_arr + i, \
+			        (track_ptr->numDirty - i) * sizeof(int));
+			track_ptr->numDirty -= i;
+		}
+		else
+		{
+			track_ptr->numDirty = 0;
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+int present_frame(hcFrameTimer_ptr timer_ptr, WINDOW** win_arr)
+{
+	// LOCAL VARIABLES
+	int retVal = OK;  // Function's return value
+	struct timespec frameStart = { 0 };  // Time the frame started
+	struct timespec frameStop = { 0 };  // Time the frame was on the terminal
+	WINDOW** currWin_ptr = win_arr;  // Current WINDOW
+
+	// INPUT VALIDATION
+	if (!timer_ptr || !win_arr)
+	{
+		HARKLE_ERROR(Harklecurse, present_frame, NULL pointer);
+		retVal = ERR;
+	}
+	else
+	{
+		clock_gettime(CLOCK_MONOTONIC, &frameStart);
+	}
+
+	// 1. Copy the WINDOWs to the virtual screen
+	while (OK == retVal && *currWin_ptr)
+	{
+		retVal = wnoutrefresh(*currWin_ptr);
+
+		if (OK != retVal)
+		{
+			HARKLE_ERROR(Harklecurse, present_frame, wnoutrefresh failed);
+		}
+		currWin_ptr++;
+	}
+
+	// 2. Update the terminal
+	if (OK == retVal)
+	{
+		retVal = doupdate();
+
+		if (OK != retVal)
+		{
+			HARKLE_ERROR(Harklecurse, present_frame, doupdate failed);
+		}
+	}
+
+	// 3. Time the frame
+	if (OK == retVal)
+	{
+		clock_gettime(CLOCK_MONOTONIC, &frameStop);
+		timer_ptr->lastFrame = frameStart;
+		timer_ptr->lastFrameNs = hc_elapsed_ns(&frameStart, &frameStop);
+		timer_ptr->totalFrameNs += timer_ptr->lastFrameNs;
+		timer_ptr->numFrames++;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// NCURSES FUNCTIONS STOP ///////////////////////////
 //////////////////////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////// LOCAL HELPER FUNCTIONS START ////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+long hc_elapsed_ns(const struct timespec* start_ptr, const struct timespec* stop_ptr)
+{
+	return ((stop_ptr->tv_sec - start_ptr->tv_sec) * HC_NSEC_PER_SEC) + \
+	       (stop_ptr->tv_nsec - start_ptr->tv_nsec);
+}
+
+
+void clear_track_dirt(hcTrack_ptr track_ptr)
+{
+	// LOCAL VARIABLES
+	int i = 0;  // Iterating variable
+
+	for (i = 0; i < track_ptr->numDirty; i++)
+	{
+		track_ptr->pnt_arr[track_ptr->dirty_arr[i]].isDirty = false;
+	}
+	track_ptr->numDirty = 0;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+///////////////////////// LOCAL HELPER FUNCTIONS STOP ////////////////////////
+//////////////////////////////////////////////////////////////////////////////
@@ -3,6 +3,7 @@
 
 #include <ncurses.h>			// WINDOW
 #include <stdbool.h>			// bool, true, false
+#include <time.h>				// struct timespec
 
 // This struct defines details about an ncurses window
 typedef struct hCurseWinDetails
@@ -14,6 +15,17 @@ typedef struct hCurseWinDetails
 	int leftC;			// Left most column
 } winDetails, *winDetails_ptr;
 
+// This struct paces and times the frames presented to the terminal
+typedef struct hCurseFrameTimer
+{
+	long minFrameNs;				// Shortest time between frames, 0 for no cap
+	struct timespec lastFrame;		// When the last frame was presented
+	unsigned long numFrames;		// Number of frames presented
+	unsigned long numSkipped;		// Number of times frame_is_due() said to wait
+	long lastFrameNs;				// Time spent presenting the last frame
+	long long totalFrameNs;			// Time spent presenting every frame
+} hcFrameTimer, *hcFrameTimer_ptr;
+
 // This struct defines details about an absolute cartesian coordinate to
 //	plot in an ncurses window
 typedef struct hcCartesianCoordinate
@@ -25,8 +37,23 @@ typedef struct hcCartesianCoordinate
 	char defGraph;							// Original character to print at this coordinate
 	unsigned long hcFlags;					// Implementation-defined coordinate details
 	struct hcCartesianCoordinate* nextPnt;  // Next node in the linked list
+	struct hcCartesianTrack* track_ptr;		// Track holding this node, if any
+	char shownGraph;						// Character last printed here (tracks only)
+	bool isDirty;							// In its track's dirty_arr
 } hcCartCoord, *hcCartCoord_ptr;
 
+// This struct holds a track's hcCartesianCoordinate structs in one contiguous
+//	array, in order.  The nodes are still linked by nextPnt so any function
+//	that takes a linked list will take a track's head node (see: get_hcTrack_head()).
+typedef struct hcCartesianTrack
+{
+	hcCartCoord_ptr pnt_arr;				// Track points, pnt_arr[i].posNum == i + 1
+	int numPnts;							// Number of points in use
+	int arrLen;								// Number of points allocated
+	int* dirty_arr;							// pnt_arr indices changed since the last print
+	int numDirty;							// Number of indices in dirty_arr
+} hcTrack, *hcTrack_ptr;
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// STRUCT FUNCTIONS START ///////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -84,6 +111,7 @@ hcCartCoord_ptr build_new_cartCoord_struct(int xVal, int yVal, char pntChar, uns
 			to the end.
 		Take care not to lose the pointer to your head node in case this function experiences
 			an error.  PRO TIP: Use a temp variable to store this function's return value.
+		This function will not add nodes to a hcCartesianTrack (see: append_hcTrack_pnt())
  */
 hcCartCoord_ptr add_cartCoord_node(hcCartCoord_ptr headPnt, hcCartCoord_ptr newPnt, int pntPos);
 
@@ -125,6 +153,8 @@ int number_cartCoord_nodes(hcCartCoord_ptr headPnt);
 			free_cartCoord_struct(&myCartCoord_ptr);
 		This function will recursively attempt to free any nextPnt pointers it finds.
 		Alos, this function will recursively attempt to free any nextPnt pointers it finds.
+		If *oldStruct_ptr is the head node of a hcCartesianTrack, the whole track is freed
+			(see: free_hcTrack_ptr()).  Any other track node can not be freed on its own.
  */
 bool free_cartCoord_struct(hcCartCoord_ptr* oldStruct_ptr);
 
@@ -160,12 +190,104 @@ bool free_cardCoord_linked_list(hcCartCoord_ptr* oldHeadNode_ptr);
 		This function will NOT return the posNumber-th node.  It will search
 			for a posNum match to posNumber.
 		This function will return the first matching node it comes across
+		If startPnt belongs to a hcCartesianTrack, the node is indexed instead
+			of searched for
  */
 hcCartCoord_ptr get_pos_num(hcCartCoord_ptr startPnt, int posNumber);
 
 
+/*
+	PURPOSE - Flag a hcCartesianCoordinate struct as changed so the next
+		print_plot_changes() looks at it
+	INPUT
+		hcCoord - Pointer to a hcCartesianCoordinate struct
+	OUTPUT
+		On success, true
+		On failure, false
+	NOTES
+		Only track nodes are tracked.  Marking any other node does nothing
+			since print_plot_changes() prints those all anyway.
+		Marking a node more than once per frame is harmless
+ */
+bool mark_cartCoord_dirty(hcCartCoord_ptr hcCoord);
+
+
 ////////////////////// CARTESIAN COORDINATE STRUCT STOP //////////////////////
 
+//////////////////////// CARTESIAN TRACK STRUCT START ////////////////////////
+
+
+/*
+	PURPOSE - Allocate a hcCartesianTrack struct with room for numPnts points
+	INPUT
+		numPnts - Number of points to allocate room for.  The track grows past
+			this if it must.
+	OUTPUT
+		On success, pointer to an empty hcCartesianTrack struct on the heap
+		On failure, NULL
+	NOTES
+		It is the caller's responsibility to free the memory allocated by this
+			function call (see: free_hcTrack_ptr())
+ */
+hcTrack_ptr create_hcTrack_ptr(int numPnts);
+
+
+/*
+	PURPOSE - Add a new point to the end of a track
+	INPUT
+		track_ptr - Pointer to a hcCartesianTrack struct
+		xVal - Absolute, from the ncurse window's top left, x coordinate of this point
+		yVal - Absolute, from the ncurse window's top left, y coordinate of this point
+		pntChar - The character to print at coordinate (xVal, yVal)
+		initStatus - Initial value of the implementation-defined flags available for this point
+	OUTPUT
+		On success, pointer to the new point, already numbered, linked and dirty
+		On failure, NULL
+	NOTES
+		O(1), unless the track has to grow.  Growing moves the points so any
+			hcCartCoord_ptr previously taken from this track must be fetched again.
+ */
+hcCartCoord_ptr append_hcTrack_pnt(hcTrack_ptr track_ptr, int xVal, int yVal, char pntChar, unsigned long initStatus);
+
+
+/*
+	PURPOSE - Get the head node of the linked list view of a track
+	INPUT
+		track_ptr - Pointer to a hcCartesianTrack struct
+	OUTPUT
+		On success, pointer to the first point on the track
+		On failure, or if the track is empty, NULL
+ */
+hcCartCoord_ptr get_hcTrack_head(hcTrack_ptr track_ptr);
+
+
+/*
+	PURPOSE - Get a track's point by position number, in O(1)
+	INPUT
+		track_ptr - Pointer to a hcCartesianTrack struct
+		posNumber - The position number to get, starting at 1
+	OUTPUT
+		On success, hcCartesianCoordinate struct pointer to the posNumber-th point
+		On failure, NULL
+ */
+hcCartCoord_ptr get_hcTrack_pnt(hcTrack_ptr track_ptr, int posNumber);
+
+
+/*
+	PURPOSE - Zeroize, free, and NULL a hcCartesianTrack struct and all of its points
+	INPUT
+		oldStruct_ptr - A pointer to a hcCartesianTrack struct pointer
+	OUTPUT
+		On success, true
+		On failure, false
+	NOTES
+		Call this function as free_hcTrack_ptr(&myTrack_ptr);
+ */
+bool free_hcTrack_ptr(hcTrack_ptr* oldStruct_ptr);
+
+
+//////////////////////// CARTESIAN TRACK STRUCT STOP /////////////////////////
+
 ///////////////////////// NCURSES WINDOW STRUCT START ////////////////////////
 
 
@@ -218,6 +340,49 @@ bool kill_a_winDetails_ptr(winDetails_ptr* oldStruct_ptr);
 
 ///////////////////////// NCURSES WINDOW STRUCT STOP /////////////////////////
 
+////////////////////////// FRAME TIMER STRUCT START //////////////////////////
+
+
+/*
+	PURPOSE - Allocate a hCurseFrameTimer struct
+	INPUT
+		maxFps - Most frames to present per second, 0 for no cap
+	OUTPUT
+		On success, pointer to a hCurseFrameTimer struct on the heap
+		On failure, NULL
+	NOTES
+		It is the caller's responsibility to free the memory allocated here
+			(see: free_hcFrameTimer_ptr())
+ */
+hcFrameTimer_ptr create_hcFrameTimer_ptr(int maxFps);
+
+
+/*
+	PURPOSE - Determine if enough time has passed to present another frame
+	INPUT
+		timer_ptr - Pointer to a hCurseFrameTimer struct
+	OUTPUT
+		true if a frame is due, false if the frame rate cap says to wait
+	NOTES
+		The first frame is always due
+		Every false is counted in numSkipped
+ */
+bool frame_is_due(hcFrameTimer_ptr timer_ptr);
+
+
+/*
+	PURPOSE - Zeroize, free, and NULL a hCurseFrameTimer struct pointer
+	INPUT
+		oldStruct_ptr - A pointer to a hCurseFrameTimer struct pointer
+	OUTPUT
+		On success, true
+		On failure, false
+ */
+bool free_hcFrameTimer_ptr(hcFrameTimer_ptr* oldStruct_ptr);
+
+
+/////////////////////////// FRAME TIMER STRUCT STOP ///////////////////////////
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// STRUCT FUNCTIONS STOP ////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -264,10 +429,48 @@ int kill_a_window(WINDOW** oldWin_ptr);
 	OUTPUT
 		On success, true
 		On failure, false
+	NOTES
+		If headNode belongs to a hcCartesianTrack, the track's array is printed
+			in order instead of walking the linked list.  Printing from the
+			track's head also clears its dirty points.
  */
 bool print_plot_list(WINDOW* currWin, hcCartCoord_ptr headNode);
 
 
+/*
+	PURPOSE - Print only the cartCoord nodes whose graphic changed since they
+		were last printed into a given ncurses WINDOW
+	INPUT
+		currWin - Pointer to a WINDOW object
+		headNode - Head node to a linked list of hcCartesianCoordinate structs
+	OUTPUT
+		On success, true
+		On failure, false
+	NOTES
+		Track nodes are only visited if they were marked (see: mark_cartCoord_dirty())
+			and only printed if their graphic differs from their shownGraph.
+			This covers the entire track, regardless of where headNode is.
+		Any other linked list is handed to print_plot_list()
+		This function will not call wrefresh() (see: present_frame())
+ */
+bool print_plot_changes(WINDOW* currWin, hcCartCoord_ptr headNode);
+
+
+/*
+	PURPOSE - Copy each WINDOW to the virtual screen and update the terminal once
+	INPUT
+		timer_ptr - Pointer to a hCurseFrameTimer struct to record the frame in
+		win_arr - NULL-terminated array of WINDOW pointers
+	OUTPUT
+		On success, ncurses.h macro OK
+		On failure, error value from ncurses (!OK)
+	NOTES
+		Calls wnoutrefresh() on each WINDOW and doupdate() once
+		Presents the frame whether or not it is due (see: frame_is_due())
+ */
+int present_frame(hcFrameTimer_ptr timer_ptr, WINDOW** win_arr);
+
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// NCURSES FUNCTIONS STOP ///////////////////////////
 //////////////////////////////////////////////////////////////////////////////
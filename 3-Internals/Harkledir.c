@@ -1,17 +1,23 @@
-#include <dirent.h>		// opendir
+#include <dirent.h>		// DT_* MACROS, IFTODT()
 #include <errno.h>
+#include <fcntl.h>		// open(), openat(), AT_SYMLINK_NOFOLLOW
 #include "Fileroad.h"	// size_a_file
+#include <fnmatch.h>	// fnmatch()
 #include "Harkledir.h"
 #include "Harklerror.h"	// HARKLE_ERROR
 #include <inttypes.h>	// intmax_t
 #include <limits.h>		// UCHAR_MAX
-#include "Memoroad.h"	// release_a_string
+#include "Memoroad.h"	// release_a_string, create_mem_str_set, get_thread_count
+#include <pthread.h>	// pthread_create(), pthread_mutex_*()
 #include <stdbool.h>	// bool, true, false
+#include <stdint.h>		// uint64_t, int64_t
 #include <stdio.h>
 #include <stdlib.h>		// calloc, realloc 
 #include <string.h>		// memset, strncpy
+#include <sys/stat.h>	// fstatat()
+#include <sys/syscall.h>	// SYS_getdents64
 #include <sys/types.h>	// ino_t
-#include <unistd.h>		// readlink
+#include <unistd.h>		// readlink, syscall
 
 #ifndef HDIR_MAX_TRIES
 // MACRO to limit repeated allocation attempts
@@ -19,10 +25,45 @@
 #endif  // HDIR_MAX_TRIES
 
 #ifndef HDIR_ARRAY_LEN
-// MACRO to determinte how many indices are realloc()'d in the struct arrays
+// MACRO to determine the starting number of entries in hdEnt_arr (it doubles from there)
 #define HDIR_ARRAY_LEN 10
 #endif  // HDIR_ARRAY_LEN
 
+#ifndef HDIR_DENTS_BUFF
+// MACRO to determine the default size of a harkleDirStream's getdents64 buffer
+#define HDIR_DENTS_BUFF (256 * 1024)
+#endif  // HDIR_DENTS_BUFF
+
+#ifndef HDIR_WALK_MAX_THREADS
+// MACRO to limit the number of walk_dir_tree() worker threads
+#define HDIR_WALK_MAX_THREADS 16
+#endif  // HDIR_WALK_MAX_THREADS
+
+#ifndef HDIR_WALK_MAX_OPEN
+// MACRO to limit the number of queued directories walk_dir_tree() holds open
+#define HDIR_WALK_MAX_OPEN 256
+#endif  // HDIR_WALK_MAX_OPEN
+
+#ifndef HDIR_LINK_CACHE_SIZE
+// MACRO to determine the default number of slots in a harkleLinkCache (it doubles from there)
+#define HDIR_LINK_CACHE_SIZE 256
+#endif  // HDIR_LINK_CACHE_SIZE
+
+#ifndef HDIR_LINK_MAX_THREADS
+// MACRO to limit the number of resolve_dirDetails_links() worker threads
+#define HDIR_LINK_MAX_THREADS 8
+#endif  // HDIR_LINK_MAX_THREADS
+
+#ifndef HDIR_LINK_MIN_PER_THREAD
+// MACRO to keep small directories from paying for threads they don't need
+#define HDIR_LINK_MIN_PER_THREAD 64
+#endif  // HDIR_LINK_MIN_PER_THREAD
+
+#ifndef HDIR_POOL_SIZE
+// MACRO to determine the starting size of strPool (it doubles from there)
+#define HDIR_POOL_SIZE 4096
+#endif  // HDIR_POOL_SIZE
+
 #ifndef HDIR_BIG_BUFF_SIZE
 // MACRO to standardize large buffer allocation
 #define HDIR_BIG_BUFF_SIZE 4096
@@ -36,6 +77,74 @@
 #define HARKLE_ERROR(header, funcName, msg) do { fprintf(stderr, "<<<ERROR>>> - %s - %s() - %s!\n", #header, #funcName, #msg); } while (0);
 #endif // HARKLE_ERROR
 
+// Layout of the records returned by getdents64
+typedef struct harkleDirent64
+{
+	uint64_t d_ino;				// Inode number
+	int64_t d_off;				// Offset to the next record
+	unsigned short d_reclen;	// Size of this record
+	unsigned char d_type;		// File type
+	char d_name[];				// Nul-terminated filename
+} hdDirent64, *hdDirent64_ptr;
+
+// A directory waiting to be read by walk_dir_tree()
+typedef struct harkleWalkTask
+{
+	char* path;					// Heap-allocated path of the directory
+	int dirFD;					// Already opened relative to its parent, -1 to open by path
+	int depth;					// hw_depth of the entries inside this directory
+} hwTask, *hwTask_ptr;
+
+// One walk_dir_tree() worker's deque: the owner uses the bottom, thieves the top
+typedef struct harkleWalkDeque
+{
+	pthread_mutex_t lock;		// Guards everything below
+	hwTask_ptr task_arr;		// Tasks [top, bottom) are queued
+	size_t top;					// Oldest task (stolen first)
+	size_t bottom;				// One past the newest task (popped first)
+	size_t arrLen;				// Number of tasks task_arr can hold
+} hwDeque, *hwDeque_ptr;
+
+// State shared between walk_dir_tree() and its workers
+typedef struct harkleWalkDetails
+{
+	hwDeque_ptr deque_arr;		// One deque per worker
+	int numWorkers;				// Number of deques
+	hdFilter filter;			// What to report
+	hdWalkCallback callback;	// Where to report it
+	void* userData;				// Passed through to callback
+	size_t pending;				// Directories queued or being read (atomic)
+	size_t numReported;			// Entries reported (atomic)
+	int numOpenFDs;				// Task descriptors held open (atomic)
+	bool stop;					// Set when callback asks to stop (atomic)
+	int firstErr;				// First errno encountered (atomic)
+	pthread_mutex_t idleLock;	// Guards waits on idleCond
+	pthread_cond_t idleCond;	// Idle workers wait here for a task or the end of the walk
+	size_t workSeq;				// Bumped whenever a task is queued or pending hits 0 (atomic)
+	int numIdle;				// Workers waiting on idleCond (atomic)
+} hwWalk, *hwWalk_ptr;
+
+// A walk_dir_tree() worker thread's identity
+typedef struct harkleWalkWorker
+{
+	hwWalk_ptr walk_ptr;		// Shared state
+	int workerID;				// Index of this worker's deque
+} hwWorker, *hwWorker_ptr;
+
+// State shared between resolve_links_at() and its workers
+typedef struct harkleLinkScan
+{
+	dirDetails_ptr dir_ptr;		// Entries to resolve (strPool is read-only while scanning)
+	int dirFD;					// Open directory to readlinkat() relative to
+	dev_t dirDev;				// Device of dirFD, half of the cache key
+	hdLinkCache_ptr cache_ptr;	// Where link text is looked up and interned
+	size_t* todo_arr;			// hdEnt_arr indices of the links to resolve
+	const char** target_arr;	// [OUT] Interned link text, parallel to todo_arr
+	size_t numTodo;				// Number of entries in todo_arr
+	size_t nextTodo;			// Next todo_arr index to claim (atomic)
+	int firstErr;				// First errno encountered (atomic)
+} hlScan, *hlScan_ptr;
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////// LOCAL FUNCTION PROTOTYPES START //////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -45,34 +154,84 @@
 	Purpose - Coordinate the population of the fileName and dirName arrays
 	Input
 		updateThis_ptr - directoryDetails pointer to populate
-		fileArrSize - A pointer to the actual size of the fileName_arr in memory
-		dirArrSize - A pointer to the actual size of the dirName_arr in memory
+		cache_ptr - Optional.  Link cache to resolve symbolic links through.
+		numThreads - Number of threads to resolve symbolic links with
 	Output - true on success, false on failure
 	Notes:
-		This function calls populate_dirDetails_arrays()
-		This function does not currently support the following file types:
+		Reads the directory with a harkleDirStream (see: open_dir_stream())
+		This function calls populate_dirDetails_arrays() for each entry,
+			resolve_links_at() once the directory has been read, and then
+			index_dirDetails()
+		This function does not currently store the following file types:
 			Character device
 			Block device
 			FIFO(named pipe)
-			Symbolic link
 			Socket
-		The array sizes may be updated as realloc() may be called
  */
-bool populate_dirDetails(dirDetails_ptr updateThis_ptr);
+bool populate_dirDetails(dirDetails_ptr updateThis_ptr, hdLinkCache_ptr cache_ptr, int numThreads);
 
 
 /*
-	Purpose - Coordinates array allocation and string copies of filenames 
-		into a directoryDetails pointer
+	Purpose - Append a directory entry to a directoryDetails' hdEnt_arr and
+		its strings to the strPool
 	Input
 		updateThis_ptr - directoryDetails pointer to populate
-		fileEntry - dirent struct pointer of a directory entry identified as a file
-		absPath - nul-terminated absolute path to the file at *currDirEntry
+		entryName - Nul-terminated name of the directory entry
+		entryType - DT_* file type of the directory entry
+		entryInode - Inode number of the directory entry
+		dirPrefix - nul-terminated absolute directory path, with a trailing slash
+		prefixLen - Length of dirPrefix
+	Output - true on success, false on failure
+	Notes:
+		hdEnt_arr and strPool double as necessary, so the entries only record
+			offsets into strPool until index_dirDetails() is called
+		Symbolic links are not resolved here (see: resolve_links_at())
+ */
+bool populate_dirDetails_arrays(dirDetails_ptr updateThis_ptr, const char* entryName, unsigned char entryType, ino_t entryInode, \
+	                            char* dirPrefix, size_t prefixLen);
+
+
+/*
+	Purpose - Copy a string into a directoryDetails' strPool
+	Input
+		updateThis_ptr - directoryDetails pointer whose strPool to append to
+		str_ptr - String to copy in
+		strLen - Length of str_ptr
+	Output - Offset of the nul-terminated copy on success, 0 on failure
+ */
+size_t append_to_str_pool(dirDetails_ptr updateThis_ptr, const char* str_ptr, size_t strLen);
+
+
+/*
+	Purpose - The compatibility layer: build fileName_arr and dirName_arr from
+		hdEnt_arr and resolve each entry's strPool offsets into pointers
+	Input
+		updateThis_ptr - directoryDetails pointer that has been populated
 	Output - true on success, false on failure
+ */
+bool index_dirDetails(dirDetails_ptr updateThis_ptr);
+
+
+/*
+	Purpose - Point every entry's hd_Name, hd_AbsName, and hd_symName at its strPool offset
+	Input
+		updateThis_ptr - directoryDetails pointer that has been populated
 	Notes:
-		The array sizes may be updated as realloc() may be called
+		Called again whenever strPool may have moved
+ */
+void point_dirDetails_strings(dirDetails_ptr updateThis_ptr);
+
+
+/*
+	Purpose - Format a directory name the way os_path_join() does: leading
+		slash, no doubled slashes, trailing slash
+	Input
+		dirName - Directory name
+		buff - [OUT] Destination
+		buffSize - Size of buff
+	Output - Length of the string written to buff on success, 0 on failure
  */
-bool populate_dirDetails_arrays(dirDetails_ptr updateThis_ptr, struct dirent* fileEntry, char* absPath);
+size_t build_dir_prefix(char* dirName, char* buff, size_t buffSize);
 
 
 /*
@@ -92,6 +251,134 @@ bool populate_dirDetails_arrays(dirDetails_ptr updateThis_ptr, struct dirent* fi
 bool keep_hdEntry(unsigned char hdEntryType, unsigned int typeFlags);
 
 
+/*
+	Purpose - walk_dir_tree() worker thread start routine
+	Input - An hwWorker_ptr
+	Output - NULL
+	Notes:
+		Pops directories from its own deque, steals from the others when
+			it's empty, sleeps on idleCond when there's nothing to steal,
+			and returns once no directories are pending
+		Also called directly by walk_dir_tree() as worker 0
+ */
+void* walk_dir_worker(void* worker_ptr);
+
+
+/*
+	Purpose - Read one directory for walk_dir_tree(): report its entries and
+		queue its subdirectories on the worker's deque
+	Input
+		walk_ptr - Shared state
+		workerID - Index of the calling worker's deque
+		task_ptr - Directory to read (its dirFD is consumed)
+		buff_ptr - getdents64 buffer of HDIR_DENTS_BUFF bytes
+		pathBuff - Buffer of PATH_MAX + 1 bytes to build entry paths in
+ */
+void walk_one_dir(hwWalk_ptr walk_ptr, int workerID, hwTask_ptr task_ptr, char* buff_ptr, char* pathBuff);
+
+
+/*
+	Purpose - Push a task onto the bottom of a deque, growing it as necessary
+	Output - true on success, false if the deque could not grow
+ */
+bool push_walk_task(hwDeque_ptr deque_ptr, hwTask_ptr task_ptr);
+
+
+/*
+	Purpose - Take a task from a deque
+	Input
+		deque_ptr - Deque to take from
+		task_ptr - [OUT] The task
+		steal - If true, take the oldest task (top).  Otherwise, the newest (bottom).
+	Output - true if a task was taken, false if the deque was empty
+ */
+bool pop_walk_task(hwDeque_ptr deque_ptr, hwTask_ptr task_ptr, bool steal);
+
+
+/*
+	Purpose - Record the first errno a walk_dir_tree() worker runs into
+ */
+void record_walk_error(hwWalk_ptr walk_ptr, int errNum);
+
+
+/*
+	Purpose - Tell idle walk_dir_tree() workers something changed
+	Input
+		walk_ptr - Shared state
+		everyone - If true, wake every idle worker (e.g., the walk is done).
+			Otherwise, wake one (e.g., one task was queued).
+	Notes:
+		Only takes idleLock if a worker is (or is about to be) waiting
+ */
+void wake_walk_workers(hwWalk_ptr walk_ptr, bool everyone);
+
+
+/*
+	Purpose - Resolve every unresolved symbolic link in a directoryDetails
+		relative to an already open directory
+	Input
+		updateThis_ptr - directoryDetails pointer to update
+		dirFD - Open file descriptor of updateThis_ptr->dirName
+		cache_ptr - Optional.  If NULL, a temporary cache is used.
+		numThreads - Number of threads to resolve with, 0 for one-per-CPU
+	Output - true on success, false on failure
+	Notes:
+		Workers only read strPool.  The link text is appended to strPool
+			afterwards, by this thread, so hd_symNameOff is set but the
+			entries' pointers are not (see: point_dirDetails_strings()).
+ */
+bool resolve_links_at(dirDetails_ptr updateThis_ptr, int dirFD, hdLinkCache_ptr cache_ptr, int numThreads);
+
+
+/*
+	Purpose - resolve_links_at() worker thread start routine
+	Input - An hlScan_ptr
+	Output - NULL
+	Notes:
+		Claims todo_arr entries with an atomic counter until none are left
+		Also called directly by resolve_links_at()
+ */
+void* hdir_link_worker(void* scan_ptr);
+
+
+/*
+	Purpose - Find the slot for a (dev, inode) key in a link cache
+	Input
+		cache_ptr - Link cache to search, already locked
+		devNum - Device of the link
+		inodeNum - Inode of the link
+	Output - The key's slot if it's cached, otherwise the empty slot it belongs in
+ */
+hlSlot_ptr find_link_slot(hdLinkCache_ptr cache_ptr, dev_t devNum, ino_t inodeNum);
+
+
+/*
+	Purpose - Intern a link's text and record it under its (dev, inode) key
+	Input
+		cache_ptr - Link cache to update, not locked
+		devNum - Device of the link
+		inodeNum - Inode of the link, 0 to intern without recording the key
+		target - Nul-terminated link text
+	Output - The interned link text on success, NULL on failure
+ */
+const char* cache_link_target(hdLinkCache_ptr cache_ptr, dev_t devNum, ino_t inodeNum, const char* target);
+
+
+/*
+	Purpose - Double a link cache's slot_arr and rehash its contents
+	Input
+		cache_ptr - Link cache to grow, already locked
+	Output - true on success, false on failure (the cache is unchanged)
+ */
+bool grow_link_cache(hdLinkCache_ptr cache_ptr);
+
+
+/*
+	Purpose - Mix a (dev, inode) key into a slot_arr index
+ */
+uint64_t hash_link_key(dev_t devNum, ino_t inodeNum);
+
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////// LOCAL FUNCTION PROTOTYPES STOP ///////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -358,9 +645,9 @@ dirDetails_ptr create_dirDetails_ptr(void)
     // LOCAL VARIABLES
     dirDetails_ptr retVal = NULL;
 	int numTries = 0;
-	bool success = true;  // If anything fails, make this false
 
 	// ALLOCATE MEMORY
+	// The arrays and string pool are allocated as entries are read
 	while(numTries < HDIR_MAX_TRIES && retVal == NULL)
 	{
 		retVal = (dirDetails_ptr)calloc(1, sizeof(dirDetails));
@@ -370,58 +657,7 @@ dirDetails_ptr create_dirDetails_ptr(void)
     if (!retVal)
     {
 		HARKLE_ERROR(Harkledir, create_dirDetails_ptr, dirDetails_ptr calloc failed);
-		success = false;
     }
-	else
-	{
-		// ALLOCATE THE ARRAYS
-		// fileName_arr
-		numTries = 0;
-		while(numTries < HDIR_MAX_TRIES && retVal->fileName_arr == NULL)
-		{
-			retVal->fileName_arr = (hdEnt_ptr*)calloc(HDIR_ARRAY_LEN + 1, sizeof(hdEnt_ptr));
-			numTries++;
-	    }
-
-	    if (!(retVal->fileName_arr))
-	    {
-			HARKLE_ERROR(Harkledir, create_dirDetails_ptr, fileName_arr calloc failed);
-			success = false;
-	    }
-	    else
-	    {
-	    	retVal->fileArrSize = (size_t)(HDIR_ARRAY_LEN + 1) * sizeof(hdEnt_ptr);
-	    }
-	    // dirName_arr
-		numTries = 0;
-		while(numTries < HDIR_MAX_TRIES && retVal->dirName_arr == NULL)
-		{
-			retVal->dirName_arr = (hdEnt_ptr*)calloc(HDIR_ARRAY_LEN + 1, sizeof(hdEnt_ptr));
-			numTries++;
-	    }
-
-	    if (!(retVal->dirName_arr))
-	    {
-			HARKLE_ERROR(Harkledir, create_dirDetails_ptr, dirName_arr calloc failed);
-			success = false;
-	    }
-	    else
-	    {
-	    	retVal->dirArrSize = (size_t)(HDIR_ARRAY_LEN + 1) * sizeof(hdEnt_ptr);
-	    }
-	}
-	
-	// CLEAN UP
-	if (success == false)
-	{
-		if (retVal)
-		{
-			if (false == free_dirDetails_ptr(&retVal))
-			{
-				HARKLE_ERROR(Harkledir, create_dirDetails_ptr, free_dirDetails_ptr failed);
-			}
-		}
-	}
 
     // DONE
 	return retVal;
@@ -429,6 +665,12 @@ dirDetails_ptr create_dirDetails_ptr(void)
 
 
 dirDetails_ptr open_dir(char* directoryName)
+{
+	return open_dir_cached(directoryName, NULL, 1);
+}
+
+
+dirDetails_ptr open_dir_cached(char* directoryName, hdLinkCache_ptr cache_ptr, int numThreads)
 {
 	// LOCAL VARIABLES
 	bool success = true;  // Set this to false if anything fails
@@ -465,25 +707,25 @@ dirDetails_ptr open_dir(char* directoryName)
 
 		if (!(retVal->dirName))
 		{
-			HARKLE_ERROR(Harkledir, open_dir, copy_a_string failed);
+			HARKLE_ERROR(Harkledir, open_dir_cached, copy_a_string failed);
 			success = false;
 		}
 
 		// 2. Populate files & dirs
 		if (success == true)
 		{
-			popRetVal = populate_dirDetails(retVal);
+			popRetVal = populate_dirDetails(retVal, cache_ptr, numThreads);
 
 			if (popRetVal == false)
 			{
-				HARKLE_ERROR(Harkledir, open_dir, populate_dirDetails failed);
+				HARKLE_ERROR(Harkledir, open_dir_cached, populate_dirDetails failed);
 				success = false;
 			}
 		}
 	}
 	else
 	{
-		HARKLE_ERROR(Harkledir, open_dir, create_dirDetails_ptr failed);
+		HARKLE_ERROR(Harkledir, open_dir_cached, create_dirDetails_ptr failed);
 		success = false;
 	}
 
@@ -494,7 +736,7 @@ dirDetails_ptr open_dir(char* directoryName)
 		{
 			if (false == free_dirDetails_ptr(&retVal))
 			{
-				HARKLE_ERROR(Harkledir, open_dir, free_dirDetails_ptr failed);
+				HARKLE_ERROR(Harkledir, open_dir_cached, free_dirDetails_ptr failed);
 			}
 		}
 	}
@@ -543,6 +785,30 @@ bool free_dirDetails_ptr(dirDetails_ptr* oldStruct_ptr)
 				}
 			}
 
+			// 1.1. Pooled storage: the entries and their strings go in bulk
+			if (oldStruct->hdEnt_arr)
+			{
+				if (oldStruct->strPool)
+				{
+					harkleset(oldStruct->strPool, HDIR_MEMSET_DEFAULT, oldStruct->poolUsed);
+					free(oldStruct->strPool);
+					oldStruct->strPool = NULL;
+				}
+				harkleset(oldStruct->hdEnt_arr, HDIR_MEMSET_DEFAULT, oldStruct->numEnts * sizeof(hdEnt));
+				free(oldStruct->hdEnt_arr);
+				oldStruct->hdEnt_arr = NULL;
+				oldStruct->numEnts = 0;
+				oldStruct->entArrLen = 0;
+				oldStruct->poolUsed = 0;
+				oldStruct->poolSize = 0;
+
+				// fileName_arr and dirName_arr only point into hdEnt_arr
+				oldStruct->numFiles = 0;
+				oldStruct->numDirs = 0;
+				numberOfFiles = 0;
+				numberOfDirs = 0;
+			}
+
 			// 2. File Array
 			// puts("2. File Array");  // DEBUGGING
 			// 2.a. fileName_arr and all hdEnt_ptr contained within
@@ -705,6 +971,8 @@ char** parse_dirDetails_to_char_arr(dirDetails_ptr dirStruct_ptr, unsigned int t
 	int originalEntries = 0;  // Original size of tempRetVal (for free()ing)
 	int totalEntries = 0;  // Size of the tempRetVal
 	char* temp_ptr = NULL;  // Use this to dynamically search for hd_Name or hd_symName as appropriate
+	memStrSet_ptr seen_ptr = NULL;  // Names already copied in, if uniqueEntries is true
+	bool isNew = false;  // Set by str_set_add()
 	int i = 0;  // Iterating variable
 
 	// INPUT VALIDATION
@@ -776,6 +1044,12 @@ char** parse_dirDetails_to_char_arr(dirDetails_ptr dirStruct_ptr, unsigned int t
 			HARKLE_ERROR(Harkledir, parse_dirDetails_to_char_arr, get_me_a_buffer_array failed);
 			success = false;
 		}
+		// 2.1. Hash set of names seen so far (borrows the dirStruct_ptr strings)
+		else if (uniqueEntries == true && !(seen_ptr = create_mem_str_set((size_t)totalEntries, false)))
+		{
+			HARKLE_ERROR(Harkledir, parse_dirDetails_to_char_arr, create_mem_str_set failed);
+			success = false;
+		}
 		else
 		{
 			// 3. Copy in all the char*s
@@ -807,7 +1081,12 @@ char** parse_dirDetails_to_char_arr(dirDetails_ptr dirStruct_ptr, unsigned int t
 						// Does it need to be a unique entry?
 						if (uniqueEntries == true)  // Yes, it needs to be unique
 						{
-							if (-1 == search_char_arr(tempRetVal, temp_ptr))
+							if (!str_set_add(seen_ptr, temp_ptr, &isNew))
+							{
+								HARKLE_ERROR(Harkledir, parse_dirDetails_to_char_arr, str_set_add failed);
+								success = false;
+							}
+							else if (true == isNew)
 							{
 								// Add it (unique)
 								(*(tempRetVal + totalEntries)) = copy_a_string(temp_ptr);
@@ -868,7 +1147,12 @@ char** parse_dirDetails_to_char_arr(dirDetails_ptr dirStruct_ptr, unsigned int t
 						// Does it need to be a unique entry?
 						if (uniqueEntries == true)  // Yes, it needs to be unique
 						{
-							if (-1 == search_char_arr(tempRetVal, temp_ptr))
+							if (!str_set_add(seen_ptr, temp_ptr, &isNew))
+							{
+								HARKLE_ERROR(Harkledir, parse_dirDetails_to_char_arr, str_set_add failed);
+								success = false;
+							}
+							else if (true == isNew)
 							{
 								// Add it (unique)
 								(*(tempRetVal + totalEntries)) = copy_a_string(temp_ptr);
@@ -930,6 +1214,15 @@ char** parse_dirDetails_to_char_arr(dirDetails_ptr dirStruct_ptr, unsigned int t
 	}
 
 	// CLEAN UP
+	// 0. seen_ptr
+	if (seen_ptr)
+	{
+		if (false == free_mem_str_set(&seen_ptr))
+		{
+			HARKLE_ERROR(Harkledir, parse_dirDetails_to_char_arr, free_mem_str_set failed);
+		}
+	}
+
 	// 1. tempRetVal
 	if (tempRetVal)
 	{
@@ -979,15 +1272,16 @@ char** parse_dirDetails_to_char_arr(dirDetails_ptr dirStruct_ptr, unsigned int t
 //////////////////////////////////////////////////////////////////////////////
 
 
-bool populate_dirDetails(dirDetails_ptr updateThis_ptr)
+bool populate_dirDetails(dirDetails_ptr updateThis_ptr, hdLinkCache_ptr cache_ptr, int numThreads)
 {
 	// LOCAL VARIABLES
 	bool retVal = true;
-	DIR* cwd = NULL;  // Directory stream opened from dirDetails_ptr->dirName
-	struct dirent* currDirEntry = NULL;  // An entry read from directory stream cwd
-	int numTries = 0;  // Used to count allocation attempts
-	unsigned char fileType = 0;  // Return value from get_a_file_type()
-	char* absPath_ptr = NULL;  // Just in case we build an absolute path
+	hdStream dirStream = { .dirFD = -1 };  // Bulk reader for dirDetails_ptr->dirName
+	const char* entryName = NULL;  // Name of the current entry
+	unsigned char entryType = DT_UNKNOWN;  // Type of the current entry
+	ino_t entryInode = 0;  // Inode of the current entry
+	char dirPrefix[PATH_MAX + 1] = { 0 };  // Absolute directory name, with a trailing slash
+	size_t prefixLen = 0;  // Length of dirPrefix
 	int errNum = 0;  // Immediately store errno in case of error
 
 	// INPUT VALIDATION
@@ -996,41 +1290,33 @@ bool populate_dirDetails(dirDetails_ptr updateThis_ptr)
 		HARKLE_ERROR(Harkledir, populate_dirDetails, updateThis_ptr NULL pointer);
 		retVal = false;
 	}
-	else if (updateThis_ptr->fileArrSize < 1 || updateThis_ptr->fileArrSize < (HDIR_ARRAY_LEN * sizeof(hdEnt_ptr)))
-	{
-		HARKLE_ERROR(Harkledir, populate_dirDetails, fileArrSize too small);
-		retVal = false;
-	}
-	else if (updateThis_ptr->dirArrSize < 1 || updateThis_ptr->dirArrSize < (HDIR_ARRAY_LEN * sizeof(hdEnt_ptr)))
-	{
-		HARKLE_ERROR(Harkledir, populate_dirDetails, dirArrSize too small);
-		retVal = false;
-	}
 	else if (!updateThis_ptr->dirName)
 	{
 		HARKLE_ERROR(Harkledir, populate_dirDetails, dirName NULL pointer);
 		retVal = false;
 	}
-	else if (!(updateThis_ptr->fileName_arr))
+	else if (updateThis_ptr->hdEnt_arr || updateThis_ptr->fileName_arr || updateThis_ptr->dirName_arr)
 	{
-		HARKLE_ERROR(Harkledir, populate_dirDetails, fileName_arr NULL pointer);
+		HARKLE_ERROR(Harkledir, populate_dirDetails, Already populated);
 		retVal = false;
 	}
-	else if (!(updateThis_ptr->dirName_arr))
+	else
 	{
-		HARKLE_ERROR(Harkledir, populate_dirDetails, dirName_arr NULL pointer);
-		retVal = false;
+		prefixLen = build_dir_prefix(updateThis_ptr->dirName, dirPrefix, sizeof(dirPrefix));
+
+		if (0 == prefixLen)
+		{
+			HARKLE_ERROR(Harkledir, populate_dirDetails, build_dir_prefix failed);
+			retVal = false;
+		}
 	}
 
 	if (retVal == true)
 	{
 		// WALK DIR
 		// 1. Open the directory stream
-		cwd = opendir(updateThis_ptr->dirName);
-
-		if (!cwd)
+		if (false == open_dir_stream(&dirStream, updateThis_ptr->dirName, 0, &errNum))
 		{
-			errNum = errno;
 			fprintf(stderr, "Unable to open %s:\t%s\n", updateThis_ptr->dirName, strerror(errNum));
 			if (errNum == EACCES)
 			{
@@ -1041,89 +1327,48 @@ bool populate_dirDetails(dirDetails_ptr updateThis_ptr)
 		else
 		{
 			// 2. Read all of the directory entries
-			do
+			while (retVal == true && true == next_dir_entry(&dirStream, &entryName, &entryType, &entryInode, &errNum))
 			{
-				currDirEntry = readdir(cwd);
+				retVal = populate_dirDetails_arrays(updateThis_ptr, entryName, entryType, entryInode, dirPrefix, prefixLen);
+			}
 
-				if (currDirEntry)
-				{
-					// fprintf(stdout, "currDirEntry->d_name == %s\n", currDirEntry->d_name);  // DEBUGGING
-					// fprintf(stdout, "currDirEntry->d_type == %u\n", currDirEntry->d_type);  // DEBUGGING
+			if (errNum)
+			{
+				fprintf(stderr, "Unable to read directories in %s:\t%s\n", updateThis_ptr->dirName, strerror(errNum));
+				retVal = false;
+			}
+		}
+	}
 
-					switch (currDirEntry->d_type)
-					{
-						case DT_LNK:
-						case DT_REG:
-						case DT_DIR:
-						case DT_FIFO:
-						case DT_SOCK:
-						case DT_BLK:
-						case DT_CHR:
-							break;
-						case DT_UNKNOWN:
-						default:
-							// fprintf(stdout, "populate_dirDetails() found an invalid d_type of %u.\nGetting a second opinion from get_a_file_type().\n", currDirEntry->d_type);  // DEBUGGING
-							absPath_ptr = os_path_join(updateThis_ptr->dirName, currDirEntry->d_name, false);
-
-							if (absPath_ptr)
-							{
-								fileType = get_a_file_type(absPath_ptr);
+	// 3. Resolve the symbolic links in one batch, while the directory is still open
+	if (retVal == true)
+	{
+		retVal = resolve_links_at(updateThis_ptr, dirStream.dirFD, cache_ptr, numThreads);
 
-								if (fileType == UCHAR_MAX)
-								{
-									HARKLE_ERROR(Harkledir, populate_dirDetails, get_a_file_type failed);
-									retVal = false;
-								}
-								else
-								{
-									// SUCCESS!
-									// fprintf(stdout, "get_a_file_type() returned %u.\n", fileType);
-									currDirEntry->d_type = fileType;
-								}
-							}
-							else
-							{
-								HARKLE_ERROR(Harkledir, populate_dirDetails, os_path_join failed);
-								retVal = false;
-							}
-							break;
-					}
-					retVal = populate_dirDetails_arrays(updateThis_ptr, currDirEntry, updateThis_ptr->dirName);
-				}
-				else
-				{
-					errNum = errno;
-					if (errNum)
-					{
-						fprintf(stderr, "Unable to read directories in %s:\t%s\n", updateThis_ptr->dirName, strerror(errNum));
-						retVal = false;
-					}
-					else
-					{
-						// fprintf(stdout, "Done reading directories in %s.\n", updateThis_ptr->dirName);  // DEBUGGING
-					}					
-				}
-			} while (currDirEntry && retVal == true);
+		if (retVal == false)
+		{
+			HARKLE_ERROR(Harkledir, populate_dirDetails, resolve_links_at failed);
 		}
 	}
 
-	// CLEAN UP
-	if (cwd)
+	// 4. Build the compatibility arrays
+	if (retVal == true)
 	{
-		if (-1 == closedir(cwd))
+		retVal = index_dirDetails(updateThis_ptr);
+
+		if (retVal == false)
 		{
-			HARKLE_ERROR(Harkledir, populate_dirDetails, closedir failed);
+			HARKLE_ERROR(Harkledir, populate_dirDetails, index_dirDetails failed);
 		}
 	}
 
-	if (absPath_ptr)
+	// CLEAN UP
+	if (dirStream.dirFD > -1)
 	{
-		// fprintf(stdout, "Calling release_a_string(absPath_ptr == %s (%p))\n", absPath_ptr, absPath_ptr);  // DEBUGGING
-		if (false == release_a_string(&absPath_ptr))
+		if (false == close_dir_stream(&dirStream))
 		{
-			HARKLE_ERROR(Harkledir, populate_dirDetails, release_a_string failed);
-		}		
-		// fprintf(stdout, "Called  release_a_string(absPath_ptr == %s (%p))\n", absPath_ptr, absPath_ptr);  // DEBUGGING
+			HARKLE_ERROR(Harkledir, populate_dirDetails, close_dir_stream failed);
+		}
 	}
 
 	// DONE
@@ -1131,18 +1376,18 @@ bool populate_dirDetails(dirDetails_ptr updateThis_ptr)
 }
 
 
-bool populate_dirDetails_arrays(dirDetails_ptr updateThis_ptr, struct dirent* fileEntry, char* absPath)
+bool populate_dirDetails_arrays(dirDetails_ptr updateThis_ptr, const char* entryName, unsigned char entryType, ino_t entryInode, \
+	                            char* dirPrefix, size_t prefixLen)
 {
 	// LOCAL VARIABLES
 	bool retVal = true;
-	size_t necessarySize = 0;  // Current size + another entry + NULL terminator
+	bool keepIt = false;  // Only files, symlinks, and directories are stored
 	void* realloc_ptr = NULL;  // Return value from realloc
-	char* temp_ptr = NULL;  // Return value from calloc
-	hdEnt_ptr newStruct = NULL;  // Will temporarily hold new struct pointer allocation
-	// Abstract dirDetails References
-	int* numEntries_ptr = NULL;  // Pointer to the numThings member of the relevant section
-	hdEnt_ptr** abstractArr_ptr = NULL;  // Pointer to the array member of the relevant section
-	size_t* arraySize_ptr = NULL;  // Pointer to the arraySize member of the relevant section
+	size_t newLen = 0;  // New number of hdEnt structs in hdEnt_arr
+	hdEnt_ptr newEnt = NULL;  // The entry being appended
+	size_t nameLen = 0;  // Length of entryName
+	char absName[PATH_MAX + 2] = { 0 };  // Absolute filename of the entry
+	size_t absLen = 0;  // Length of absName
 
 	// INPUT VALIDATION
 	if (!updateThis_ptr)
@@ -1150,44 +1395,26 @@ bool populate_dirDetails_arrays(dirDetails_ptr updateThis_ptr, struct dirent* fi
 		HARKLE_ERROR(Harkledir, populate_dirDetails_arrays, updateThis_ptr NULL pointer);
 		retVal = false;
 	}
-	else if (!fileEntry)
+	else if (!entryName)
 	{
-		HARKLE_ERROR(Harkledir, populate_dirDetails_arrays, fileEntry NULL pointer);
+		HARKLE_ERROR(Harkledir, populate_dirDetails_arrays, entryName NULL pointer);
 		retVal = false;
 	}
-	else if (!(updateThis_ptr->fileName_arr))
-	{
-		HARKLE_ERROR(Harkledir, populate_dirDetails_arrays, fileName_arr NULL pointer);
-		retVal = false;
-	}
-	else if (!absPath)
-	{
-		HARKLE_ERROR(Harkledir, populate_dirDetails_arrays, absPath NULL pointer);
-		retVal = false;
-	}
-	else if (!(*absPath))
+	else if (!dirPrefix || prefixLen < 1)
 	{
-		HARKLE_ERROR(Harkledir, populate_dirDetails_arrays, Empty path);
+		HARKLE_ERROR(Harkledir, populate_dirDetails_arrays, Invalid dirPrefix);
 		retVal = false;
 	}
 
-	// DECIDE WHICH ARRAY TO UPDATE
+	// DECIDE WHETHER TO KEEP IT
 	if (retVal == true)
 	{
-		// fprintf(stdout, "fileEntry->d_name == %s\n", fileEntry->d_name);  // DEBUGGING
-		// fprintf(stdout, "fileEntry->d_ino == %lu\n", fileEntry->d_ino);  // DEBUGGING
-		switch (fileEntry->d_type)
+		switch (entryType)
 		{
 			case DT_LNK:
 			case DT_REG:
-				numEntries_ptr = &(updateThis_ptr->numFiles);
-				abstractArr_ptr = &(updateThis_ptr->fileName_arr);
-				arraySize_ptr = &(updateThis_ptr->fileArrSize);
-				break;
 			case DT_DIR:
-				numEntries_ptr = &(updateThis_ptr->numDirs);
-				abstractArr_ptr = &(updateThis_ptr->dirName_arr);
-				arraySize_ptr = &(updateThis_ptr->dirArrSize);
+				keepIt = true;
 				break;
 			case DT_FIFO:
 			case DT_SOCK:
@@ -1202,105 +1429,254 @@ bool populate_dirDetails_arrays(dirDetails_ptr updateThis_ptr, struct dirent* fi
 		}
 	}
 
-	// VALIDATE ARRAY
-	if (retVal == true && numEntries_ptr && abstractArr_ptr && arraySize_ptr)
+	// GROW hdEnt_arr
+	if (retVal == true && keepIt == true && updateThis_ptr->numEnts == updateThis_ptr->entArrLen)
 	{
-		// 1. Calculate necessary size
-		necessarySize = (*numEntries_ptr) * sizeof(hdEnt_ptr); 			// Total bytes currently stored
-		necessarySize += sizeof(hdEnt_ptr);  							// The new hdEntry to store
-		necessarySize += sizeof(hdEnt_ptr);								// The terminating NULL pointer
-		// 2. Verify the array is large enough
-		if (*arraySize_ptr < necessarySize)
+		newLen = updateThis_ptr->entArrLen ? updateThis_ptr->entArrLen * 2 : HDIR_ARRAY_LEN;
+		realloc_ptr = realloc(updateThis_ptr->hdEnt_arr, newLen * sizeof(hdEnt));
+
+		if (realloc_ptr)
+		{
+			updateThis_ptr->hdEnt_arr = realloc_ptr;
+			updateThis_ptr->entArrLen = newLen;
+		}
+		else
 		{
-			// 2.1. Not enough
-			// fprintf(stdout, "\n\npopulate_dirDetails_arrays() - Array %p not big enough at %zu bytes.\n", *abstractArr_ptr, (*arraySize_ptr));  // DEBUGGING
-			realloc_ptr = realloc(*abstractArr_ptr, (*arraySize_ptr) + (HDIR_ARRAY_LEN * sizeof(hdEnt_ptr)));
-			// realloc_ptr = realloc(*abstractArr_ptr, (*arraySize_ptr) + (HDIR_ARRAY_LEN * sizeof(hdEnt*)));
+			HARKLE_ERROR(Harkledir, populate_dirDetails_arrays, Failed to realloc hdEnt_arr);
+			retVal = false;
+		}
+	}
 
-			if (realloc_ptr)
+	// POPULATE THE ENTRY
+	if (retVal == true && keepIt == true)
+	{
+		newEnt = updateThis_ptr->hdEnt_arr + updateThis_ptr->numEnts;
+		memset(newEnt, HDIR_MEMSET_DEFAULT, sizeof(hdEnt));
+		newEnt->hd_inodeNum = entryInode;
+		newEnt->hd_type = entryType;
+
+		// 1. hd_Name
+		nameLen = strlen(entryName);
+		newEnt->hd_NameOff = append_to_str_pool(updateThis_ptr, entryName, nameLen);
+
+		// 2. hd_AbsName (directories get a trailing slash, like os_path_join())
+		if (prefixLen + nameLen + 1 > PATH_MAX)
+		{
+			HARKLE_ERROR(Harkledir, populate_dirDetails_arrays, Path too long);
+			retVal = false;
+		}
+		else
+		{
+			memcpy(absName, dirPrefix, prefixLen);
+			memcpy(absName + prefixLen, entryName, nameLen);
+			absLen = prefixLen + nameLen;
+			if (DT_DIR == entryType)
 			{
-				*abstractArr_ptr = realloc_ptr;
-				// NULL the newly allocated buffer
-				// fprintf(stdout, "populate_dirDetails_arrays() - Realloc_ptr ==  %p\n", realloc_ptr);  // DEBUGGING
-				realloc_ptr = realloc_ptr + *arraySize_ptr;  // Advance past old array
-				// fprintf(stdout, "populate_dirDetails_arrays() - Realloc_ptr ==  %p\n", realloc_ptr);  // DEBUGGING
-				temp_ptr = memset(realloc_ptr, HDIR_MEMSET_DEFAULT, (HDIR_ARRAY_LEN * sizeof(hdEnt_ptr)));
-				if (temp_ptr != realloc_ptr)
-				{
-					HARKLE_ERROR(Harkledir, populate_dirDetails_arrays, memset failed on realloc()d buffer);
-					retVal = false;
-				}
-				else
-				{
-					temp_ptr = NULL;
-					realloc_ptr = NULL;
-				}
+				absName[absLen++] = '/';
+			}
+			absName[absLen] = '\0';
+			newEnt->hd_AbsNameOff = append_to_str_pool(updateThis_ptr, absName, absLen);
+		}
 
-				*arraySize_ptr += (HDIR_ARRAY_LEN * sizeof(hdEnt_ptr));
-				// Set the last index to NULL
-				(*abstractArr_ptr)[(*arraySize_ptr) / sizeof(hdEnt_ptr) - 1] = NULL;  // Superseded by memset
-				// fprintf(stdout, "populate_dirDetails_arrays() - Array %p now big enough with %zu bytes.\n", *abstractArr_ptr, (*arraySize_ptr));  // DEBUGGING
+		if (0 == newEnt->hd_NameOff || 0 == newEnt->hd_AbsNameOff)
+		{
+			HARKLE_ERROR(Harkledir, populate_dirDetails_arrays, append_to_str_pool failed);
+			retVal = false;
+		}
+
+		// 3. Count it (hd_symName is resolved later, in one batch)
+		if (retVal == true)
+		{
+			updateThis_ptr->numEnts++;
+
+			if (DT_DIR == entryType)
+			{
+				updateThis_ptr->numDirs++;
 			}
 			else
 			{
-				HARKLE_ERROR(Harkledir, populate_dirDetails_arrays, Failed to realloc the fileName_arr);
-				retVal = false;
+				updateThis_ptr->numFiles++;
 			}
 		}
 	}
 
-	// POPULATE THE ARRAY
-	if (retVal == true && numEntries_ptr && abstractArr_ptr && arraySize_ptr)
+	// DONE
+	return retVal;
+}
+
+
+size_t append_to_str_pool(dirDetails_ptr updateThis_ptr, const char* str_ptr, size_t strLen)
+{
+	// LOCAL VARIABLES
+	size_t retVal = 0;
+	size_t newSize = updateThis_ptr->poolSize ? updateThis_ptr->poolSize : HDIR_POOL_SIZE;  // New size of strPool
+	void* realloc_ptr = NULL;  // Return value from realloc
+
+	// GROW
+	// Offset 0 is reserved as an empty string so 0 can mean "none"
+	while (newSize < updateThis_ptr->poolUsed + strLen + 2)
+	{
+		newSize *= 2;
+	}
+
+	if (newSize != updateThis_ptr->poolSize)
 	{
-		// 1. Allocate a struct
-		newStruct = create_hdEnt_ptr();
+		realloc_ptr = realloc(updateThis_ptr->strPool, newSize);
 
-		if (newStruct)
+		if (realloc_ptr)
 		{
-			// 2. Populate that struct
-			// fprintf(stdout, "populate_dirDetails_arrays() calls  populate_hdEnt_struct(%s, %s, %s)\n", "empty struct", fileEntry->d_name, absPath);  // DEBUGGING
-			if (true == populate_hdEnt_struct(newStruct, fileEntry, absPath))
-			{
-				// fprintf(stdout, "populate_dirDetails_arrays() called populate_hdEnt_struct(%s, %s, %s)\n", newStruct->hd_AbsName, fileEntry->d_name, absPath);  // DEBUGGING
-				// 3. Store that pointer in the struct array
-				*((*abstractArr_ptr) + (*numEntries_ptr)) = newStruct;
-				newStruct = NULL;
+			updateThis_ptr->strPool = realloc_ptr;
+			updateThis_ptr->poolSize = newSize;
 
-				// 4. Increment the file count
-				(*numEntries_ptr)++;
-			}
-			else
+			if (0 == updateThis_ptr->poolUsed)
 			{
-				HARKLE_ERROR(Harkledir, populate_dirDetails_arrays, populate_hdEnt_struct failed);
-				retVal = false;
+				updateThis_ptr->strPool[0] = '\0';
+				updateThis_ptr->poolUsed = 1;
 			}
 		}
 		else
 		{
-			HARKLE_ERROR(Harkledir, populate_dirDetails_arrays, copy_a_string failed);
-			retVal = false;
+			HARKLE_ERROR(Harkledir, append_to_str_pool, Failed to realloc strPool);
 		}
 	}
 
+	// APPEND
+	if (updateThis_ptr->poolSize >= updateThis_ptr->poolUsed + strLen + 1)
+	{
+		retVal = updateThis_ptr->poolUsed;
+		memcpy(updateThis_ptr->strPool + retVal, str_ptr, strLen);
+		updateThis_ptr->strPool[retVal + strLen] = '\0';
+		updateThis_ptr->poolUsed += strLen + 1;
+	}
+
 	// DONE
 	return retVal;
 }
 
 
-bool keep_hdEntry(unsigned char hdEntryType, unsigned int typeFlags)
+bool index_dirDetails(dirDetails_ptr updateThis_ptr)
 {
 	// LOCAL VARIABLES
-	bool retVal = false;
+	bool retVal = true;
+	hdEnt_ptr currEnt = NULL;  // Iterating variable
+	hdEnt_ptr* currFile_arr = NULL;  // Next fileName_arr slot
+	hdEnt_ptr* currDir_arr = NULL;  // Next dirName_arr slot
+	size_t i = 0;  // Iterating variable
 
-	// INPUT VALIDATION
-	if ((hdEntryType != DT_BLK) && \
-		(hdEntryType != DT_CHR) && \
-		(hdEntryType != DT_DIR) && \
-		(hdEntryType != DT_FIFO) && \
-		(hdEntryType != DT_LNK) && \
-		(hdEntryType != DT_REG) && \
-		(hdEntryType != DT_SOCK) && \
-		(hdEntryType != DT_UNKNOWN))
+	// ALLOCATE
+	updateThis_ptr->fileName_arr = (hdEnt_ptr*)calloc(updateThis_ptr->numFiles + 1, sizeof(hdEnt_ptr));
+	updateThis_ptr->dirName_arr = (hdEnt_ptr*)calloc(updateThis_ptr->numDirs + 1, sizeof(hdEnt_ptr));
+
+	if (!(updateThis_ptr->fileName_arr) || !(updateThis_ptr->dirName_arr))
+	{
+		HARKLE_ERROR(Harkledir, index_dirDetails, calloc failed);
+		retVal = false;
+	}
+	else
+	{
+		updateThis_ptr->fileArrSize = (size_t)(updateThis_ptr->numFiles + 1) * sizeof(hdEnt_ptr);
+		updateThis_ptr->dirArrSize = (size_t)(updateThis_ptr->numDirs + 1) * sizeof(hdEnt_ptr);
+		currFile_arr = updateThis_ptr->fileName_arr;
+		currDir_arr = updateThis_ptr->dirName_arr;
+
+		// POINT EVERYTHING AT ITS FINAL HOME
+		point_dirDetails_strings(updateThis_ptr);
+
+		for (i = 0; i < updateThis_ptr->numEnts; i++)
+		{
+			currEnt = updateThis_ptr->hdEnt_arr + i;
+
+			if (DT_DIR == currEnt->hd_type)
+			{
+				*currDir_arr++ = currEnt;
+			}
+			else
+			{
+				*currFile_arr++ = currEnt;
+			}
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+void point_dirDetails_strings(dirDetails_ptr updateThis_ptr)
+{
+	// LOCAL VARIABLES
+	hdEnt_ptr currEnt = NULL;  // Iterating variable
+	size_t i = 0;  // Iterating variable
+
+	for (i = 0; i < updateThis_ptr->numEnts; i++)
+	{
+		currEnt = updateThis_ptr->hdEnt_arr + i;
+		currEnt->hd_Name = updateThis_ptr->strPool + currEnt->hd_NameOff;
+		currEnt->hd_AbsName = updateThis_ptr->strPool + currEnt->hd_AbsNameOff;
+		currEnt->hd_symName = currEnt->hd_symNameOff ? updateThis_ptr->strPool + currEnt->hd_symNameOff : NULL;
+	}
+
+	// DONE
+	return;
+}
+
+
+size_t build_dir_prefix(char* dirName, char* buff, size_t buffSize)
+{
+	// LOCAL VARIABLES
+	size_t retVal = 0;
+	size_t nameLen = strlen(dirName);  // Length of dirName
+	char* srce_ptr = dirName;  // Iterating variable
+
+	// BUILD
+	if (nameLen + 3 > buffSize)
+	{
+		HARKLE_ERROR(Harkledir, build_dir_prefix, dirName is too long);
+	}
+	else
+	{
+		buff[retVal++] = '/';
+
+		// Skip the leading slash and a trailing slash
+		while (*srce_ptr)
+		{
+			if ((srce_ptr == dirName && *srce_ptr == '/') || (*srce_ptr == '/' && *(srce_ptr + 1) == '\0'))
+			{
+				srce_ptr++;
+			}
+			else
+			{
+				buff[retVal++] = *srce_ptr++;
+			}
+		}
+
+		// Root directory already has its slash
+		if (nameLen != 1 || *dirName != '/')
+		{
+			buff[retVal++] = '/';
+		}
+		buff[retVal] = '\0';
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool keep_hdEntry(unsigned char hdEntryType, unsigned int typeFlags)
+{
+	// LOCAL VARIABLES
+	bool retVal = false;
+
+	// INPUT VALIDATION
+	if ((hdEntryType != DT_BLK) && \
+		(hdEntryType != DT_CHR) && \
+		(hdEntryType != DT_DIR) && \
+		(hdEntryType != DT_FIFO) && \
+		(hdEntryType != DT_LNK) && \
+		(hdEntryType != DT_REG) && \
+		(hdEntryType != DT_SOCK) && \
+		(hdEntryType != DT_UNKNOWN))
 	{
 		HARKLE_ERROR(Harkledir, keep_hdEntry, hdEntryType);
 	}
@@ -1358,6 +1734,1158 @@ bool keep_hdEntry(unsigned char hdEntryType, unsigned int typeFlags)
 ////////////////////// LOCAL FUNCTION DEFINITIONS STOP ///////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////// DIRECTORY STREAM FUNCTIONS START ////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+bool open_dir_stream(hdStream_ptr stream_ptr, const char* directoryName, size_t buffSize, int* errNum)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+
+	// INPUT VALIDATION
+	if (!stream_ptr || !directoryName || !errNum)
+	{
+		HARKLE_ERROR(Harkledir, open_dir_stream, NULL pointer);
+		retVal = false;
+	}
+	else if (!(*directoryName))
+	{
+		HARKLE_ERROR(Harkledir, open_dir_stream, Empty string);
+		retVal = false;
+	}
+	else
+	{
+		*errNum = 0;
+		memset(stream_ptr, HDIR_MEMSET_DEFAULT, sizeof(hdStream));
+		stream_ptr->dirFD = -1;
+		stream_ptr->buffSize = buffSize ? buffSize : HDIR_DENTS_BUFF;
+	}
+
+	// OPEN
+	if (retVal == true)
+	{
+		stream_ptr->buff_ptr = malloc(stream_ptr->buffSize);
+
+		if (!(stream_ptr->buff_ptr))
+		{
+			*errNum = errno;
+			HARKLE_ERROR(Harkledir, open_dir_stream, malloc failed);
+			retVal = false;
+		}
+		else
+		{
+			stream_ptr->dirFD = open(directoryName, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+			if (stream_ptr->dirFD < 0)
+			{
+				*errNum = errno;
+				retVal = false;  // Let the caller decide how loud to be
+			}
+		}
+	}
+
+	// CLEAN UP
+	if (retVal == false && stream_ptr && stream_ptr->buff_ptr)
+	{
+		free(stream_ptr->buff_ptr);
+		stream_ptr->buff_ptr = NULL;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool next_dir_entry(hdStream_ptr stream_ptr, const char** name_ptr, unsigned char* fileType, ino_t* inodeNum, int* errNum)
+{
+	// LOCAL VARIABLES
+	bool retVal = false;
+	long numRead = 0;  // Return value from getdents64
+	hdDirent64_ptr dent_ptr = NULL;  // Current record
+	struct stat fileStat;  // fstatat() output for DT_UNKNOWN entries
+
+	// INPUT VALIDATION
+	if (!stream_ptr || !name_ptr || !fileType || !errNum)
+	{
+		HARKLE_ERROR(Harkledir, next_dir_entry, NULL pointer);
+	}
+	else if (stream_ptr->dirFD < 0 || !(stream_ptr->buff_ptr))
+	{
+		HARKLE_ERROR(Harkledir, next_dir_entry, Stream is not open);
+		*errNum = EBADF;
+	}
+	else
+	{
+		*errNum = 0;
+
+		// 1. Refill the buffer
+		if (stream_ptr->offset >= stream_ptr->numRead)
+		{
+			numRead = syscall(SYS_getdents64, stream_ptr->dirFD, stream_ptr->buff_ptr, stream_ptr->buffSize);
+
+			if (numRead < 0)
+			{
+				*errNum = errno;
+				HARKLE_ERROR(Harkledir, next_dir_entry, getdents64 failed);
+				numRead = 0;
+			}
+			stream_ptr->numRead = (size_t)numRead;
+			stream_ptr->offset = 0;
+		}
+
+		// 2. Parse the next record in place
+		if (stream_ptr->offset < stream_ptr->numRead)
+		{
+			dent_ptr = (hdDirent64_ptr)(stream_ptr->buff_ptr + stream_ptr->offset);
+			stream_ptr->offset += dent_ptr->d_reclen;
+			*name_ptr = dent_ptr->d_name;
+			*fileType = dent_ptr->d_type;
+
+			if (inodeNum)
+			{
+				*inodeNum = (ino_t)dent_ptr->d_ino;
+			}
+
+			// 3. The file system didn't say; ask relative to the directory
+			if (DT_UNKNOWN == *fileType && 0 == fstatat(stream_ptr->dirFD, dent_ptr->d_name, &fileStat, AT_SYMLINK_NOFOLLOW))
+			{
+				*fileType = IFTODT(fileStat.st_mode);
+			}
+			retVal = true;
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool close_dir_stream(hdStream_ptr stream_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+
+	// INPUT VALIDATION
+	if (!stream_ptr)
+	{
+		HARKLE_ERROR(Harkledir, close_dir_stream, NULL pointer);
+		retVal = false;
+	}
+	else
+	{
+		if (stream_ptr->dirFD > -1 && 0 != close(stream_ptr->dirFD))
+		{
+			HARKLE_ERROR(Harkledir, close_dir_stream, close failed);
+			retVal = false;
+		}
+
+		if (stream_ptr->buff_ptr)
+		{
+			free(stream_ptr->buff_ptr);
+		}
+
+		memset(stream_ptr, HDIR_MEMSET_DEFAULT, sizeof(hdStream));
+		stream_ptr->dirFD = -1;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////// DIRECTORY STREAM FUNCTIONS STOP /////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+///////////////////////// DIRECTORY WALK FUNCTIONS START /////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+size_t walk_dir_tree(const char* rootName, hdFilter_ptr filter_ptr, hdWalkCallback callback, void* userData, int numThreads, int* errNum)
+{
+	// LOCAL VARIABLES
+	size_t retVal = 0;
+	bool success = true;  // Make this false if anything fails
+	hwWalk walk = { 0 };  // State shared with the workers
+	hwTask rootTask = { 0 };  // The first directory
+	hwWorker worker_arr[HDIR_WALK_MAX_THREADS];  // Worker identities
+	pthread_t threadIDs[HDIR_WALK_MAX_THREADS];  // Worker threads
+	int numStarted = 0;  // Number of worker threads actually started
+	int numInited = 0;  // Number of deque locks initialized
+	bool idleInited = false;  // true once idleLock and idleCond are initialized
+	int i = 0;  // Iterating variable
+	int tempErr = 0;  // Return value from pthread_create()
+
+	// INPUT VALIDATION
+	if (!rootName || !callback || !errNum)
+	{
+		HARKLE_ERROR(Harkledir, walk_dir_tree, NULL pointer);
+		success = false;
+	}
+	else if (!(*rootName))
+	{
+		HARKLE_ERROR(Harkledir, walk_dir_tree, Empty string);
+		success = false;
+	}
+	else
+	{
+		*errNum = 0;
+	}
+
+	// PREPARE
+	if (true == success)
+	{
+		// Thread count
+		numThreads = (int)get_thread_count(numThreads, HDIR_WALK_MAX_THREADS, 0, 0);
+
+		// Shared state
+		if (filter_ptr)
+		{
+			walk.filter = *filter_ptr;
+		}
+		else
+		{
+			walk.filter.maxDepth = -1;
+		}
+		if (0 == walk.filter.typeFlags)
+		{
+			walk.filter.typeFlags = HDIR_DT_ALL;
+		}
+		walk.callback = callback;
+		walk.userData = userData;
+		walk.numWorkers = numThreads;
+		walk.deque_arr = calloc(numThreads, sizeof(hwDeque));
+
+		if (!(walk.deque_arr))
+		{
+			HARKLE_ERROR(Harkledir, walk_dir_tree, calloc failed);
+			success = false;
+		}
+		else
+		{
+			for (numInited = 0; numInited < numThreads; numInited++)
+			{
+				pthread_mutex_init(&(walk.deque_arr[numInited].lock), NULL);
+			}
+			pthread_mutex_init(&(walk.idleLock), NULL);
+			pthread_cond_init(&(walk.idleCond), NULL);
+			idleInited = true;
+		}
+	}
+
+	// QUEUE THE ROOT
+	if (true == success)
+	{
+		rootTask.path = copy_a_string(rootName);
+		rootTask.dirFD = -1;
+		rootTask.depth = 0;
+
+		if (!(rootTask.path) || false == push_walk_task(walk.deque_arr, &rootTask))
+		{
+			HARKLE_ERROR(Harkledir, walk_dir_tree, Failed to queue rootName);
+			if (rootTask.path)
+			{
+				free(rootTask.path);
+			}
+			success = false;
+		}
+		else
+		{
+			walk.pending = 1;
+		}
+	}
+
+	// WALK
+	if (true == success)
+	{
+		for (i = 0; i < numThreads; i++)
+		{
+			worker_arr[i].walk_ptr = &walk;
+			worker_arr[i].workerID = i;
+		}
+
+		// This thread is worker 0
+		for (numStarted = 0; numStarted < numThreads - 1; numStarted++)
+		{
+			tempErr = pthread_create(&(threadIDs[numStarted]), NULL, walk_dir_worker, &(worker_arr[numStarted + 1]));
+
+			if (tempErr)
+			{
+				HARKLE_ERROR(Harkledir, walk_dir_tree, pthread_create failed);
+				HARKLE_ERRNO(Harkledir, pthread_create, tempErr);
+				break;  // The other workers will steal the slack
+			}
+		}
+
+		walk_dir_worker(&(worker_arr[0]));
+
+		for (i = 0; i < numStarted; i++)
+		{
+			pthread_join(threadIDs[i], NULL);
+		}
+
+		retVal = walk.numReported;
+		*errNum = walk.firstErr;
+	}
+
+	// CLEAN UP
+	if (true == idleInited)
+	{
+		pthread_cond_destroy(&(walk.idleCond));
+		pthread_mutex_destroy(&(walk.idleLock));
+	}
+	if (walk.deque_arr)
+	{
+		for (i = 0; i < numInited; i++)
+		{
+			pthread_mutex_destroy(&(walk.deque_arr[i].lock));
+			free(walk.deque_arr[i].task_arr);  // Empty by now
+		}
+		free(walk.deque_arr);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+void* walk_dir_worker(void* worker_ptr)
+{
+	// LOCAL VARIABLES
+	hwWalk_ptr walk_ptr = ((hwWorker_ptr)worker_ptr)->walk_ptr;  // Shared state
+	int workerID = ((hwWorker_ptr)worker_ptr)->workerID;  // Index of this worker's deque
+	char* buff_ptr = malloc(HDIR_DENTS_BUFF);  // getdents64 buffer, reused for every directory
+	char pathBuff[PATH_MAX + 1] = { 0 };  // Entry paths are built here
+	hwTask task = { 0 };  // Directory currently claimed
+	bool gotOne = false;  // true if a task was claimed
+	size_t seenSeq = 0;  // workSeq before looking for a task
+	int victim = 0;  // Index of the deque to steal from
+	int i = 0;  // Iterating variable
+
+	// INPUT VALIDATION
+	if (!buff_ptr)
+	{
+		HARKLE_ERROR(Harkledir, walk_dir_worker, malloc failed);
+		record_walk_error(walk_ptr, ENOMEM);
+		// Stop the walk, but keep popping (and discarding) tasks so pending
+		// still drains if every worker is in the same boat
+		__atomic_store_n(&(walk_ptr->stop), true, __ATOMIC_RELEASE);
+	}
+
+	// WORK
+	while (__atomic_load_n(&(walk_ptr->pending), __ATOMIC_ACQUIRE) > 0)
+	{
+		// 1. Newest task of our own, or the oldest of someone else's
+		seenSeq = __atomic_load_n(&(walk_ptr->workSeq), __ATOMIC_SEQ_CST);
+		gotOne = pop_walk_task(walk_ptr->deque_arr + workerID, &task, false);
+
+		for (i = 1; false == gotOne && i < walk_ptr->numWorkers; i++)
+		{
+			victim = (workerID + i) % walk_ptr->numWorkers;
+			gotOne = pop_walk_task(walk_ptr->deque_arr + victim, &task, true);
+		}
+
+		if (false == gotOne)
+		{
+			// Someone is still reading a directory that may have children.
+			// Sleep until a task is queued or the walk finishes.  Anything queued
+			// since seenSeq was read bumps workSeq, so it can't be slept through.
+			pthread_mutex_lock(&(walk_ptr->idleLock));
+			__atomic_add_fetch(&(walk_ptr->numIdle), 1, __ATOMIC_SEQ_CST);
+
+			while (seenSeq == __atomic_load_n(&(walk_ptr->workSeq), __ATOMIC_SEQ_CST) \
+			       && __atomic_load_n(&(walk_ptr->pending), __ATOMIC_ACQUIRE) > 0)
+			{
+				pthread_cond_wait(&(walk_ptr->idleCond), &(walk_ptr->idleLock));
+			}
+
+			__atomic_sub_fetch(&(walk_ptr->numIdle), 1, __ATOMIC_SEQ_CST);
+			pthread_mutex_unlock(&(walk_ptr->idleLock));
+			continue;
+		}
+
+		// 2. Read it (or just discard it if we're stopping or without a buffer)
+		if (buff_ptr && false == __atomic_load_n(&(walk_ptr->stop), __ATOMIC_ACQUIRE))
+		{
+			walk_one_dir(walk_ptr, workerID, &task, buff_ptr, pathBuff);
+		}
+		else if (task.dirFD > -1)
+		{
+			close(task.dirFD);
+			__atomic_sub_fetch(&(walk_ptr->numOpenFDs), 1, __ATOMIC_ACQ_REL);
+		}
+		free(task.path);
+
+		// 3. Its children (if any) were pushed before it's marked done
+		if (0 == __atomic_sub_fetch(&(walk_ptr->pending), 1, __ATOMIC_ACQ_REL))
+		{
+			wake_walk_workers(walk_ptr, true);  // That was the last one
+		}
+	}
+
+	// CLEAN UP
+	if (buff_ptr)
+	{
+		free(buff_ptr);
+	}
+
+	// DONE
+	return NULL;
+}
+
+
+void walk_one_dir(hwWalk_ptr walk_ptr, int workerID, hwTask_ptr task_ptr, char* buff_ptr, char* pathBuff)
+{
+	// LOCAL VARIABLES
+	hdStream dirStream = { .dirFD = -1 };  // Reads the directory with the worker's buffer
+	hwEnt entry = { 0 };  // What callback sees
+	hwTask child = { 0 };  // Subdirectory to queue
+	const char* entryName = NULL;  // Name of the current entry
+	unsigned char entryType = DT_UNKNOWN;  // Type of the current entry
+	ino_t entryInode = 0;  // Inode of the current entry
+	size_t pathLen = strlen(task_ptr->path);  // Length of the directory's path in pathBuff
+	size_t nameLen = 0;  // Length of entryName
+	int errNum = 0;  // Store errno here
+
+	// 1. OPEN
+	if (task_ptr->dirFD > -1)
+	{
+		dirStream.dirFD = task_ptr->dirFD;
+		__atomic_sub_fetch(&(walk_ptr->numOpenFDs), 1, __ATOMIC_ACQ_REL);
+	}
+	else
+	{
+		dirStream.dirFD = open(task_ptr->path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+		if (dirStream.dirFD < 0)
+		{
+			record_walk_error(walk_ptr, errno);
+		}
+	}
+	dirStream.buff_ptr = buff_ptr;
+	dirStream.buffSize = HDIR_DENTS_BUFF;
+
+	// 2. PREPARE THE PATH PREFIX
+	if (dirStream.dirFD > -1)
+	{
+		if (pathLen + 1 > PATH_MAX)
+		{
+			record_walk_error(walk_ptr, ENAMETOOLONG);
+			close(dirStream.dirFD);
+			dirStream.dirFD = -1;
+		}
+		else
+		{
+			memcpy(pathBuff, task_ptr->path, pathLen);
+			if (pathBuff[pathLen - 1] != '/')
+			{
+				pathBuff[pathLen++] = '/';
+			}
+		}
+	}
+
+	// 3. READ
+	while (dirStream.dirFD > -1 && true == next_dir_entry(&dirStream, &entryName, &entryType, &entryInode, &errNum))
+	{
+		// 3.1. Skip . and ..
+		if ('.' == entryName[0] && ('\0' == entryName[1] || ('.' == entryName[1] && '\0' == entryName[2])))
+		{
+			continue;
+		}
+
+		nameLen = strlen(entryName);
+		if (pathLen + nameLen > PATH_MAX)
+		{
+			record_walk_error(walk_ptr, ENAMETOOLONG);
+			continue;
+		}
+		memcpy(pathBuff + pathLen, entryName, nameLen + 1);
+
+		// 3.2. Report it
+		if ((walk_ptr->filter.maxDepth < 0 || task_ptr->depth <= walk_ptr->filter.maxDepth) && \
+			true == keep_hdEntry(entryType, walk_ptr->filter.typeFlags) && \
+			(!(walk_ptr->filter.nameGlob) || 0 == fnmatch(walk_ptr->filter.nameGlob, entryName, 0)))
+		{
+			entry.hw_Path = pathBuff;
+			entry.hw_Name = pathBuff + pathLen;
+			entry.hw_type = entryType;
+			entry.hw_inodeNum = entryInode;
+			entry.hw_depth = task_ptr->depth;
+			entry.hw_dirFD = dirStream.dirFD;
+			__atomic_add_fetch(&(walk_ptr->numReported), 1, __ATOMIC_ACQ_REL);
+
+			if (false == walk_ptr->callback(&entry, walk_ptr->userData))
+			{
+				__atomic_store_n(&(walk_ptr->stop), true, __ATOMIC_RELEASE);
+				break;
+			}
+		}
+
+		// 3.3. Queue subdirectories
+		if (DT_DIR == entryType && (walk_ptr->filter.maxDepth < 0 || task_ptr->depth < walk_ptr->filter.maxDepth))
+		{
+			child.path = copy_a_string(pathBuff);
+			child.dirFD = -1;
+			child.depth = task_ptr->depth + 1;
+
+			if (!(child.path))
+			{
+				record_walk_error(walk_ptr, ENOMEM);
+				continue;
+			}
+
+			// Open it relative to this directory while we have it, if we're under the limit
+			if (__atomic_add_fetch(&(walk_ptr->numOpenFDs), 1, __ATOMIC_ACQ_REL) <= HDIR_WALK_MAX_OPEN)
+			{
+				child.dirFD = openat(dirStream.dirFD, entryName, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+			}
+			if (child.dirFD < 0)
+			{
+				__atomic_sub_fetch(&(walk_ptr->numOpenFDs), 1, __ATOMIC_ACQ_REL);
+			}
+
+			__atomic_add_fetch(&(walk_ptr->pending), 1, __ATOMIC_ACQ_REL);
+
+			if (true == push_walk_task(walk_ptr->deque_arr + workerID, &child))
+			{
+				wake_walk_workers(walk_ptr, false);
+			}
+			else
+			{
+				record_walk_error(walk_ptr, ENOMEM);
+				if (child.dirFD > -1)
+				{
+					close(child.dirFD);
+					__atomic_sub_fetch(&(walk_ptr->numOpenFDs), 1, __ATOMIC_ACQ_REL);
+				}
+				free(child.path);
+				__atomic_sub_fetch(&(walk_ptr->pending), 1, __ATOMIC_ACQ_REL);
+			}
+		}
+	}
+
+	if (errNum)
+	{
+		record_walk_error(walk_ptr, errNum);
+	}
+
+	// CLEAN UP
+	if (dirStream.dirFD > -1)
+	{
+		close(dirStream.dirFD);
+	}
+
+	// DONE
+	return;
+}
+
+
+bool push_walk_task(hwDeque_ptr deque_ptr, hwTask_ptr task_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	hwTask_ptr temp_ptr = NULL;  // Return value from realloc()
+	size_t newLen = 0;  // New number of tasks task_arr can hold
+
+	pthread_mutex_lock(&(deque_ptr->lock));
+
+	// 1. Make room
+	if (deque_ptr->bottom == deque_ptr->arrLen)
+	{
+		if (deque_ptr->top > 0)
+		{
+			// Slide the live tasks back to the start
+			memmove(deque_ptr->task_arr, deque_ptr->task_arr + deque_ptr->top, (deque_ptr->bottom - deque_ptr->top) * sizeof(hwTask));
+			deque_ptr->bottom -= deque_ptr->top;
+			deque_ptr->top = 0;
+		}
+
+		if (deque_ptr->bottom == deque_ptr->arrLen)
+		{
+			newLen = deque_ptr->arrLen ? deque_ptr->arrLen * 2 : HDIR_ARRAY_LEN;
+			temp_ptr = realloc(deque_ptr->task_arr, newLen * sizeof(hwTask));
+
+			if (temp_ptr)
+			{
+				deque_ptr->task_arr = temp_ptr;
+				deque_ptr->arrLen = newLen;
+			}
+			else
+			{
+				retVal = false;
+			}
+		}
+	}
+
+	// 2. Push
+	if (true == retVal)
+	{
+		deque_ptr->task_arr[deque_ptr->bottom++] = *task_ptr;
+	}
+
+	pthread_mutex_unlock(&(deque_ptr->lock));
+
+	// DONE
+	return retVal;
+}
+
+
+bool pop_walk_task(hwDeque_ptr deque_ptr, hwTask_ptr task_ptr, bool steal)
+{
+	// LOCAL VARIABLES
+	bool retVal = false;
+
+	pthread_mutex_lock(&(deque_ptr->lock));
+
+	if (deque_ptr->top < deque_ptr->bottom)
+	{
+		if (true == steal)
+		{
+			*task_ptr = deque_ptr->task_arr[deque_ptr->top++];
+		}
+		else
+		{
+			*task_ptr = deque_ptr->task_arr[--(deque_ptr->bottom)];
+		}
+		retVal = true;
+
+		if (deque_ptr->top == deque_ptr->bottom)
+		{
+			deque_ptr->top = 0;
+			deque_ptr->bottom = 0;
+		}
+	}
+
+	pthread_mutex_unlock(&(deque_ptr->lock));
+
+	// DONE
+	return retVal;
+}
+
+
+void record_walk_error(hwWalk_ptr walk_ptr, int errNum)
+{
+	// LOCAL VARIABLES
+	int noErr = 0;  // Expected value of firstErr
+
+	// Only the first one sticks
+	__atomic_compare_exchange_n(&(walk_ptr->firstErr), &noErr, errNum, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+
+void wake_walk_workers(hwWalk_ptr walk_ptr, bool everyone)
+{
+	// Bump workSeq before checking numIdle: a worker bumps numIdle before checking
+	// workSeq, so either it sees the bump or we see it and wake it up
+	__atomic_add_fetch(&(walk_ptr->workSeq), 1, __ATOMIC_SEQ_CST);
+
+	if (__atomic_load_n(&(walk_ptr->numIdle), __ATOMIC_SEQ_CST) > 0)
+	{
+		pthread_mutex_lock(&(walk_ptr->idleLock));
+		if (true == everyone)
+		{
+			pthread_cond_broadcast(&(walk_ptr->idleCond));
+		}
+		else
+		{
+			pthread_cond_signal(&(walk_ptr->idleCond));
+		}
+		pthread_mutex_unlock(&(walk_ptr->idleLock));
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+///////////////////////// DIRECTORY WALK FUNCTIONS STOP //////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////// SYMBOLIC LINK FUNCTIONS START ///////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+hdLinkCache_ptr create_link_cache(size_t numExpected)
+{
+	// LOCAL VARIABLES
+	hdLinkCache_ptr retVal = NULL;
+	bool success = true;  // Make this false if anything fails
+	size_t numSlots = HDIR_LINK_CACHE_SIZE;  // Keep the load factor at or under one half
+
+	// SIZE IT
+	while (numSlots / 2 < numExpected)
+	{
+		numSlots *= 2;
+	}
+
+	// ALLOCATE
+	retVal = get_me_memory(sizeof(hdLinkCache));
+
+	if (!retVal)
+	{
+		HARKLE_ERROR(Harkledir, create_link_cache, get_me_memory failed);
+		success = false;
+	}
+	else
+	{
+		pthread_mutex_init(&(retVal->lock), NULL);
+		retVal->numSlots = numSlots;
+		retVal->slot_arr = get_me_memory(numSlots * sizeof(hlSlot));
+		retVal->target_ptr = create_mem_str_set(numExpected, true);
+
+		if (!(retVal->slot_arr) || !(retVal->target_ptr))
+		{
+			HARKLE_ERROR(Harkledir, create_link_cache, Allocation failed);
+			success = false;
+		}
+	}
+
+	// CLEAN UP
+	if (false == success && retVal)
+	{
+		free_link_cache(&retVal);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool resolve_dirDetails_links(dirDetails_ptr dirStruct_ptr, hdLinkCache_ptr cache_ptr, int numThreads)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	int dirFD = -1;  // dirStruct_ptr->dirName
+	int errNum = 0;  // Store errno here
+
+	// INPUT VALIDATION
+	if (!dirStruct_ptr || !(dirStruct_ptr->dirName))
+	{
+		HARKLE_ERROR(Harkledir, resolve_dirDetails_links, NULL pointer);
+		retVal = false;
+	}
+	else if (!(dirStruct_ptr->hdEnt_arr) && dirStruct_ptr->numEnts > 0)
+	{
+		HARKLE_ERROR(Harkledir, resolve_dirDetails_links, Not a pooled dirDetails);
+		retVal = false;
+	}
+
+	// OPEN
+	if (true == retVal)
+	{
+		dirFD = open(dirStruct_ptr->dirName, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+		if (dirFD < 0)
+		{
+			errNum = errno;
+			HARKLE_ERROR(Harkledir, resolve_dirDetails_links, open failed);
+			HARKLE_ERRNO(Harkledir, open, errNum);
+			retVal = false;
+		}
+	}
+
+	// RESOLVE
+	if (true == retVal)
+	{
+		retVal = resolve_links_at(dirStruct_ptr, dirFD, cache_ptr, numThreads);
+
+		if (false == retVal)
+		{
+			HARKLE_ERROR(Harkledir, resolve_dirDetails_links, resolve_links_at failed);
+		}
+		else if (dirStruct_ptr->fileName_arr)
+		{
+			// Already indexed, and strPool may have moved
+			point_dirDetails_strings(dirStruct_ptr);
+		}
+	}
+
+	// CLEAN UP
+	if (dirFD > -1)
+	{
+		close(dirFD);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool free_link_cache(hdLinkCache_ptr* oldCache_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	hdLinkCache_ptr cache_ptr = NULL;  // Easier to deal with this way
+
+	// INPUT VALIDATION
+	if (!oldCache_ptr || !(*oldCache_ptr))
+	{
+		HARKLE_ERROR(Harkledir, free_link_cache, NULL pointer);
+		retVal = false;
+	}
+	else
+	{
+		cache_ptr = *oldCache_ptr;
+
+		// 1. Link text
+		if (cache_ptr->target_ptr && false == free_mem_str_set(&(cache_ptr->target_ptr)))
+		{
+			HARKLE_ERROR(Harkledir, free_link_cache, free_mem_str_set failed);
+			retVal = false;
+		}
+
+		// 2. Slots
+		if (cache_ptr->slot_arr)
+		{
+			harkleset(cache_ptr->slot_arr, HDIR_MEMSET_DEFAULT, cache_ptr->numSlots * sizeof(hlSlot));
+			free(cache_ptr->slot_arr);
+		}
+
+		// 3. The cache
+		pthread_mutex_destroy(&(cache_ptr->lock));
+		harkleset(cache_ptr, HDIR_MEMSET_DEFAULT, sizeof(hdLinkCache));
+		free(cache_ptr);
+		*oldCache_ptr = NULL;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool resolve_links_at(dirDetails_ptr updateThis_ptr, int dirFD, hdLinkCache_ptr cache_ptr, int numThreads)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	hlScan scan = { 0 };  // State shared with the worker threads
+	hdLinkCache_ptr tempCache_ptr = NULL;  // Used if cache_ptr is NULL
+	struct stat dirStat = { 0 };  // fstat() of dirFD
+	pthread_t threadIDs[HDIR_LINK_MAX_THREADS];  // Worker threads
+	size_t numWorkers = 0;  // Number of threads to resolve with, including this one
+	size_t numStarted = 0;  // Number of worker threads actually started
+	size_t numLinks = 0;  // Number of DT_LNK entries
+	hdEnt_ptr currEnt = NULL;  // Entry being updated
+	size_t i = 0;  // Iterating variable
+	int errNum = 0;  // Store errno here
+
+	// COUNT
+	for (i = 0; i < updateThis_ptr->numEnts; i++)
+	{
+		if (DT_LNK == updateThis_ptr->hdEnt_arr[i].hd_type && 0 == updateThis_ptr->hdEnt_arr[i].hd_symNameOff)
+		{
+			numLinks++;
+		}
+	}
+
+	// PREPARE
+	if (numLinks > 0)
+	{
+		if (fstat(dirFD, &dirStat))
+		{
+			errNum = errno;
+			HARKLE_ERROR(Harkledir, resolve_links_at, fstat failed);
+			HARKLE_ERRNO(Harkledir, fstat, errNum);
+			retVal = false;
+		}
+		else if (!cache_ptr)
+		{
+			tempCache_ptr = create_link_cache(numLinks);
+			cache_ptr = tempCache_ptr;
+
+			if (!cache_ptr)
+			{
+				HARKLE_ERROR(Harkledir, resolve_links_at, create_link_cache failed);
+				retVal = false;
+			}
+		}
+	}
+
+	if (numLinks > 0 && true == retVal)
+	{
+		scan.todo_arr = calloc(numLinks, sizeof(size_t));
+		scan.target_arr = calloc(numLinks, sizeof(const char*));
+
+		if (!(scan.todo_arr) || !(scan.target_arr))
+		{
+			HARKLE_ERROR(Harkledir, resolve_links_at, calloc failed);
+			retVal = false;
+		}
+		else
+		{
+			scan.dir_ptr = updateThis_ptr;
+			scan.dirFD = dirFD;
+			scan.dirDev = dirStat.st_dev;
+			scan.cache_ptr = cache_ptr;
+
+			for (i = 0; i < updateThis_ptr->numEnts; i++)
+			{
+				if (DT_LNK == updateThis_ptr->hdEnt_arr[i].hd_type && 0 == updateThis_ptr->hdEnt_arr[i].hd_symNameOff)
+				{
+					scan.todo_arr[scan.numTodo++] = i;
+				}
+			}
+		}
+	}
+
+	// RESOLVE IN PARALLEL
+	if (numLinks > 0 && true == retVal)
+	{
+		numWorkers = get_thread_count(numThreads, HDIR_LINK_MAX_THREADS, scan.numTodo, HDIR_LINK_MIN_PER_THREAD);
+
+		// This thread is one of the numWorkers
+		for (numStarted = 0; numStarted < numWorkers - 1; numStarted++)
+		{
+			errNum = pthread_create(&(threadIDs[numStarted]), NULL, hdir_link_worker, &scan);
+
+			if (errNum)
+			{
+				HARKLE_ERROR(Harkledir, resolve_links_at, pthread_create failed);
+				HARKLE_ERRNO(Harkledir, pthread_create, errNum);
+				break;  // This thread will pick up the slack
+			}
+		}
+
+		hdir_link_worker(&scan);
+
+		for (i = 0; i < numStarted; i++)
+		{
+			pthread_join(threadIDs[i], NULL);
+		}
+
+		if (scan.firstErr)
+		{
+			HARKLE_ERROR(Harkledir, resolve_links_at, readlinkat failed);
+			HARKLE_ERRNO(Harkledir, readlinkat, scan.firstErr);
+			retVal = false;
+		}
+	}
+
+	// COPY THE LINK TEXT IN
+	for (i = 0; numLinks > 0 && true == retVal && i < scan.numTodo; i++)
+	{
+		currEnt = updateThis_ptr->hdEnt_arr + scan.todo_arr[i];
+		currEnt->hd_symNameOff = append_to_str_pool(updateThis_ptr, scan.target_arr[i], strlen(scan.target_arr[i]));
+
+		if (0 == currEnt->hd_symNameOff)
+		{
+			HARKLE_ERROR(Harkledir, resolve_links_at, append_to_str_pool failed);
+			retVal = false;
+		}
+	}
+
+	// CLEAN UP
+	if (scan.todo_arr)
+	{
+		free(scan.todo_arr);
+	}
+	if (scan.target_arr)
+	{
+		free(scan.target_arr);
+	}
+	if (tempCache_ptr)
+	{
+		free_link_cache(&tempCache_ptr);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+void* hdir_link_worker(void* scan_ptr)
+{
+	// LOCAL VARIABLES
+	hlScan_ptr scan = (hlScan_ptr)scan_ptr;
+	hdLinkCache_ptr cache_ptr = scan->cache_ptr;  // Shared cache
+	char symName[HDIR_BIG_BUFF_SIZE + 1] = { 0 };  // readlinkat() destination
+	ssize_t numBytesRead = 0;  // Return value from readlinkat()
+	hdEnt_ptr currEnt = NULL;  // Entry currently claimed
+	hlSlot_ptr slot_ptr = NULL;  // Cached (dev, inode)
+	const char* target = NULL;  // Interned link text
+	size_t todoNum = 0;  // todo_arr entry currently claimed
+	int noErr = 0;  // Expected value of firstErr
+
+	// RESOLVE
+	while (1)
+	{
+		todoNum = __atomic_fetch_add(&(scan->nextTodo), 1, __ATOMIC_ACQ_REL);
+
+		if (todoNum >= scan->numTodo)
+		{
+			break;
+		}
+		currEnt = scan->dir_ptr->hdEnt_arr + scan->todo_arr[todoNum];
+		target = NULL;
+
+		// 1. Already resolved?
+		if (currEnt->hd_inodeNum)
+		{
+			pthread_mutex_lock(&(cache_ptr->lock));
+			slot_ptr = find_link_slot(cache_ptr, scan->dirDev, currEnt->hd_inodeNum);
+			target = slot_ptr->hl_target;
+			if (target)
+			{
+				cache_ptr->numHits++;
+			}
+			pthread_mutex_unlock(&(cache_ptr->lock));
+		}
+
+		// 2. Read it
+		if (!target)
+		{
+			numBytesRead = readlinkat(scan->dirFD, scan->dir_ptr->strPool + currEnt->hd_NameOff, symName, HDIR_BIG_BUFF_SIZE);
+
+			if (numBytesRead < 0)
+			{
+				__atomic_compare_exchange_n(&(scan->firstErr), &noErr, errno, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+				noErr = 0;
+				continue;
+			}
+			symName[numBytesRead] = '\0';
+			target = cache_link_target(cache_ptr, scan->dirDev, currEnt->hd_inodeNum, symName);
+
+			if (!target)
+			{
+				__atomic_compare_exchange_n(&(scan->firstErr), &noErr, ENOMEM, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+				noErr = 0;
+				continue;
+			}
+		}
+
+		scan->target_arr[todoNum] = target;
+	}
+
+	// DONE
+	return NULL;
+}
+
+
+hlSlot_ptr find_link_slot(hdLinkCache_ptr cache_ptr, dev_t devNum, ino_t inodeNum)
+{
+	// LOCAL VARIABLES
+	size_t mask = cache_ptr->numSlots - 1;  // numSlots is a power of 2
+	size_t index = hash_link_key(devNum, inodeNum) & mask;  // Current slot
+
+	// PROBE (linear)
+	while (cache_ptr->slot_arr[index].hl_target)
+	{
+		if (cache_ptr->slot_arr[index].hl_inodeNum == inodeNum && cache_ptr->slot_arr[index].hl_dev == devNum)
+		{
+			break;
+		}
+		index = (index + 1) & mask;
+	}
+
+	// DONE
+	return cache_ptr->slot_arr + index;
+}
+
+
+const char* cache_link_target(hdLinkCache_ptr cache_ptr, dev_t devNum, ino_t inodeNum, const char* target)
+{
+	// LOCAL VARIABLES
+	const char* retVal = NULL;
+	hlSlot_ptr slot_ptr = NULL;  // (dev, inode) slot
+
+	pthread_mutex_lock(&(cache_ptr->lock));
+
+	// 1. Intern the text
+	retVal = str_set_add(cache_ptr->target_ptr, target, NULL);
+	cache_ptr->numMisses++;
+
+	// 2. Record the key (another thread may have beaten us to it)
+	if (retVal && inodeNum)
+	{
+		if ((cache_ptr->numLinks + 1) * 2 > cache_ptr->numSlots)
+		{
+			grow_link_cache(cache_ptr);  // If it fails, the table still has room
+		}
+
+		slot_ptr = find_link_slot(cache_ptr, devNum, inodeNum);
+
+		if (!(slot_ptr->hl_target) && (cache_ptr->numLinks + 1) < cache_ptr->numSlots)
+		{
+			slot_ptr->hl_dev = devNum;
+			slot_ptr->hl_inodeNum = inodeNum;
+			slot_ptr->hl_target = retVal;
+			cache_ptr->numLinks++;
+		}
+	}
+
+	pthread_mutex_unlock(&(cache_ptr->lock));
+
+	// DONE
+	return retVal;
+}
+
+
+bool grow_link_cache(hdLinkCache_ptr cache_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	hlSlot_ptr oldSlot_arr = cache_ptr->slot_arr;  // Current table
+	size_t oldNumSlots = cache_ptr->numSlots;  // Current table size
+	hlSlot_ptr newSlot_arr = get_me_memory(oldNumSlots * 2 * sizeof(hlSlot));
+	size_t mask = (oldNumSlots * 2) - 1;  // New table mask
+	size_t index = 0;  // Slot in the new table
+	size_t i = 0;  // Iterating variable
+
+	// REHASH
+	if (!newSlot_arr)
+	{
+		HARKLE_ERROR(Harkledir, grow_link_cache, get_me_memory failed);
+		retVal = false;
+	}
+	else
+	{
+		for (i = 0; i < oldNumSlots; i++)
+		{
+			if (oldSlot_arr[i].hl_target)
+			{
+				// No duplicates, so no need to compare keys
+				index = hash_link_key(oldSlot_arr[i].hl_dev, oldSlot_arr[i].hl_inodeNum) & mask;
+
+				while (newSlot_arr[index].hl_target)
+				{
+					index = (index + 1) & mask;
+				}
+				newSlot_arr[index] = oldSlot_arr[i];
+			}
+		}
+
+		cache_ptr->slot_arr = newSlot_arr;
+		cache_ptr->numSlots = oldNumSlots * 2;
+		free(oldSlot_arr);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+uint64_t hash_link_key(dev_t devNum, ino_t inodeNum)
+{
+	// LOCAL VARIABLES
+	uint64_t retVal = ((uint64_t)inodeNum) ^ (((uint64_t)devNum) * 0x9e3779b97f4a7c15ULL);
+
+	// MIX (splitmix64 finalizer)
+	retVal ^= retVal >> 30;
+	retVal *= 0xbf58476d1ce4e5b9ULL;
+	retVal ^= retVal >> 27;
+	retVal *= 0x94d049bb133111ebULL;
+	retVal ^= retVal >> 31;
+
+	// DONE
+	return retVal;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////// SYMBOLIC LINK FUNCTIONS STOP ////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// GENERAL FUNCTIONS START //////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -11,6 +11,8 @@
 #define __HARKLEDIR__
 
 #include <dirent.h>		// struct dirent
+#include "Memoroad.h"	// memStrSet_ptr
+#include <pthread.h>	// pthread_mutex_t
 #include <stdbool.h>	// bool, true, false
 #include <stdlib.h>		// size_t
 #include <sys/types.h>	// ino_t
@@ -33,6 +35,9 @@ typedef struct harkleDirEnt
 	ino_t hd_inodeNum;			// Should match struct dirent.d_ino
 	unsigned char hd_type; 		// Should match struct dirent.d_type
 	char* hd_symName;			// If hd_type == DT_LNK, read from readlink()
+	size_t hd_NameOff;			// Offset of hd_Name into the owning dirDetails' strPool, 0 if not pooled
+	size_t hd_AbsNameOff;		// Offset of hd_AbsName into the owning dirDetails' strPool, 0 if not pooled
+	size_t hd_symNameOff;		// Offset of hd_symName into the owning dirDetails' strPool, 0 if none
 } hdEnt, *hdEnt_ptr;
 
 typedef struct directoryDetails
@@ -44,8 +49,67 @@ typedef struct directoryDetails
 	int numDirs;				// Number of hdEnt struct pointers in dirName_arr
 	hdEnt_ptr* dirName_arr;		// Array of pointers to hdEnt structs storing directory information
 	size_t dirArrSize;			// Allocated bytes for dirName_arr
+	hdEnt_ptr hdEnt_arr;		// Contiguous storage for every hdEnt fileName_arr and dirName_arr point into
+	size_t numEnts;				// Number of hdEnt structs in hdEnt_arr
+	size_t entArrLen;			// Number of hdEnt structs hdEnt_arr can hold
+	char* strPool;				// Every hd_Name, hd_AbsName, and hd_symName, back-to-back (byte 0 is always nul)
+	size_t poolUsed;			// Bytes of strPool in use
+	size_t poolSize;			// Allocated bytes for strPool
 } dirDetails, *dirDetails_ptr;
 
+typedef struct harkleDirStream
+{
+	int dirFD;					// Open directory file descriptor, -1 if closed
+	char* buff_ptr;				// getdents64 destination
+	size_t buffSize;			// Size of buff_ptr
+	size_t numRead;				// Bytes of buff_ptr filled by the last getdents64
+	size_t offset;				// Offset of the next record in buff_ptr
+} hdStream, *hdStream_ptr;
+
+typedef struct harkleWalkEntry
+{
+	const char* hw_Path;		// Path of the entry (rootName + relative path), only valid during the callback
+	const char* hw_Name;		// Name of the entry, points into hw_Path
+	unsigned char hw_type;		// DT_* file type
+	ino_t hw_inodeNum;			// Inode number
+	int hw_depth;				// 0 for entries directly inside rootName
+	int hw_dirFD;				// Open file descriptor of the directory holding the entry (see: openat(), fstatat())
+} hwEnt, *hwEnt_ptr;
+
+typedef struct harkleWalkFilter
+{
+	unsigned int typeFlags;		// bitwise OR of "typeFlags" MACRO FLAGS to report, 0 for HDIR_DT_ALL
+	const char* nameGlob;		// fnmatch() pattern entry names must match to be reported, NULL for all
+	int maxDepth;				// Deepest hw_depth to report and descend into, -1 for no limit
+} hdFilter, *hdFilter_ptr;
+
+typedef struct harkleLinkSlot
+{
+	dev_t hl_dev;				// Device of the symbolic link
+	ino_t hl_inodeNum;			// Inode of the symbolic link
+	const char* hl_target;		// Interned link text, NULL if the slot is empty
+} hlSlot, *hlSlot_ptr;
+
+typedef struct harkleLinkCache
+{
+	hlSlot_ptr slot_arr;		// Open-addressed (dev, inode) table
+	size_t numSlots;			// Always a power of 2
+	size_t numLinks;			// Occupied slots
+	memStrSet_ptr target_ptr;	// Every link text, interned, so repeated targets share one copy
+	pthread_mutex_t lock;		// Guards everything above
+	size_t numHits;				// Links resolved from slot_arr
+	size_t numMisses;			// Links resolved with readlinkat()
+} hdLinkCache, *hdLinkCache_ptr;
+
+/*
+	walk_dir_tree() callback
+		entry_ptr - An entry that passed the filter
+		userData - Passed through from walk_dir_tree()
+	Return true to keep walking, false to stop
+	Called concurrently from every worker thread, so it must be thread-safe
+ */
+typedef bool (*hdWalkCallback)(hwEnt_ptr entry_ptr, void* userData);
+
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////// HARKLEDIRENT FUNCTIONS START ////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -82,6 +146,8 @@ bool populate_hdEnt_struct(hdEnt_ptr updateThis_ptr, struct dirent* currDirEntry
 	Output - true on success, false on failure
 	Notes:
 		Will likely make multiple calls to Memoroad's release_a_string()
+		Only for hdEnt structs from create_hdEnt_ptr().  The entries of a
+			dirDetails are owned by it (see: free_dirDetails_ptr()).
  */
 bool free_hdEnt_ptr(hdEnt_ptr* oldStruct_ptr);
 
@@ -112,10 +178,31 @@ dirDetails_ptr create_dirDetails_ptr(void);
 	Output - heap-allocated, fully populated, directoryDetails struct pointer
 	Notes:
 		If directoryName is NULL or empty, will default to cwd
+		Entries are stored contiguously in hdEnt_arr and their strings in
+			strPool, both of which grow geometrically while the directory is
+			read.  Once it's read, fileName_arr and dirName_arr are built and
+			every hd_Name, hd_AbsName, and hd_symName is pointed into strPool
+			so existing callers can keep using them.
+		Treat the hdEnt strings as read-only; they are not individually allocated
  */
 dirDetails_ptr open_dir(char* directoryName);
 
 
+/*
+	Purpose - open_dir(), resolving symbolic links through a cache
+	Input
+		directoryName - Same as open_dir()
+		cache_ptr - Optional.  Link cache shared between calls (see: create_link_cache()).
+		numThreads - Number of threads to resolve symbolic links with, 0 for one-per-CPU
+	Output - Same as open_dir()
+	Notes:
+		Symbolic links are read after the directory, in one batch, with
+			readlinkat() relative to the open directory (see: resolve_dirDetails_links())
+		open_dir() is open_dir_cached(directoryName, NULL, 1)
+ */
+dirDetails_ptr open_dir_cached(char* directoryName, hdLinkCache_ptr cache_ptr, int numThreads);
+
+
 /*
 	Purpose - Zeroize, nullify, and free a heap-allocated directoryDetails struct pointer
 	Input
@@ -124,6 +211,8 @@ dirDetails_ptr open_dir(char* directoryName);
 	Notes:
 		Will memset(0x0), free, and NULL any pointers
 		Will zeroize all other members
+		Pooled storage (see: open_dir()) is wiped and freed in bulk.  Otherwise,
+			free_hdEnt_ptr() is called on each entry.
  */
 bool free_dirDetails_ptr(dirDetails_ptr* oldStruct_ptr);
 
@@ -139,6 +228,9 @@ bool free_dirDetails_ptr(dirDetails_ptr* oldStruct_ptr);
 		resolveLinks
 			If true, hd_symName is used for symbolic link files
 			If false, hd_Name is used for all entries
+	Notes:
+		Unique entries are tracked in a memStrSet, so deduplication is O(1)
+			expected per entry
  */
 char** parse_dirDetails_to_char_arr(dirDetails_ptr dirStruct_ptr, unsigned int typeFlags, bool uniqueEntries, bool resolveLinks);
 
@@ -146,6 +238,151 @@ char** parse_dirDetails_to_char_arr(dirDetails_ptr dirStruct_ptr, unsigned int t
 ////////////////////// DIRECTORYDETAILS FUNCTIONS STOP ///////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////// DIRECTORY STREAM FUNCTIONS START ////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+/*
+	Purpose - Open a directory for bulk reading with getdents64
+	Input
+		stream_ptr - [OUT] Caller-allocated harkleDirStream struct to initialize
+		directoryName - Nul-terminated directory name
+		buffSize - Size of the getdents64 buffer, 0 for HDIR_DENTS_BUFF
+		errNum - [OUT] errno value on failure, 0 on success
+	Output - true on success, false on failure
+	Notes:
+		It is the caller's responsibility to call close_dir_stream()
+ */
+bool open_dir_stream(hdStream_ptr stream_ptr, const char* directoryName, size_t buffSize, int* errNum);
+
+
+/*
+	Purpose - Yield the next entry from a directory stream
+	Input
+		stream_ptr - An open harkleDirStream
+		name_ptr - [OUT] Nul-terminated entry name, only valid until the next call
+		fileType - [OUT] DT_* file type of the entry
+		inodeNum - [OUT] Optional.  Inode number of the entry.
+		errNum - [OUT] errno value if getdents64 failed, 0 otherwise
+	Output - true if an entry was yielded, false at the end of the directory
+		(errNum == 0) or on error (errNum != 0)
+	Notes:
+		Records are parsed in place, so no memory is allocated per entry
+		DT_UNKNOWN entries are resolved with fstatat() relative to the open
+			directory, without following symbolic links.  If the entry
+			disappeared in the meantime, fileType stays DT_UNKNOWN.
+		"." and ".." are yielded like any other entry
+ */
+bool next_dir_entry(hdStream_ptr stream_ptr, const char** name_ptr, unsigned char* fileType, ino_t* inodeNum, int* errNum);
+
+
+/*
+	Purpose - Close a directory stream and free its buffer
+	Input
+		stream_ptr - An harkleDirStream from open_dir_stream()
+	Output - true on success, false on failure
+ */
+bool close_dir_stream(hdStream_ptr stream_ptr);
+
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////// DIRECTORY STREAM FUNCTIONS STOP /////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+///////////////////////// DIRECTORY WALK FUNCTIONS START /////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+/*
+	Purpose - Recursively walk a directory tree in parallel
+	Input
+		rootName - Nul-terminated directory name to start from
+		filter_ptr - Optional.  Which entries to report and how deep to go.
+			NULL reports everything at every depth.
+		callback - Called once for each entry that passes the filter
+		userData - Passed through to callback
+		numThreads - Number of worker threads, 0 for one-per-CPU
+		errNum - [OUT] First errno encountered (e.g., an unreadable directory), 0 if none
+	Output - Number of entries reported to callback
+	Notes:
+		Each worker keeps a deque of directories: it pushes and pops its own
+			at the bottom (depth first) and steals from the top of the others'
+			when it runs dry.  A worker with nothing to steal sleeps until a
+			directory is queued or the walk finishes.
+		Subdirectories are opened with openat() relative to their parent's
+			open descriptor, up to HDIR_WALK_MAX_OPEN held open at once
+		Filters are applied inside the workers, before callback
+		Symbolic links are reported but never followed
+		"." and ".." are never reported
+		Unreadable directories are skipped, not fatal
+		A worker that can't allocate its getdents64 buffer stops the walk
+			early with errNum set to ENOMEM
+ */
+size_t walk_dir_tree(const char* rootName, hdFilter_ptr filter_ptr, hdWalkCallback callback, void* userData, int numThreads, int* errNum);
+
+
+//////////////////////////////////////////////////////////////////////////////
+///////////////////////// DIRECTORY WALK FUNCTIONS STOP //////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////// SYMBOLIC LINK FUNCTIONS START ///////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+/*
+	Purpose - Allocate a cache of resolved symbolic links
+	Input
+		numExpected - Number of links the cache should hold without growing, 0 for a default
+	Output
+		On success, a heap-allocated harkleLinkCache struct pointer
+		On failure, NULL
+	Notes:
+		Links are keyed by (dev, inode), so a link that was already resolved
+			(e.g., the same /proc/<PID>/map_files/ entry on a later pass) costs
+			no system call
+		Link text is interned, so the same library mapped by thousands of
+			processes is stored once
+		Safe to share between threads
+		It is the caller's responsibility to call free_link_cache()
+ */
+hdLinkCache_ptr create_link_cache(size_t numExpected);
+
+
+/*
+	Purpose - Resolve every unresolved symbolic link in a directoryDetails
+	Input
+		dirStruct_ptr - directoryDetails struct pointer to update
+		cache_ptr - Optional.  Link cache to consult and update.
+		numThreads - Number of threads to resolve with, 0 for one-per-CPU
+	Output - true on success, false on failure (e.g., a link disappeared)
+	Notes:
+		Opens dirName once and calls readlinkat() relative to it
+		Only DT_LNK entries with no hd_symName are resolved
+		Fewer threads are used for small directories (see: HDIR_LINK_MIN_PER_THREAD)
+ */
+bool resolve_dirDetails_links(dirDetails_ptr dirStruct_ptr, hdLinkCache_ptr cache_ptr, int numThreads);
+
+
+/*
+	Purpose - Zeroize and free a link cache, to include its interned link text
+	Input
+		oldCache_ptr - Pointer to a hdLinkCache_ptr
+	Output - true on success, false on failure
+	Notes:
+		*oldCache_ptr will be NULLed
+		hd_symName strings are copies, so dirDetails resolved through the
+			cache remain valid
+ */
+bool free_link_cache(hdLinkCache_ptr* oldCache_ptr);
+
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////// SYMBOLIC LINK FUNCTIONS STOP ////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// GENERAL FUNCTIONS START //////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -1,13 +1,11 @@
 #include <fenv.h>				// fegetround(), fesetround()
-#include <float.h>				// DBL_MANT_DIG, DBL_MIN_EXP
 #include "Harklecurse.h"		// hcCartCoord_ptr
 #include "Harklemath.h"			// HM_* MACROs
 #include "Harklerror.h"			// HARKLE_ERROR
 #include <limits.h>				// INT_MIN, INT_MAX
 #include <math.h>				// sqrt()
 #include <stdbool.h>			// bool, true, false
-#include <stdio.h>				// sprintf()
-#include <stdlib.h>				// atof()
+#include <stdlib.h>				// calloc(), free()
 #include <string.h>             // memset
 
 // PLACEHOLDERS FOR DOUBLE COMPARISON FUNCTIONS
@@ -22,33 +20,10 @@
 #define HARKLEMATH_MAX_TRIES 3
 #endif  // HARKLEMATH_MAX_TRIES
 
-
-/*
-	PURPOSE - A local helper function, local to Harklemath.c, to calculate
-		*this* machine's maximum level of precision at runtime
-	INPUT - None
-	OUTPUT
-		On success, maximum level of decimal places supported
-		On failure, 0
-	NOTES
-		This funciton will attempt to calculate both "accuracy in
-			calculations" and "accuracy in storage" then return the lowest
-			value between the two
- */
-int calc_max_precision(void);
-
-
-/*
-	PURPOSE - Quick/dirty method of removing certain decimal places from
-		a double
-	INPUT
-		val - Double to truncate
-		digits - Number of decimals places to keep, truncate everything else
-	OUTPUT
-		On success, val with only digits-number of decimal places
-		On failure, 0
- */
-double truncate_double(double val, int digits);
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HMATH_X86				// SSE2/SSE4.1/AVX batch engines are available
+#include <immintrin.h>			// _mm_*(), _mm256_*()
+#endif  // x86 GCC/Clang
 
 
 /*
@@ -80,11 +55,81 @@ double truncate_double(double val, int digits);
 bool translate_plot_points(int relX, int relY, int cntX, int cntY, int* absX, int* absY);
 
 
+/*
+	PURPOSE - plot_ellipse_batch() engines:  calculate one quadrant of an ellipse
+		along its major axis
+	INPUT
+		majAxis - Half the major axis
+		minAxis - Half the minor axis
+		quad_arr - [OUT] quad_arr[i] is the minor axis coordinate at major axis
+			coordinate i, calculated like calc_ellipse_y_coord() does
+		numQuad - Number of doubles to calculate
+	OUTPUT - None
+ */
+void hm_quadrant_scalar(double majAxis, double minAxis, double* quad_arr, int numQuad);
+#ifdef HMATH_X86
+void hm_quadrant_sse2(double majAxis, double minAxis, double* quad_arr, int numQuad) __attribute__((target("sse2")));
+void hm_quadrant_avx(double majAxis, double minAxis, double* quad_arr, int numQuad) __attribute__((target("avx")));
+#endif  // HMATH_X86
+
+
+/*
+	PURPOSE - round_dble_arr() engines
+	INPUT - Same as round_dble_arr() but pre-validated
+	OUTPUT - None
+ */
+void hm_round_scalar(const double* roundMe_arr, int* rounded_arr, int numDbls, int rndDir);
+#ifdef HMATH_X86
+void hm_round_sse41(const double* roundMe_arr, int* rounded_arr, int numDbls, int rndDir) __attribute__((target("sse4.1")));
+void hm_round_avx(const double* roundMe_arr, int* rounded_arr, int numDbls, int rndDir) __attribute__((target("avx")));
+#endif  // HMATH_X86
+
+
+// Batch engines, upgraded by the CPU's capabilities where available (see: hm_pick_engines())
+void (*hmQuadrantEngine)(double, double, double*, int) = hm_quadrant_scalar;
+void (*hmRoundEngine)(const double*, int*, int, int) = hm_round_scalar;
+
+
+#ifdef HMATH_X86
+/*
+	PURPOSE - Choose the fastest batch engines this CPU supports
+	INPUT - None
+	OUTPUT - None
+	NOTES
+		Runs as a constructor, before main() and any threads, so the batch
+			functions only ever read hmQuadrantEngine and hmRoundEngine
+ */
+void hm_pick_engines(void) __attribute__((constructor));
+#endif  // HMATH_X86
+
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////// FLOATING POINT FUNCTIONS START ///////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
 
+// 1.0 multiplied by 0.1 precision-times, exactly as the old calc_precision() loop rounded it
+const double hmTolerance_arr[HM_MAX_PRECISION + 1] = {
+	0x1p+0,                  // 1 (unused)
+	0x1.999999999999ap-4,    // 1e-1
+	0x1.47ae147ae147cp-7,    // 1e-2
+	0x1.0624dd2f1a9fdp-10,   // 1e-3
+	0x1.a36e2eb1c432fp-14,   // 1e-4
+	0x1.4f8b588e368f3p-17,   // 1e-5
+	0x1.0c6f7a0b5ed8fp-20,   // 1e-6
+	0x1.ad7f29abcaf4cp-24,   // 1e-7
+	0x1.5798ee2308c3dp-27,   // 1e-8
+	0x1.12e0be826d697p-30,   // 1e-9
+	0x1.b7cdfd9d7bdbfp-34,   // 1e-10
+	0x1.5fd7fe1796499p-37,   // 1e-11
+	0x1.19799812dea14p-40,   // 1e-12
+	0x1.c25c268497687p-44,   // 1e-13
+	0x1.6849b86a12bap-47,    // 1e-14
+	0x1.203af9ee7561ap-50,   // 1e-15
+	0x1.cd2b297d889c4p-54,   // 1e-16
+};
+
+
 /*
 	PURPOSE - Abstract the process of rounding a double to an int
 	INPUT
@@ -170,248 +215,142 @@ int round_a_dble(double roundMe, int rndDir)
 	// DONE
 	return retVal;
 }
-	
-	
-bool dble_greater_than(double x, double y, int precision)
+
+
+bool round_dble_arr(const double* roundMe_arr, int* rounded_arr, int numDbls, int rndDir)
 {
 	// LOCAL VARIABLES
-	bool retVal = false;  // Prove this wrong
-	bool success = true;  // Set this to false if anything fails
-	double dbleMask = 0;  // "Mask" to remove undesired values of doubles
-	
+	bool retVal = true;  // If anything fails, make this false
+	int i = 0;  // Iterating variable
+
 	// INPUT VALIDATION
-	if (precision < 1)
+	if (!roundMe_arr || !rounded_arr)
 	{
-		HARKLE_ERROR(Harklemath, dble_greater_than, Invalid precision);
-		success = false;
+		HARKLE_ERROR(Harklemath, round_dble_arr, NULL pointer);
+		retVal = false;
 	}
-	
-	// CALC PRECISION
-	if (true == success)
+	else if (numDbls < 1)
 	{
-		dbleMask = calc_precision(precision);
-		
-		if (!dbleMask)
+		HARKLE_ERROR(Harklemath, round_dble_arr, Invalid numDbls);
+		retVal = false;
+	}
+	else
+	{
+		for (i = 0; i < numDbls; i++)
 		{
-			HARKLE_ERROR(Harklemath, dble_greater_than, calc_precision failed);
-			success = false;
+			// Also catches NaN
+			if (!(roundMe_arr[i] <= (double)INT_MAX && roundMe_arr[i] >= (double)INT_MIN))
+			{
+				HARKLE_ERROR(Harklemath, round_dble_arr, int overflow);
+				retVal = false;
+				break;
+			}
 		}
 	}
-	
-	// COMPARE DOUBLES
-	if (true == success)
+
+	// ROUND
+	if (true == retVal)
 	{
-		if (x > y && (x + dbleMask) > (y + dbleMask) && (x - dbleMask) > (y - dbleMask))
-		{
-			retVal = true;	
-		}		
-	}	
-	
+		hmRoundEngine(roundMe_arr, rounded_arr, numDbls, rndDir);
+	}
+
 	// DONE
 	return retVal;
 }
-
-
-bool dble_less_than(double x, double y, int precision)
+	
+	
+bool dble_compare_arr(const double* x_arr, const double* y_arr, bool* result_arr, int numDbls, int precision, int cmpType)
 {
 	// LOCAL VARIABLES
-	bool retVal = false;  // Prove this wrong
 	bool success = true;  // Set this to false if anything fails
 	double dbleMask = 0;  // "Mask" to remove undesired values of doubles
-	double xVal = truncate_double(x, precision);
-	double yVal = truncate_double(y, precision);
-	
+	int i = 0;  // Iterating variable
+
 	// INPUT VALIDATION
-	if (precision < 1)
+	if (!x_arr || !y_arr || !result_arr)
 	{
-		HARKLE_ERROR(Harklemath, dble_greater_than, Invalid precision);
+		HARKLE_ERROR(Harklemath, dble_compare_arr, NULL pointer);
 		success = false;
 	}
-	
-	// CALC PRECISION
-	if (true == success)
+	else if (numDbls < 0)
 	{
-		dbleMask = calc_precision(precision);
-		
-		if (!dbleMask)
-		{
-			HARKLE_ERROR(Harklemath, dble_greater_than, calc_precision failed);
-			success = false;
-		}
-		// fprintf(stdout, "\nx == %.15f\ty == %.15f\tdbleMask == %.15f\n", x, y, dbleMask);  // DEBUGGING
-		// fprintf(stdout, "\nxTrunc == %.15f\tyTrunc == %.15f\tprecision == %d\n\t\t", xVal, yVal, precision);  // DEBUGGING
-	}
-	
-	// COMPARE DOUBLES
-	if (true == success)
-	{
-		// fprintf(stdout, "\nx == %.15f\ty == %.15f\tdbleMask == %.15f\n", x, y, dbleMask);  // DEBUGGING
-		// fprintf(stdout, "x < y == %.15f < %.15f == %s\n", x, y, (x < y) ? "true" : "false");  // DEBUGGING
-		// fprintf(stdout, "(x + dbleMask) < (y + dbleMask) == %.15f < %.15f == %s\n", \
-		// 	x + dbleMask, y + dbleMask, ((x + dbleMask) < (y + dbleMask)) ? "true" : "false");  // DEBUGGING
-		// fprintf(stdout, "(x - dbleMask) < (y - dbleMask) == %.15f < %.15f == %s\n\t\t", \
-		// 	x - dbleMask, y - dbleMask, ((x - dbleMask) < (y - dbleMask)) ? "true" : "false");  // DEBUGGING
-		if (xVal < yVal)
-		// if (x < y && (x + dbleMask) < (y + dbleMask) && (x - dbleMask) < (y - dbleMask))
-		{
-			retVal = true;	
-		}		
-	}	
-	
-	// DONE
-	return retVal;
-}
-
-
-bool dble_equal_to(double x, double y, int precision)
-{
-	// LOCAL VARIABLES
-	bool retVal = false;  // Prove this wrong
-	bool success = true;  // Set this to false if anything fails
-	double dbleMask = 0;  // "Mask" to remove undesired values of doubles
-	
-	// INPUT VALIDATION
-	if (precision < 1)
-	{
-		HARKLE_ERROR(Harklemath, dble_greater_than, Invalid precision);
+		HARKLE_ERROR(Harklemath, dble_compare_arr, Invalid number of doubles);
 		success = false;
 	}
-	
-	// CALC PRECISION
-	if (true == success)
+	else
 	{
 		dbleMask = calc_precision(precision);
-		
+
 		if (!dbleMask)
 		{
-			HARKLE_ERROR(Harklemath, dble_greater_than, calc_precision failed);
+			HARKLE_ERROR(Harklemath, dble_compare_arr, calc_precision failed);
 			success = false;
 		}
 	}
-	
+
 	// COMPARE DOUBLES
 	if (true == success)
 	{
-		if ((x + dbleMask) > y && (x - dbleMask) < y && x < (y + dbleMask) && x > (y - dbleMask))
+		switch (cmpType)
 		{
-			retVal = true;	
-		}		
-	}	
-	
-	// DONE
-	return retVal;
-}
-
-
-bool dble_not_equal(double x, double y, int precision)
-{
-	// LOCAL VARIABLES
-	bool retVal = true;
-	
-	// CALL dble_equal_to()
-	if (true == dble_equal_to(x, y, precision))
-	{
-		retVal = false;	
-	}
-	
-	// DONE
-	return retVal;
-}
-
-
-bool dble_greater_than_equal_to(double x, double y, int precision)
-{
-	// LOCAL VARIABLES
-	bool retVal = false;
-	
-	// Equal to?
-	if (true == dble_equal_to(x, y, precision))
-	{
-		retVal = true;	
-	}
-	// Greater than?
-	if (true == retVal || true == dble_greater_than(x, y, precision))
-	{
-		retVal = true;	
+			case HM_GT:
+				for (i = 0; i < numDbls; i++)
+				{
+					result_arr[i] = HM_DBLE_GT(x_arr[i], y_arr[i], dbleMask);
+				}
+				break;
+			case HM_LT:
+				for (i = 0; i < numDbls; i++)
+				{
+					result_arr[i] = HM_DBLE_LT(x_arr[i], y_arr[i], dbleMask);
+				}
+				break;
+			case HM_EQ:
+				for (i = 0; i < numDbls; i++)
+				{
+					result_arr[i] = HM_DBLE_EQ(x_arr[i], y_arr[i], dbleMask);
+				}
+				break;
+			case HM_NEQ:
+				for (i = 0; i < numDbls; i++)
+				{
+					result_arr[i] = !HM_DBLE_EQ(x_arr[i], y_arr[i], dbleMask);
+				}
+				break;
+			case HM_GTE:
+				for (i = 0; i < numDbls; i++)
+				{
+					result_arr[i] = HM_DBLE_EQ(x_arr[i], y_arr[i], dbleMask) | HM_DBLE_GT(x_arr[i], y_arr[i], dbleMask);
+				}
+				break;
+			case HM_LTE:
+				for (i = 0; i < numDbls; i++)
+				{
+					result_arr[i] = HM_DBLE_EQ(x_arr[i], y_arr[i], dbleMask) | HM_DBLE_LT(x_arr[i], y_arr[i], dbleMask);
+				}
+				break;
+			default:
+				HARKLE_ERROR(Harklemath, dble_compare_arr, Invalid comparison type);
+				success = false;
+		}
 	}
-	
-	// DONE
-	return retVal;
-}
 
-
-bool dble_less_than_equal_to(double x, double y, int precision)
-{
-	// LOCAL VARIABLES
-	bool retVal = false;
-	
-	// Equal to?
-	if (true == dble_equal_to(x, y, precision))
-	{
-		retVal = true;	
-	}
-	// Less than?
-	if (true == retVal || true == dble_less_than(x, y, precision))
-	{
-		retVal = true;	
-	}
-	
 	// DONE
-	return retVal;
+	return success;
 }
 
 
 double calc_precision(int precision)
 {
 	// LOCAL VARIABLES
-	double retVal = 0.0;  
-	bool success = true;  // If anything fails, make this false
-	int counter = 0;  // Used to count the decimal places
-	static int maxPrec = 0;  // Calculate this machine's maximum level of precision once
-	int currPrec = 0;  // Level of precision this function uses, either maxPrec or precision
-	
-	// CALC MAX PRECISION
-	if (0 == maxPrec)
-	{
-		maxPrec = calc_max_precision();
-		
-		if (0 == maxPrec)
-		{
-			HARKLE_ERROR(Harklemath, calc_precision, calc_max_precision failed);
-			success = false;
-		}
-	}
-	
+	double retVal = hm_tolerance(precision);
+
 	// INPUT VALIDATION
-	if (true == success)
-	{
-		if (precision < 1)
-		{
-			HARKLE_ERROR(Harklemath, calc_precision, Invalid precision);
-			success = false;
-		}
-		else if (precision > maxPrec)
-		{
-			currPrec = maxPrec;	
-		}
-		else
-		{
-			currPrec = precision;	
-		}
-	}
-	
-	// CREATE PRECISION MASK
-	if (true == success)
+	if (!retVal)
 	{
-		retVal = 1.0;  // Starting point
-		
-		while (currPrec > 0 && counter < currPrec)
-		{
-			retVal *= 0.1;  // Shift the decimal
-			counter++;
-		}
+		HARKLE_ERROR(Harklemath, calc_precision, Invalid precision);
 	}
-	
+
 	// DONE
 	return retVal;
 }
@@ -540,17 +479,10 @@ double* plot_ellipse_points(double aVal, double bVal, int* numPnts)
 	// LOCAL VARIABLES
 	double* retVal = NULL;  // Array of double values for ellipse plot points
 	bool success = true;  // If anything fails, make this false
-	double aAbs = 0;  // Rounded absolute value of aVal
-	double bAbs = 0;  // Rounded absolute value of bVal
-	int majAbs = 0;  // Rounded absolute value of the major axis
-	double majPnt = 0;  // Point along the major axis
+	hmPlotPnts_ptr batch_ptr = NULL;  // The points, as calculated by plot_ellipse_batch()
 	int numTries = 0;  // Keeps count of allocation attempts
 	int numPoints = 0;  // Local count of the number of points in the array
-	bool chooseX = true;  // Indicates x is the major axis
-	void* tmp_ptr = NULL;  // Return value from memset
 	int count = 0;  // Iterating variable
-	// This variable is used to reflect points across the major axis
-	double flipIt = 1;  // Multiple this by ellipse point function calls
 
 	// INPUT VALIDATION
 	if (true == dble_equal_to(aVal, 0, DBL_PRECISION))
@@ -573,209 +505,243 @@ double* plot_ellipse_points(double aVal, double bVal, int* numPnts)
 		*numPnts = 0;
 	}
 
-	// DETERMINE MAJOR AXIS
-	if (true == dble_less_than(aVal, bVal, DBL_PRECISION))
+	// CALCULATE COORDINATE PAIRS
+	if (true == success)
 	{
-		chooseX = false;  // Y holds the major axis
+		batch_ptr = plot_ellipse_batch(aVal, bVal);
+
+		if (!batch_ptr)
+		{
+			HARKLE_ERROR(Harklemath, plot_ellipse_points, plot_ellipse_batch failed);
+			success = false;
+		}
+		else
+		{
+			// 2 because each coordinate pair is represented by two doubles
+			numPoints = batch_ptr->numPnts * 2;
+		}
 	}
 
-	// DETERMINE NUMBER OF POINTS
+	// ALLOCATE BUFFER
 	if (true == success)
 	{
-		if (true == dble_not_equal(fabs(aVal), ((int)fabs(aVal)) * 1.0, DBL_PRECISION))
+		while (numTries < HARKLEMATH_MAX_TRIES && !retVal)
 		{
-			aAbs = fabs(aVal);
-			// aAbs = round_a_dble(fabs(aVal), HM_UP);
+			retVal = (double*)calloc(numPoints, sizeof(double));
+			numTries++;
 		}
-		else
+
+		if (!retVal)
 		{
-			aAbs = fabs(aVal);
-			// aAbs = ((int)fabs(aVal));
+			HARKLE_ERROR(Harklemath, plot_ellipse_points, calloc failed);
+			success = false;
 		}
+	}
 
-		if (true == dble_not_equal(fabs(bVal), ((int)fabs(bVal)) * 1.0, DBL_PRECISION))
+	// INTERLEAVE COORDINATE PAIRS
+	if (true == success)
+	{
+		for (count = 0; count < batch_ptr->numPnts; count++)
 		{
-			bAbs = fabs(bVal);
-			// bAbs = round_a_dble(fabs(bVal), HM_UP);
+			retVal[2 * count] = batch_ptr->x_arr[count];
+			retVal[(2 * count) + 1] = batch_ptr->y_arr[count];
 		}
-		else
+		*numPnts = numPoints;
+	}
+
+	// CLEAN UP
+	if (batch_ptr)
+	{
+		if (false == free_hmPlotPnts_ptr(&batch_ptr))
 		{
-			bAbs = fabs(bVal);
-			// bAbs = ((int)fabs(bVal));
+			HARKLE_ERROR(Harklemath, plot_ellipse_points, free_hmPlotPnts_ptr failed);
 		}
-		// fprintf(stdout, "aVal == %.15f\tbVal == %.15f\taAbs == %.15f\tbAbs == %.15f\n", aVal, bVal, aAbs, bAbs);  // DEBUGGING
+	}
 
-		if (true == chooseX)
+	// DONE
+	return retVal;
+}
+
+
+hmPlotPnts_ptr plot_ellipse_batch(double aVal, double bVal)
+{
+	// LOCAL VARIABLES
+	hmPlotPnts_ptr retVal = NULL;  // SoA ellipse plot points
+	bool success = true;  // If anything fails, make this false
+	double majAxis = 0;  // Absolute value of the major axis
+	double minAxis = 0;  // Absolute value of the minor axis
+	int majAbs = 0;  // Truncated absolute value of the major axis
+	bool chooseX = true;  // Indicates x is the major axis
+	double* quad_arr = NULL;  // One quadrant, indexed by major axis coordinate
+	double* maj_arr = NULL;  // retVal's major axis array
+	double* min_arr = NULL;  // retVal's minor axis array
+	int numTries = 0;  // Keeps count of allocation attempts
+	int count = 0;  // Index into retVal's arrays
+	int majPnt = 0;  // Point along the major axis
+
+	// INPUT VALIDATION
+	if (true == dble_equal_to(aVal, 0, DBL_PRECISION))
+	{
+		HARKLE_ERROR(Harklemath, plot_ellipse_batch, aVal is zero);
+		success = false;
+	}
+	else if (true == dble_equal_to(bVal, 0, DBL_PRECISION))
+	{
+		HARKLE_ERROR(Harklemath, plot_ellipse_batch, bVal is zero);
+		success = false;
+	}
+
+	// DETERMINE MAJOR AXIS
+	if (true == success)
+	{
+		if (true == dble_less_than(fabs(aVal), fabs(bVal), DBL_PRECISION))
 		{
-			majAbs = aAbs;
+			chooseX = false;  // Y holds the major axis
+			majAxis = fabs(bVal);
+			minAxis = fabs(aVal);
 		}
 		else
 		{
-			majAbs = bAbs;
+			majAxis = fabs(aVal);
+			minAxis = fabs(bVal);
 		}
 
-		// if (0 == aAbs || 0 == bAbs)
-		// {
-		// 	// fprintf(stdout, "aVal == %.15f\tbVal == %.15f\taAbs == %d\tbAbs == %d\n", aVal, bVal, aAbs, bAbs);  // DEBUGGING
-		// 	HARKLE_ERROR(Harklemath, plot_ellipse_points, round_a_dble failed);
-		// 	success = false;
-		// }
-		// else
-		// {
-		// 	// majAbs is 1/2 the major axis
-		// 	// 4 for the four quadrants
-		// 	// 2 because each coordinate pair is represented by two doubles
-		// 	numPoints = majAbs * 4 * 2;
-
-		// 	if (numPoints < 8 || 0 != numPoints % 4)
-		// 	{
-		// 		HARKLE_ERROR(Harklemath, plot_ellipse_points, Number of points miscalculated);
-		// 		success = false;
-		// 	}
-		// }
-
-
-		// majAbs is 1/2 the major axis
-		// 4 for the four quadrants
-		// 2 because each coordinate pair is represented by two doubles
-		numPoints = majAbs * 4 * 2;
-
-		if (numPoints < 8 || 0 != numPoints % 4)
+		// 4 for the four quadrants must fit in an int
+		if (majAxis < 1 || majAxis > (INT_MAX / 4))
 		{
-			HARKLE_ERROR(Harklemath, plot_ellipse_points, Number of points miscalculated);
+			HARKLE_ERROR(Harklemath, plot_ellipse_batch, Number of points miscalculated);
 			success = false;
 		}
+		else
+		{
+			majAbs = (int)majAxis;
+		}
 	}
 
-	// ALLOCATE BUFFER
+	// ALLOCATE
 	if (true == success)
 	{
 		while (numTries < HARKLEMATH_MAX_TRIES && !retVal)
 		{
-			retVal = (double*)calloc(numPoints, sizeof(double));
+			retVal = (hmPlotPnts_ptr)calloc(1, sizeof(hmPlotPnts));
 			numTries++;
 		}
 
-		if (!retVal)
+		if (retVal)
 		{
-			HARKLE_ERROR(Harklemath, plot_ellipse_points, calloc failed);
+			retVal->numPnts = majAbs * 4;
+			retVal->x_arr = (double*)calloc(retVal->numPnts, sizeof(double));
+			retVal->y_arr = (double*)calloc(retVal->numPnts, sizeof(double));
+			quad_arr = (double*)calloc(majAbs + 1, sizeof(double));
+		}
+
+		if (!retVal || !(retVal->x_arr) || !(retVal->y_arr) || !quad_arr)
+		{
+			HARKLE_ERROR(Harklemath, plot_ellipse_batch, calloc failed);
 			success = false;
 		}
 	}
 
-	// CALCULATE COORDINATE PAIRS
-	while (count < numPoints)
+	// CALCULATE ONE QUADRANT
+	if (true == success)
+	{
+		hmQuadrantEngine(majAxis, minAxis, quad_arr, majAbs + 1);
+	}
+
+	// MIRROR IT
+	if (true == success)
 	{
 		if (true == chooseX)
 		{
-			// Starting point on the major axis
-			if (0 == count)  // (-a, 0)
-			{
-				majPnt = -1 * majAbs;
-			}
-			// Set the x-point for this coordinate in the array
-			retVal[count] = majPnt;
-			// fprintf(stdout, "%d x == %.15f\n", count, retVal[count]);  // DEBUGGING
-			count++;  // Next point
-			// Set y-pont for this coordinate in the array
-			// fprintf(stdout, "\naAbs == %d\tbAbs == %d\tmajPnt == %.15f\n", aAbs, bAbs, majPnt);  // DEBUGGING
-			retVal[count] = flipIt * calc_ellipse_y_coord(aAbs, bAbs, majPnt);
-			// fprintf(stdout, "%d y == %.15f\n", count, retVal[count]);  // DEBUGGING
-			// Error check calc_ellipse_y_coord()
-			// if (0 == retVal[count])
-			// {
-			// 	HARKLE_ERROR(Harklemath, plot_ellipse_points, calc_ellipse_y_coord failed);
-			// 	success = false;
-			// 	break;
-			// }
-			count++;  // Next point
-
-			// Continue incrementing along the major axis
-			// fprintf(stdout, "\ncount == %d and numPoints == %d\n", count, numPoints);  // DEBUGGING
-			///////////////////////////////////// BUG IS HERE //////////////////////////////////////
-			if (count > numPoints / 2)  // (a, 0)
+			maj_arr = retVal->x_arr;
+			min_arr = retVal->y_arr;
+
+			// (-a, 0) through (0, b) to (+a, 0)
+			for (majPnt = -majAbs; majPnt <= majAbs; majPnt++, count++)
 			{
-				majPnt--;
-				flipIt = -1;
+				maj_arr[count] = majPnt;
+				min_arr[count] = quad_arr[abs(majPnt)];
 			}
-			else
+			// Through (0, -b) back to (-a + 1, y)
+			for (majPnt = majAbs - 1; majPnt > -majAbs; majPnt--, count++)
 			{
-				majPnt++;
-				flipIt = 1;
+				maj_arr[count] = majPnt;
+				min_arr[count] = -quad_arr[abs(majPnt)];
 			}
 		}
 		else
 		{
-			// Starting point on the major axis
-			if (0 == count)  // (-a, 0)
-			{
-				majPnt = 0;
-				flipIt = -1;
-			}
-			// Set x in the array
-			retVal[count] = flipIt * calc_ellipse_x_coord(aAbs, bAbs, majPnt);
-			// Error check calc_ellipse_x_coord()
-			// if (0 == retVal[count])
-			// {
-			// 	HARKLE_ERROR(Harklemath, plot_ellipse_points, calc_ellipse_x_coord failed);
-			// 	success = false;
-			// 	break;
-			// }
-			count++;  // Next point
-			// Set y in the array
-			retVal[count] = majPnt;
-
-			// Continue incrementing along the major axis
-			// Quadrant II
-			if (count <= numPoints / 4)
+			maj_arr = retVal->y_arr;
+			min_arr = retVal->x_arr;
+
+			// (-a, 0) up to (0, b)
+			for (majPnt = 0; majPnt <= majAbs; majPnt++, count++)
 			{
-				majPnt++;
-				flipIt = -1;
+				maj_arr[count] = majPnt;
+				min_arr[count] = -quad_arr[majPnt];
 			}
-			// Quadrant I
-			// else if (count <= numPoints / 2)
-			// {
-			// 	majPnt--;
-			// 	flipIt = 1;
-			// }
-			// Quadrant I through Quadrant IV
-			else if (count <= (3 * numPoints / 4))
+			// Through (+a, 0) down to (0, -b)
+			for (majPnt = majAbs - 1; majPnt >= -majAbs; majPnt--, count++)
 			{
-				majPnt--;
-				flipIt = 1;				
+				maj_arr[count] = majPnt;
+				min_arr[count] = quad_arr[abs(majPnt)];
 			}
-			// Quadrant III
-			else
+			// Back up to (-a, -1)
+			for (majPnt = -majAbs + 1; majPnt < 0; majPnt++, count++)
 			{
-				majPnt++;
-				flipIt = -1;
+				maj_arr[count] = majPnt;
+				min_arr[count] = -quad_arr[-majPnt];
 			}
 		}
 	}
 
-	// WRAP UP/CLEAN UP
-	// Wrap up
-	if (true == success)
+	// CLEAN UP
+	free(quad_arr);
+
+	if (false == success && retVal)
 	{
-		*numPnts = numPoints;
+		if (false == free_hmPlotPnts_ptr(&retVal))
+		{
+			HARKLE_ERROR(Harklemath, plot_ellipse_batch, free_hmPlotPnts_ptr failed);
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool free_hmPlotPnts_ptr(hmPlotPnts_ptr* oldStruct_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;  // If anything fails, make this false
+
+	// INPUT VALIDATION
+	if (!oldStruct_ptr || !(*oldStruct_ptr))
+	{
+		HARKLE_ERROR(Harklemath, free_hmPlotPnts_ptr, NULL pointer);
+		retVal = false;
 	}
-	// Clean up
-	else if (retVal)
+	else
 	{
-		// Zeroize retVal
-		if (numPoints > 0)
+		// Zeroize/Free/NULL the arrays
+		if ((*oldStruct_ptr)->x_arr)
 		{
-			tmp_ptr = memset(retVal, 0x0, numPoints);
-
-			if (tmp_ptr != retVal)
-			{
-				HARKLE_ERROR(Harklemath, plot_ellipse_points, memset failed);
-			}
+			memset((*oldStruct_ptr)->x_arr, 0x0, (*oldStruct_ptr)->numPnts * sizeof(double));
+			free((*oldStruct_ptr)->x_arr);
+			(*oldStruct_ptr)->x_arr = NULL;
+		}
+		if ((*oldStruct_ptr)->y_arr)
+		{
+			memset((*oldStruct_ptr)->y_arr, 0x0, (*oldStruct_ptr)->numPnts * sizeof(double));
+			free((*oldStruct_ptr)->y_arr);
+			(*oldStruct_ptr)->y_arr = NULL;
 		}
-		// Free retVal
-		free(retVal);
-		// NULL retVal
-		retVal = NULL;
+		(*oldStruct_ptr)->numPnts = 0;
+
+		// Free/NULL the struct
+		free(*oldStruct_ptr);
+		*oldStruct_ptr = NULL;
 	}
 
 	// DONE
@@ -894,8 +860,8 @@ hcCartCoord_ptr build_geometric_list(double* relEllipseCoords, int numPnts, int
 {
 	// LOCAL VARIABLES
 	hcCartCoord_ptr retVal = NULL;
-	hcCartCoord_ptr newNode = NULL;  // Newly created node prior to linking
-	hcCartCoord_ptr tmpNode = NULL;  // Return value from add_cartCoord_node()
+	hcTrack_ptr track_ptr = NULL;  // Contiguous track holding every node
+	int* rounded_arr = NULL;  // relEllipseCoords, rounded up
 	int tmpX = 0;  // Temporary x value translated from the double array
 	int tmpY = 0;  // Temporary y value translated from the double array
 	int tmpAbsX = 0;  // Temp x value translated from tmpX around center coordinate (centX, centY)
@@ -925,16 +891,45 @@ hcCartCoord_ptr build_geometric_list(double* relEllipseCoords, int numPnts, int
 		success = false;
 	}
 
+	// ALLOCATE THE TRACK
+	if (true == success)
+	{
+		track_ptr = create_hcTrack_ptr(numPnts / 2);
+
+		if (NULL == track_ptr)
+		{
+			HARKLE_ERROR(Harklemath, build_geometric_list, create_hcTrack_ptr failed);
+			success = false;
+		}
+	}
+
+	// ROUND THE DOUBLES TO INTS
+	if (true == success)
+	{
+		rounded_arr = (int*)calloc(numPnts, sizeof(int));
+
+		if (NULL == rounded_arr)
+		{
+			HARKLE_ERROR(Harklemath, build_geometric_list, calloc failed);
+			success = false;
+		}
+		else if (false == round_dble_arr(relEllipseCoords, rounded_arr, numPnts, HM_UP))
+		{
+			HARKLE_ERROR(Harklemath, build_geometric_list, round_dble_arr failed);
+			success = false;
+		}
+	}
+
 	// BUILD LINKED LIST
 	if (true == success)
 	{
 		for (i = 1; i < numPnts; i += 2)
 		{
-			// Round the doubles to ints
+			// Get the rounded ints
 			// printf("\ncentX == %d\tcentY == %d\n", centX, centY);  // DEBUGGING
 			// printf("\nrelEllipseCoords[%d - 1] == %.15f\trelEllipseCoords[%d] == %.15f\n", i, relEllipseCoords[i - 1], i, relEllipseCoords[i]);  // DEBUGGING
-			tmpX = round_a_dble(relEllipseCoords[i - 1], HM_UP);
-			tmpY = round_a_dble(relEllipseCoords[i], HM_UP);
+			tmpX = rounded_arr[i - 1];
+			tmpY = rounded_arr[i];
 			// printf("\ntmpX == %d\ttmpY == %d\n", tmpX, tmpY);  // DEBUGGING
 			// Prepare absolute coordinate points
 			if (false == translate_plot_points(tmpX, tmpY, centX, centY, &tmpAbsX, &tmpAbsY))
@@ -944,72 +939,36 @@ hcCartCoord_ptr build_geometric_list(double* relEllipseCoords, int numPnts, int
 				break;
 			}
 
-			// Build a node
-			if (NULL == retVal)
+			// Append the node, already linked and numbered
+			if (NULL == append_hcTrack_pnt(track_ptr, tmpAbsX, tmpAbsY, '*', 0))
 			{
-				// Build the head node
-				retVal = build_new_cartCoord_struct(tmpAbsX, \
-						                            tmpAbsY, '*', 0);
-
-				if (NULL == retVal)
-				{
-					HARKLE_ERROR(Harklemath, build_geometric_list, build_new_cartCoord_struct failed);
-					success = false;
-					break;
-				}
-			}
-			else
-			{
-				// Build a child node		
-				newNode = build_new_cartCoord_struct(tmpAbsX, tmpAbsY, '*', 0);
-
-				if (NULL == newNode)
-				{
-					HARKLE_ERROR(Harklemath, build_geometric_list, build_new_cartCoord_struct failed);
-					success = false;
-					break;
-				}
-				else
-				{
-					// Add the child node to the existing linked list
-					tmpNode = add_cartCoord_node(retVal, newNode, 0);
-
-					if (NULL == tmpNode)
-					{
-						HARKLE_ERROR(Harklemath, build_geometric_list, add_cartCoord_node failed);
-						success = false;
-						break;
-					}
-					else if (tmpNode != retVal)
-					{
-						retVal = tmpNode;
-					}
-
-					newNode = NULL;  // Reset the temp variable as an indication of successful linking
-				}				
+				HARKLE_ERROR(Harklemath, build_geometric_list, append_hcTrack_pnt failed);
+				success = false;
+				break;
 			}
 		}
 	}
 
-	// CLEAN UP
-	if (false == success)
+	// HEAD NODE
+	if (true == success)
 	{
-		// newNode
-		if (newNode)
+		retVal = get_hcTrack_head(track_ptr);
+
+		if (NULL == retVal)
 		{
-			if (false == free_cartCoord_struct(&newNode))
-			{
-				HARKLE_ERROR(Harklemath, build_geometric_list, free_cartCoord_struct failed);
-			}
+			HARKLE_ERROR(Harklemath, build_geometric_list, get_hcTrack_head failed);
+			success = false;
 		}
-		
-		// retVal
-		if (retVal)
+	}
+
+	// CLEAN UP
+	free(rounded_arr);
+
+	if (false == success && track_ptr)
+	{
+		if (false == free_hcTrack_ptr(&track_ptr))
 		{
-			if (false == free_cardCoord_linked_list(&retVal))
-			{
-				HARKLE_ERROR(Harklemath, build_geometric_list, free_cardCoord_linked_list failed);
-			}
+			HARKLE_ERROR(Harklemath, build_geometric_list, free_hcTrack_ptr failed);
 		}
 	}
 
@@ -1027,90 +986,6 @@ hcCartCoord_ptr build_geometric_list(double* relEllipseCoords, int numPnts, int
 //////////////////////// LOCAL HELPER FUNCTIONS START ////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
-int calc_max_precision(void)
-{
-	// LOCAL VARIABLES
-	double num1 = 1.0;  // Used to help calculate accuracy in calcualtion and storage
-	double num2 = 1.0;  // Used to help calculate accuracy in calcualtion and storage
-	double result = 0;  // Used to help calculate accuracy in storage
-	int counter = 0;  // Counts supported accuracy
-	static int retVal = 0;  // Only calculate this once for the life of the program
-	
-	// CALCULATION
-	if (!retVal)
-	{
-		// Determine digits of accuracy in calculation
-		while (num1 + num2 != num1)
-		{
-			++counter;
-			num2 = num2 / 10.0;
-		}
-		// printf("%2d digits accuracy in calculations\n", counter);  // DEBUGGING
-
-		// Reset temp variables
-		retVal = counter;  // Store this result
-		num2 = 1.0;  // Reset temp variable
-		counter = 0;  // Reset temp variable
-
-		// Determine digits of accuracy in storage
-		while (1)
-		{
-			result = num1 + num2;
-			if (result == num1)
-			{
-				break;
-			}
-			++counter;
-			num2 = num2 / 10.0;
-		}
-		// printf("%2d digits accuracy in storage\n", counter);  // DEBUGGING
-		
-		// Determine which accuracy count is least-specific
-		if (counter < retVal)
-		{
-			retVal = counter;	
-		}
-	}
-
-	// DONE
-	return retVal;
-}
-
-
-double truncate_double(double val, int digits)
-{
-	// LOCAL VARIABLES
-	double retVal = 0.0;
-	char format[9] = { 0 };  // Big enough for "%%.1074f\0"
-	char dbleBuff[3 + DBL_MANT_DIG - DBL_MIN_EXP + 1] = { 0 };
-
-
-	// INPUT VALIDATION
-	if (0 == digits)
-	{
-		retVal = val;
-	}
-	else if (digits < 0 || digits > 1074)
-	{
-		HARKLE_ERROR(Harklemath, truncate_double, Invalid number of digits);
-	}
-	else
-	{
-		// TRUNCATE
-		// fprintf(stdout, "\nval == %.15f\ndigits == %d\n", val, digits);  // DEBUGGING
-		// Dynamically build a sprintf format string
-		sprintf(format, "%%.%df", digits);
-		// Use that format string to truncate val into a string
-		sprintf(dbleBuff, format, val);
-		// Convert that string back to a double
-		retVal = atof(dbleBuff);
-	}
-
-	// DONE
-	return retVal;
-}
-
-
 /*
 	PURPOSE - Translate plot points that are relative to the center of a windows
 		into plot points that are absolute with relation to the upper left corner
@@ -1177,6 +1052,198 @@ bool translate_plot_points(int relX, int relY, int cntX, int cntY, int* absX, in
 }
 	
 
+void hm_quadrant_scalar(double majAxis, double minAxis, double* quad_arr, int numQuad)
+{
+	// LOCAL VARIABLES
+	int i = 0;  // Iterating variable
+	double majPnt = 0;  // Point along the major axis
+
+	for (i = 0; i < numQuad; i++)
+	{
+		majPnt = i;
+		quad_arr[i] = sqrt((majAxis * majAxis) - (majPnt * majPnt)) * minAxis / majAxis;
+	}
+}
+
+
+#ifdef HMATH_X86
+void hm_quadrant_sse2(double majAxis, double minAxis, double* quad_arr, int numQuad)
+{
+	// LOCAL VARIABLES
+	__m128d majSq = _mm_set1_pd(majAxis * majAxis);  // Major axis, squared
+	__m128d majVec = _mm_set1_pd(majAxis);  // Major axis
+	__m128d minVec = _mm_set1_pd(minAxis);  // Minor axis
+	__m128d majPnts = _mm_set_pd(1.0, 0.0);  // Points along the major axis
+	__m128d step = _mm_set1_pd(2.0);  // Distance to the next points
+	__m128d tmpVec;  // Temp variable
+	int i = 0;  // Iterating variable
+
+	for (i = 0; i + 2 <= numQuad; i += 2)
+	{
+		tmpVec = _mm_sub_pd(majSq, _mm_mul_pd(majPnts, majPnts));
+		tmpVec = _mm_div_pd(_mm_mul_pd(_mm_sqrt_pd(tmpVec), minVec), majVec);
+		_mm_storeu_pd(quad_arr + i, tmpVec);
+		majPnts = _mm_add_pd(majPnts, step);
+	}
+
+	// Tail
+	for (; i < numQuad; i++)
+	{
+		quad_arr[i] = sqrt((majAxis * majAxis) - ((double)i * i)) * minAxis / majAxis;
+	}
+}
+
+
+void hm_quadrant_avx(double majAxis, double minAxis, double* quad_arr, int numQuad)
+{
+	// LOCAL VARIABLES
+	__m256d majSq = _mm256_set1_pd(majAxis * majAxis);  // Major axis, squared
+	__m256d majVec = _mm256_set1_pd(majAxis);  // Major axis
+	__m256d minVec = _mm256_set1_pd(minAxis);  // Minor axis
+	__m256d majPnts = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);  // Points along the major axis
+	__m256d step = _mm256_set1_pd(4.0);  // Distance to the next points
+	__m256d tmpVec;  // Temp variable
+	int i = 0;  // Iterating variable
+
+	for (i = 0; i + 4 <= numQuad; i += 4)
+	{
+		tmpVec = _mm256_sub_pd(majSq, _mm256_mul_pd(majPnts, majPnts));
+		tmpVec = _mm256_div_pd(_mm256_mul_pd(_mm256_sqrt_pd(tmpVec), minVec), majVec);
+		_mm256_storeu_pd(quad_arr + i, tmpVec);
+		majPnts = _mm256_add_pd(majPnts, step);
+	}
+
+	// Tail
+	for (; i < numQuad; i++)
+	{
+		quad_arr[i] = sqrt((majAxis * majAxis) - ((double)i * i)) * minAxis / majAxis;
+	}
+}
+#endif  // HMATH_X86
+
+
+void hm_round_scalar(const double* roundMe_arr, int* rounded_arr, int numDbls, int rndDir)
+{
+	// LOCAL VARIABLES
+	int i = 0;  // Iterating variable
+
+	for (i = 0; i < numDbls; i++)
+	{
+		if (HM_UP == rndDir)
+		{
+			rounded_arr[i] = ceil(roundMe_arr[i]);
+		}
+		else if (HM_DWN == rndDir)
+		{
+			rounded_arr[i] = floor(roundMe_arr[i]);
+		}
+		else
+		{
+			rounded_arr[i] = round(roundMe_arr[i]);
+		}
+	}
+}
+
+
+#ifdef HMATH_X86
+void hm_round_sse41(const double* roundMe_arr, int* rounded_arr, int numDbls, int rndDir)
+{
+	// LOCAL VARIABLES
+	__m128d signMask = _mm_set1_pd(-0.0);  // Just the sign bit
+	__m128d justUnder = _mm_set1_pd(0.49999999999999994);  // Largest double below 0.5
+	__m128d tmpVec;  // Temp variable
+	int i = 0;  // Iterating variable
+
+	for (i = 0; i + 2 <= numDbls; i += 2)
+	{
+		tmpVec = _mm_loadu_pd(roundMe_arr + i);
+
+		if (HM_UP == rndDir)
+		{
+			tmpVec = _mm_round_pd(tmpVec, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+		}
+		else if (HM_DWN == rndDir)
+		{
+			tmpVec = _mm_round_pd(tmpVec, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+		}
+		else
+		{
+			// round():  truncate x + copysign(justUnder, x)
+			tmpVec = _mm_add_pd(tmpVec, _mm_or_pd(_mm_and_pd(tmpVec, signMask), justUnder));
+			tmpVec = _mm_round_pd(tmpVec, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+		}
+		_mm_storel_epi64((__m128i*)(rounded_arr + i), _mm_cvttpd_epi32(tmpVec));
+	}
+
+	// Tail
+	if (i < numDbls)
+	{
+		hm_round_scalar(roundMe_arr + i, rounded_arr + i, numDbls - i, rndDir);
+	}
+}
+
+
+void hm_round_avx(const double* roundMe_arr, int* rounded_arr, int numDbls, int rndDir)
+{
+	// LOCAL VARIABLES
+	__m256d signMask = _mm256_set1_pd(-0.0);  // Just the sign bit
+	__m256d justUnder = _mm256_set1_pd(0.49999999999999994);  // Largest double below 0.5
+	__m256d tmpVec;  // Temp variable
+	int i = 0;  // Iterating variable
+
+	for (i = 0; i + 4 <= numDbls; i += 4)
+	{
+		tmpVec = _mm256_loadu_pd(roundMe_arr + i);
+
+		if (HM_UP == rndDir)
+		{
+			tmpVec = _mm256_round_pd(tmpVec, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+		}
+		else if (HM_DWN == rndDir)
+		{
+			tmpVec = _mm256_round_pd(tmpVec, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+		}
+		else
+		{
+			// round():  truncate x + copysign(justUnder, x)
+			tmpVec = _mm256_add_pd(tmpVec, _mm256_or_pd(_mm256_and_pd(tmpVec, signMask), justUnder));
+			tmpVec = _mm256_round_pd(tmpVec, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+		}
+		_mm_storeu_si128((__m128i*)(rounded_arr + i), _mm256_cvttpd_epi32(tmpVec));
+	}
+
+	// Tail
+	if (i < numDbls)
+	{
+		hm_round_scalar(roundMe_arr + i, rounded_arr + i, numDbls - i, rndDir);
+	}
+}
+
+
+void hm_pick_engines(void)
+{
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx"))
+	{
+		hmQuadrantEngine = hm_quadrant_avx;
+		hmRoundEngine = hm_round_avx;
+	}
+	else
+	{
+		if (__builtin_cpu_supports("sse2"))
+		{
+			hmQuadrantEngine = hm_quadrant_sse2;
+		}
+		if (__builtin_cpu_supports("sse4.1"))
+		{
+			hmRoundEngine = hm_round_sse41;
+		}
+	}
+}
+#endif  // HMATH_X86
+
+
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////// LOCAL HELPER FUNCTIONS STOP /////////////////////////
 //////////////////////////////////////////////////////////////////////////////
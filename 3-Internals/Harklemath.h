@@ -3,6 +3,7 @@
 
 #include <fenv.h>
 #include "Harklecurse.h"		// hcCartCoord_ptr
+#include "Harklerror.h"			// HARKLE_ERROR
 #include <stdbool.h>			// bool, true, false
 
 typedef struct cartesianCoordinate
@@ -11,8 +12,18 @@ typedef struct cartesianCoordinate
 	double yCoord;			// Y coordinate
 } cartPnt, *cartPnt_ptr;
 
+// Structure-of-arrays ellipse plot points (see: plot_ellipse_batch())
+typedef struct harkleEllipsePoints
+{
+	double* x_arr;			// X coordinates, in plot order
+	double* y_arr;			// Y coordinates, in plot order
+	int numPnts;			// Number of coordinates in each array
+} hmPlotPnts, *hmPlotPnts_ptr;
+
 // double is a 64 bit IEEE 754 double precision Floating Point Number (1 bit for the sign, 11 bits for the exponent, and 52* bits for the value), i.e. double has 15 decimal digits of precision.
 #define DBL_PRECISION 15
+// Most decimal places a double can hold, in calculation and in storage (see: hmTolerance_arr)
+#define HM_MAX_PRECISION 16
 
 // Rounding MACROs to pass as round_a_dble()'s rndDir argument
 #define HM_RND FE_TONEAREST		// Round to nearest (the default)
@@ -20,6 +31,19 @@ typedef struct cartesianCoordinate
 #define HM_DWN FE_DOWNWARD		// Round down (toward negative infinity)
 #define HM_IN FE_TOWARDZERO		// Round toward zero
 
+// Comparison MACROs to pass as dble_compare_arr()'s cmpType argument
+#define HM_GT  1				// dble_greater_than()
+#define HM_LT  2				// dble_less_than()
+#define HM_EQ  3				// dble_equal_to()
+#define HM_NEQ 4				// dble_not_equal()
+#define HM_GTE 5				// dble_greater_than_equal_to()
+#define HM_LTE 6				// dble_less_than_equal_to()
+
+// Branch-free comparison bodies:  x and y are doubles, m is a tolerance from hmTolerance_arr
+#define HM_DBLE_EQ(x, y, m) ((((x) + (m)) > (y)) & (((x) - (m)) < (y)) & ((x) < ((y) + (m))) & ((x) > ((y) - (m))))
+#define HM_DBLE_GT(x, y, m) (((x) > (y)) & (((x) + (m)) > ((y) + (m))) & (((x) - (m)) > ((y) - (m))))
+#define HM_DBLE_LT(x, y, m) (((x) < (y)) & !HM_DBLE_EQ(x, y, m))
+
 // Center MACROs to pass as determine_center()'s orientWint argument
 #define HM_UP_LEFT   1			// If not exactly center, window's center defaults to upper left
 #define HM_UP_RIGHT  2			// If not exactly center, window's center defaults to upper right
@@ -52,6 +76,45 @@ typedef struct cartesianCoordinate
 int round_a_dble(double roundMe, int rndDir);
 
 
+/*
+	PURPOSE - Round an array of doubles to ints without touching the floating
+		point environment
+	INPUT
+		roundMe_arr - Array of doubles to round
+		rounded_arr - [OUT] Array of at least numDbls ints to store the results in
+		numDbls - Number of doubles in roundMe_arr
+		rndDir - The direction to round the doubles (see: HM_* MACROS above)
+	OUTPUT
+		On success, true
+		On failure, false (e.g., a double doesn't fit in an int)
+	NOTES
+		Matches round_a_dble():  HM_UP is ceil(), HM_DWN is floor() and
+			everything else is round() (halfway cases away from zero)
+		Rounds 4 (AVX) or 2 (SSE4.1) doubles at a time when the CPU allows
+ */
+bool round_dble_arr(const double* roundMe_arr, int* rounded_arr, int numDbls, int rndDir);
+
+
+// Comparison tolerances indexed by precision:  hmTolerance_arr[p] == 0.1 ** p
+extern const double hmTolerance_arr[HM_MAX_PRECISION + 1];
+
+
+/*
+	PURPOSE - Look up the comparison tolerance for a level of precision
+	INPUT
+		precision - Number of decimal points of precision desired
+	OUTPUT
+		On success, a double value to be used as a comparative value
+		On failure, 0
+	NOTES
+		Precision beyond HM_MAX_PRECISION is clamped to HM_MAX_PRECISION
+ */
+static inline double hm_tolerance(int precision)
+{
+	return precision < 1 ? 0 : hmTolerance_arr[precision > HM_MAX_PRECISION ? HM_MAX_PRECISION : precision];
+}
+
+
 /*
 	PURPOSE - Determine if one double is greater than another to a certain
 		level of precision
@@ -63,7 +126,20 @@ int round_a_dble(double roundMe, int rndDir);
 		If x > y, true
 		Otherwise, false
  */
-bool dble_greater_than(double x, double y, int precision);
+static inline bool dble_greater_than(double x, double y, int precision)
+{
+	// LOCAL VARIABLES
+	double dbleMask = hm_tolerance(precision);  // "Mask" to remove undesired values of doubles
+
+	// INPUT VALIDATION
+	if (!dbleMask)
+	{
+		HARKLE_ERROR(Harklemath, dble_greater_than, Invalid precision);
+	}
+
+	// DONE
+	return (dbleMask > 0) & HM_DBLE_GT(x, y, dbleMask);
+}
 
 
 /*
@@ -77,7 +153,20 @@ bool dble_greater_than(double x, double y, int precision);
 		If x < y, true
 		Otherwise, false
  */
-bool dble_less_than(double x, double y, int precision);
+static inline bool dble_less_than(double x, double y, int precision)
+{
+	// LOCAL VARIABLES
+	double dbleMask = hm_tolerance(precision);  // "Mask" to remove undesired values of doubles
+
+	// INPUT VALIDATION
+	if (!dbleMask)
+	{
+		HARKLE_ERROR(Harklemath, dble_less_than, Invalid precision);
+	}
+
+	// DONE
+	return (dbleMask > 0) & HM_DBLE_LT(x, y, dbleMask);
+}
 
 
 /*
@@ -91,7 +180,20 @@ bool dble_less_than(double x, double y, int precision);
 		If x == y, true
 		Otherwise, false
  */
-bool dble_equal_to(double x, double y, int precision);
+static inline bool dble_equal_to(double x, double y, int precision)
+{
+	// LOCAL VARIABLES
+	double dbleMask = hm_tolerance(precision);  // "Mask" to remove undesired values of doubles
+
+	// INPUT VALIDATION
+	if (!dbleMask)
+	{
+		HARKLE_ERROR(Harklemath, dble_equal_to, Invalid precision);
+	}
+
+	// DONE
+	return (dbleMask > 0) & HM_DBLE_EQ(x, y, dbleMask);
+}
 
 
 /*
@@ -108,7 +210,10 @@ bool dble_equal_to(double x, double y, int precision);
 		This function calls and returns the opposite of:
 			dble_equal_to()
  */
-bool dble_not_equal(double x, double y, int precision);
+static inline bool dble_not_equal(double x, double y, int precision)
+{
+	return !dble_equal_to(x, y, precision);
+}
 
 
 /*
@@ -121,17 +226,26 @@ bool dble_not_equal(double x, double y, int precision);
 	OUTPUT
 		If x >= y, true
 		Otherwise, false
-	NOTES
-		This function will call the following functions in this order:
-			dble_equal_to()
-			dble_greater_than()
  */
-bool dble_greater_than_equal_to(double x, double y, int precision);
+static inline bool dble_greater_than_equal_to(double x, double y, int precision)
+{
+	// LOCAL VARIABLES
+	double dbleMask = hm_tolerance(precision);  // "Mask" to remove undesired values of doubles
+
+	// INPUT VALIDATION
+	if (!dbleMask)
+	{
+		HARKLE_ERROR(Harklemath, dble_greater_than_equal_to, Invalid precision);
+	}
+
+	// DONE
+	return (dbleMask > 0) & (HM_DBLE_EQ(x, y, dbleMask) | HM_DBLE_GT(x, y, dbleMask));
+}
 
 
 /*
-	PURPOSE - Determine if one double is less than another to a certain
-		level of precision
+	PURPOSE - Determine if one double is less than or equal to another
+		to a certain level of precision
 	INPUT
 		x - Is x less than or equal to...
 		y - ...y...
@@ -139,12 +253,42 @@ bool dble_greater_than_equal_to(double x, double y, int precision);
 	OUTPUT
 		If x <= y, true
 		Otherwise, false
+ */
+static inline bool dble_less_than_equal_to(double x, double y, int precision)
+{
+	// LOCAL VARIABLES
+	double dbleMask = hm_tolerance(precision);  // "Mask" to remove undesired values of doubles
+
+	// INPUT VALIDATION
+	if (!dbleMask)
+	{
+		HARKLE_ERROR(Harklemath, dble_less_than_equal_to, Invalid precision);
+	}
+
+	// DONE
+	return (dbleMask > 0) & (HM_DBLE_EQ(x, y, dbleMask) | HM_DBLE_LT(x, y, dbleMask));
+}
+
+
+/*
+	PURPOSE - Compare two arrays of doubles, element by element, to a certain
+		level of precision
+	INPUT
+		x_arr - Left hand side of each comparison
+		y_arr - Right hand side of each comparison
+		result_arr - [OUT] Array of at least numDbls bools to store the results in
+		numDbls - Number of doubles in x_arr and y_arr
+		precision - Number of decimal places to consider
+		cmpType - The comparison to make (see: HM_GT, HM_LT, HM_EQ, HM_NEQ,
+			HM_GTE, HM_LTE)
+	OUTPUT
+		On success, true
+		On failure, false
 	NOTES
-		This function will call the following functions in this order:
-			dble_equal_to()
-			dble_less_than()
+		result_arr[i] matches the single comparison function for x_arr[i]
+			and y_arr[i] (e.g., HM_GT is dble_greater_than())
  */
-bool dble_less_than_equal_to(double x, double y, int precision);
+bool dble_compare_arr(const double* x_arr, const double* y_arr, bool* result_arr, int numDbls, int precision, int cmpType);
 
 
 /*
@@ -156,13 +300,8 @@ bool dble_less_than_equal_to(double x, double y, int precision);
 		On success, a double value to be used as a comparative value
 		On failure, 0
 	NOTES
-		This function will attempt to determine/calculate the maximum level
-			of precision for the system it is compiled on.
-		I haven't yet determined how I want to handle TOO much desired
-			precision.
-		Also, I haven't yet determined how I want to handle the system's
-			maximum level of precision if the caller's desired level of
-			precision exceeds the system's maximum precision.
+		Precision beyond HM_MAX_PRECISION is clamped to HM_MAX_PRECISION
+		This is the error-reporting version of hm_tolerance()
  */
 double calc_precision(int precision);
 
@@ -237,10 +376,40 @@ double calc_ellipse_y_coord(double aVal, double bVal, double xVal);
 			in the following order regardless of the major axis: 
 			(-a, 0), (0, b), (+a, 0), (0, -b), (-a + 1, y)
 		Coordinate values chosen by this function are whole numbers
+		The points are calculated by plot_ellipse_batch() and interleaved
  */
 double* plot_ellipse_points(double aVal, double bVal, int* numPnts);
 
 
+/*
+	PURPOSE - Calculate the same points as plot_ellipse_points() into
+		separate x and y arrays
+	INPUT
+		aVal - "a" from the standard equation above
+		bVal - "b" from the standard equation above
+	OUTPUT
+		On success, a heap-allocated harkleEllipsePoints struct
+		On failure, NULL
+	NOTES
+		Only one quadrant is calculated, 4 (AVX) or 2 (SSE2) square roots at
+			a time when the CPU allows.  The other three are mirrored from it.
+		It is the caller's responsibility to free the struct
+			(see: free_hmPlotPnts_ptr())
+ */
+hmPlotPnts_ptr plot_ellipse_batch(double aVal, double bVal);
+
+
+/*
+	PURPOSE - Zeroize, free, and NULL a harkleEllipsePoints struct and its arrays
+	INPUT
+		oldStruct_ptr - A pointer to a harkleEllipsePoints struct pointer
+	OUTPUT
+		On success, true
+		On failure, false
+ */
+bool free_hmPlotPnts_ptr(hmPlotPnts_ptr* oldStruct_ptr);
+
+
 /*
 	PURPOSE - Determine the center coordinates of a rectangle given it's width
 		and height.
@@ -274,6 +443,10 @@ bool determine_center(int width, int height, int* xCoord, int* yCoord, int orien
 		On success, a pointer to the head node of a linked list of heap-allocated
 			hcCartCoord structs translated from reEllipseCoords
 		On failure, NULL
+	NOTES
+		The nodes are stored in one hcCartesianTrack (see: Harklecurse.h) so they
+			are numbered as they're built and get_pos_num() indexes them
+		Free the list with free_cardCoord_linked_list() as usual
  */
 hcCartCoord_ptr build_geometric_list(double* relEllipseCoords, int numPnts, int centX, int centY);
 
@@ -1,15 +1,51 @@
 #include <errno.h>			// errno
+#include <fcntl.h>			// fcntl()
 #include "Fileroad_Descriptors.h"	// set_fd_flags()
 #include "Harklepipe.h"		// HPIPE_READ, HPIPE_WRITE
 #include "Harklerror.h"		// HARKLE_ERROR
-#include "Memoroad.h"		
+#include "Memoroad.h"		// copy_a_string(), get_me_memory(), harkleset()
+#include <poll.h>			// poll()
 #include <stdbool.h>		// bool, true, false
 #include <stdio.h>			// fprintf()
-#include <string.h>			// strerror()
+#include <string.h>			// strerror(), memchr(), memmove()
+#include <sys/epoll.h>		// epoll_create1(), epoll_ctl(), epoll_wait()
+#include <sys/uio.h>		// writev()
 #include <unistd.h>			// pipe(), pipe2(), read()
 
 #define HP_BUFF_SIZE 64
 
+#ifndef HPIPE_LOOP_EVENTS
+// MACRO to determine how many ready pipes one run_pipe_loop() call will collect
+#define HPIPE_LOOP_EVENTS 64
+#endif  // HPIPE_LOOP_EVENTS
+
+#ifndef HPIPE_LOOP_BURST
+// MACRO to limit how many messages run_pipe_loop() dispatches from one pipe per call
+#define HPIPE_LOOP_BURST 32
+#endif  // HPIPE_LOOP_BURST
+
+
+/*
+	PURPOSE - Read more of a harklePipeReader's pipe into its buffer
+	INPUT
+		reader_ptr - harklePipeReader to fill
+		numNeeded - The buffer must hold at least this many unreturned bytes
+		errNumber - [OUT] errno on failure
+	OUTPUT
+		On success (to include the end of the pipe, see: atEOF), true
+		On failure, false (EAGAIN if a non-blocking pipe is empty)
+	NOTES
+		Makes one successful read() of as much as will fit.  Unreturned bytes
+			are slid to the front, and the buffer doubles as necessary.
+ */
+bool fill_pipe_reader(hpReader_ptr reader_ptr, size_t numNeeded, int* errNumber);
+
+
+/*
+	PURPOSE - Mark bytes at the front of a harklePipeReader's buffer as returned
+ */
+void consume_pipe_reader(hpReader_ptr reader_ptr, size_t numBytes);
+
 
 int make_a_pipe(int emptyPipes[2], int flags)
 {
@@ -222,6 +258,259 @@ char* read_a_pipe(int readFD, char stop, int* errNumber)
 }
 
 
+hpReader_ptr create_pipe_reader(int readFD, size_t buffSize)
+{
+	// LOCAL VARIABLES
+	hpReader_ptr retVal = NULL;
+	bool success = true;  // Make this false if anything fails
+
+	// INPUT VALIDATION
+	if (readFD < 0)
+	{
+		HARKLE_ERROR(Harklepipe, create_pipe_reader, Invalid file descriptor);
+		success = false;
+	}
+	else if (buffSize > HPIPE_MAX_MESSAGE)
+	{
+		HARKLE_ERROR(Harklepipe, create_pipe_reader, Invalid buffer size);
+		success = false;
+	}
+
+	// ALLOCATE
+	if (true == success)
+	{
+		retVal = get_me_memory(sizeof(hpReader));
+
+		if (!retVal)
+		{
+			HARKLE_ERROR(Harklepipe, create_pipe_reader, get_me_memory failed);
+			success = false;
+		}
+		else
+		{
+			retVal->readFD = readFD;
+			retVal->buffSize = buffSize ? buffSize : HPIPE_READER_SIZE;
+			retVal->buff_ptr = get_me_memory(retVal->buffSize);
+
+			if (!(retVal->buff_ptr))
+			{
+				HARKLE_ERROR(Harklepipe, create_pipe_reader, get_me_memory failed);
+				success = false;
+			}
+		}
+	}
+
+	// CLEAN UP
+	if (false == success && retVal)
+	{
+		free_pipe_reader(&retVal);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+char* read_pipe_message(hpReader_ptr reader_ptr, char stop, size_t* msgLen, int* errNumber)
+{
+	// LOCAL VARIABLES
+	char* retVal = NULL;
+	bool success = true;  // Make this false if anything fails
+	bool done = false;  // Make this true once there's nothing left to read
+	char* stop_ptr = NULL;  // Return value from memchr()
+	size_t scanned = 0;  // Buffered bytes already searched for stop
+	size_t numBytes = 0;  // Length of the message
+	size_t skipBytes = 0;  // Length of the message plus its delimiter
+
+	// INPUT VALIDATION
+	if (!reader_ptr || !errNumber)
+	{
+		HARKLE_ERROR(Harklepipe, read_pipe_message, NULL pointer);
+		success = false;
+	}
+	else
+	{
+		*errNumber = 0;
+	}
+
+	// FIND A WHOLE MESSAGE
+	while (true == success && false == done)
+	{
+		stop_ptr = memchr(reader_ptr->buff_ptr + reader_ptr->start + scanned, stop, \
+			              reader_ptr->end - reader_ptr->start - scanned);
+
+		if (stop_ptr)
+		{
+			numBytes = stop_ptr - (reader_ptr->buff_ptr + reader_ptr->start);
+			skipBytes = numBytes + 1;
+			done = true;
+		}
+		else if (true == reader_ptr->atEOF)
+		{
+			// Whatever is left is the last message
+			numBytes = reader_ptr->end - reader_ptr->start;
+			skipBytes = numBytes;
+			done = true;
+
+			if (0 == numBytes)
+			{
+				success = false;  // End of the pipe
+			}
+		}
+		else
+		{
+			scanned = reader_ptr->end - reader_ptr->start;
+
+			// Need at least one byte of room
+			if (false == fill_pipe_reader(reader_ptr, scanned + 1, errNumber))
+			{
+				success = false;
+			}
+		}
+	}
+
+	// COPY IT OUT
+	if (true == success)
+	{
+		retVal = get_me_memory(numBytes + 1);
+
+		if (!retVal)
+		{
+			HARKLE_ERROR(Harklepipe, read_pipe_message, get_me_memory failed);
+			*errNumber = ENOMEM;
+		}
+		else
+		{
+			memcpy(retVal, reader_ptr->buff_ptr + reader_ptr->start, numBytes);
+			consume_pipe_reader(reader_ptr, skipBytes);
+
+			if (msgLen)
+			{
+				*msgLen = numBytes;
+			}
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+void* read_pipe_frame(hpReader_ptr reader_ptr, size_t* msgLen, int* errNumber)
+{
+	// LOCAL VARIABLES
+	char* retVal = NULL;
+	bool success = true;  // Make this false if anything fails
+	bool done = false;  // Make this true once the whole frame is buffered
+	uint32_t frameLen = 0;  // Payload length from the frame header
+	size_t numBuffered = 0;  // Bytes buffered but not yet returned
+	size_t numNeeded = HPIPE_FRAME_HEADER;  // Bytes needed for the next step
+
+	// INPUT VALIDATION
+	if (!reader_ptr || !msgLen || !errNumber)
+	{
+		HARKLE_ERROR(Harklepipe, read_pipe_frame, NULL pointer);
+		success = false;
+	}
+	else
+	{
+		*errNumber = 0;
+		*msgLen = 0;
+	}
+
+	// BUFFER A WHOLE FRAME
+	while (true == success && false == done)
+	{
+		numBuffered = reader_ptr->end - reader_ptr->start;
+
+		// 1. The header
+		if (numBuffered >= HPIPE_FRAME_HEADER)
+		{
+			memcpy(&frameLen, reader_ptr->buff_ptr + reader_ptr->start, HPIPE_FRAME_HEADER);
+
+			if (frameLen > HPIPE_MAX_MESSAGE)
+			{
+				HARKLE_ERROR(Harklepipe, read_pipe_frame, Frame is too large);
+				*errNumber = EMSGSIZE;
+				success = false;
+				break;
+			}
+			numNeeded = HPIPE_FRAME_HEADER + frameLen;
+		}
+
+		// 2. The payload
+		if (numBuffered >= numNeeded)
+		{
+			done = true;
+		}
+		else if (true == reader_ptr->atEOF)
+		{
+			*errNumber = numBuffered ? EPROTO : 0;  // Ended mid-frame?
+			success = false;
+		}
+		else if (false == fill_pipe_reader(reader_ptr, numNeeded, errNumber))
+		{
+			success = false;
+		}
+	}
+
+	// COPY IT OUT
+	if (true == success)
+	{
+		retVal = get_me_memory((size_t)frameLen + 1);
+
+		if (!retVal)
+		{
+			HARKLE_ERROR(Harklepipe, read_pipe_frame, get_me_memory failed);
+			*errNumber = ENOMEM;
+		}
+		else
+		{
+			memcpy(retVal, reader_ptr->buff_ptr + reader_ptr->start + HPIPE_FRAME_HEADER, frameLen);
+			consume_pipe_reader(reader_ptr, numNeeded);
+			*msgLen = frameLen;
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool free_pipe_reader(hpReader_ptr* oldReader_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	hpReader_ptr reader_ptr = NULL;  // Easier to deal with this way
+
+	// INPUT VALIDATION
+	if (!oldReader_ptr || !(*oldReader_ptr))
+	{
+		HARKLE_ERROR(Harklepipe, free_pipe_reader, NULL pointer);
+		retVal = false;
+	}
+	else
+	{
+		reader_ptr = *oldReader_ptr;
+
+		// 1. Buffer
+		if (reader_ptr->buff_ptr)
+		{
+			harkleset(reader_ptr->buff_ptr, 0x0, reader_ptr->buffSize);
+			free(reader_ptr->buff_ptr);
+		}
+
+		// 2. Reader
+		harkleset(reader_ptr, 0x0, sizeof(hpReader));
+		free(reader_ptr);
+		*oldReader_ptr = NULL;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
 /*
 	PURPOSE - Write "numBytes" worth of "writeStr" into the writeFD file
 		descriptor
@@ -268,8 +557,14 @@ int write_a_pipe(int writeFD, void* writeStr, size_t numBytes)
 		if (-1 == writeRetVal)
 		{
 			errNum = errno;
-			HARKLE_ERROR(Harklepipe, read_a_pipe, write failed);
-			fprintf(stderr, "write() returned errno:\t%s\n", strerror(errNum));
+			retVal = errNum;
+
+			// A full non-blocking pipe is the caller's to retry
+			if (EAGAIN != errNum && EWOULDBLOCK != errNum)
+			{
+				HARKLE_ERROR(Harklepipe, read_a_pipe, write failed);
+				fprintf(stderr, "write() returned errno:\t%s\n", strerror(errNum));
+			}
 			success = false;
 		}
 		else if (0 == writeRetVal)
@@ -287,3 +582,476 @@ int write_a_pipe(int writeFD, void* writeStr, size_t numBytes)
 	// DONE
 	return retVal;
 }
+
+
+int write_pipe_frame(int writeFD, void* msg, size_t numBytes)
+{
+	// LOCAL VARIABLES
+	int retVal = 0;
+	uint32_t frameLen = (uint32_t)numBytes;  // Frame header
+	struct iovec frame_arr[2] = { { 0 } };  // Header, payload
+	struct iovec* curr_ptr = frame_arr;  // First iovec with bytes left to write
+	int numVecs = 2;  // iovecs left in frame_arr
+	size_t numLeft = HPIPE_FRAME_HEADER + numBytes;  // Bytes left to write
+	ssize_t numWritten = 0;  // Return value from writev()
+	struct pollfd waitFD = { .fd = writeFD, .events = POLLOUT };  // Waits for room in the pipe
+
+	// INPUT VALIDATION
+	if (writeFD < 0)
+	{
+		HARKLE_ERROR(Harklepipe, write_pipe_frame, Invalid file descriptor);
+		retVal = EBADF;
+	}
+	else if (!msg && numBytes)
+	{
+		HARKLE_ERROR(Harklepipe, write_pipe_frame, NULL pointer);
+		retVal = EINVAL;
+	}
+	else if (numBytes > HPIPE_MAX_MESSAGE)
+	{
+		HARKLE_ERROR(Harklepipe, write_pipe_frame, Frame is too large);
+		retVal = EMSGSIZE;
+	}
+	else
+	{
+		frame_arr[0].iov_base = &frameLen;
+		frame_arr[0].iov_len = HPIPE_FRAME_HEADER;
+		frame_arr[1].iov_base = msg;
+		frame_arr[1].iov_len = numBytes;
+	}
+
+	// WRITE
+	while (0 == retVal && numLeft > 0)
+	{
+		numWritten = writev(writeFD, curr_ptr, numVecs);
+
+		if (-1 == numWritten)
+		{
+			if (EINTR == errno)
+			{
+				continue;
+			}
+			else if ((EAGAIN == errno || EWOULDBLOCK == errno) && numLeft < HPIPE_FRAME_HEADER + numBytes)
+			{
+				// Never leave half a frame in the pipe
+				poll(&waitFD, 1, -1);
+				continue;
+			}
+			retVal = errno;
+		}
+		else
+		{
+			// Skip what was written
+			numLeft -= numWritten;
+			while (numVecs > 0 && (size_t)numWritten >= curr_ptr->iov_len)
+			{
+				numWritten -= curr_ptr->iov_len;
+				curr_ptr++;
+				numVecs--;
+			}
+			if (numVecs > 0)
+			{
+				curr_ptr->iov_base = (char*)curr_ptr->iov_base + numWritten;
+				curr_ptr->iov_len -= numWritten;
+			}
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool fill_pipe_reader(hpReader_ptr reader_ptr, size_t numNeeded, int* errNumber)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	size_t numBuffered = reader_ptr->end - reader_ptr->start;  // Bytes not yet returned
+	size_t newSize = reader_ptr->buffSize;  // New size of buff_ptr
+	char* temp_ptr = NULL;  // Return value from realloc()
+	ssize_t numRead = 0;  // Return value from read()
+
+	// 1. MAKE ROOM
+	if (numNeeded > HPIPE_MAX_MESSAGE + HPIPE_FRAME_HEADER)
+	{
+		HARKLE_ERROR(Harklepipe, fill_pipe_reader, Message is too large);
+		*errNumber = EMSGSIZE;
+		retVal = false;
+	}
+	else
+	{
+		// Slide the unreturned bytes to the front
+		if (reader_ptr->start > 0 && reader_ptr->end == reader_ptr->buffSize)
+		{
+			memmove(reader_ptr->buff_ptr, reader_ptr->buff_ptr + reader_ptr->start, numBuffered);
+			reader_ptr->start = 0;
+			reader_ptr->end = numBuffered;
+		}
+
+		// Grow until the whole message fits
+		while (newSize < numNeeded || newSize == reader_ptr->end)
+		{
+			newSize *= 2;
+		}
+
+		if (newSize != reader_ptr->buffSize)
+		{
+			temp_ptr = realloc(reader_ptr->buff_ptr, newSize);
+
+			if (!temp_ptr)
+			{
+				HARKLE_ERROR(Harklepipe, fill_pipe_reader, realloc failed);
+				*errNumber = ENOMEM;
+				retVal = false;
+			}
+			else
+			{
+				reader_ptr->buff_ptr = temp_ptr;
+				reader_ptr->buffSize = newSize;
+			}
+		}
+	}
+
+	// 2. READ AS MUCH AS FITS
+	while (true == retVal)
+	{
+		numRead = read(reader_ptr->readFD, reader_ptr->buff_ptr + reader_ptr->end, reader_ptr->buffSize - reader_ptr->end);
+
+		if (numRead > 0)
+		{
+			reader_ptr->end += numRead;
+			break;
+		}
+		else if (0 == numRead)
+		{
+			reader_ptr->atEOF = true;
+			break;
+		}
+		else if (EINTR != errno)
+		{
+			*errNumber = errno;  // EAGAIN on an empty non-blocking pipe
+			retVal = false;
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+void consume_pipe_reader(hpReader_ptr reader_ptr, size_t numBytes)
+{
+	reader_ptr->start += numBytes;
+
+	// Rewind when empty so the next read starts at the front
+	if (reader_ptr->start == reader_ptr->end)
+	{
+		reader_ptr->start = 0;
+		reader_ptr->end = 0;
+	}
+}
+
+
+hpLoop_ptr create_pipe_loop(void)
+{
+	// LOCAL VARIABLES
+	hpLoop_ptr retVal = NULL;
+	int errNum = 0;  // Store errno here
+
+	// ALLOCATE
+	retVal = get_me_memory(sizeof(hpLoop));
+
+	if (!retVal)
+	{
+		HARKLE_ERROR(Harklepipe, create_pipe_loop, get_me_memory failed);
+	}
+	else
+	{
+		retVal->epollFD = epoll_create1(EPOLL_CLOEXEC);
+
+		if (retVal->epollFD < 0)
+		{
+			errNum = errno;
+			HARKLE_ERROR(Harklepipe, create_pipe_loop, epoll_create1 failed);
+			HARKLE_ERRNO(Harklepipe, epoll_create1, errNum);
+			free(retVal);
+			retVal = NULL;
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+int watch_a_pipe(hpLoop_ptr loop_ptr, hpReader_ptr reader_ptr, char stop, bool framed, \
+	             hpMessageCallback callback, void* userData)
+{
+	// LOCAL VARIABLES
+	int retVal = 0;
+	hpWatch_ptr temp_ptr = NULL;  // Return value from realloc()
+	int* tempPending_ptr = NULL;  // Return value from realloc()
+	int newLen = 0;  // New number of entries in watch_arr
+	int fdFlags = 0;  // Return value from fcntl()
+	struct epoll_event newEvent = { 0 };  // Registration details
+
+	// INPUT VALIDATION
+	if (!loop_ptr || !reader_ptr || !callback)
+	{
+		HARKLE_ERROR(Harklepipe, watch_a_pipe, NULL pointer);
+		retVal = EINVAL;
+	}
+
+	// 1. MAKE ROOM
+	if (0 == retVal && loop_ptr->numWatches == loop_ptr->arrLen)
+	{
+		newLen = loop_ptr->arrLen ? loop_ptr->arrLen * 2 : HPIPE_LOOP_EVENTS;
+		tempPending_ptr = realloc(loop_ptr->pending_arr, newLen * sizeof(int));
+
+		if (!tempPending_ptr)
+		{
+			HARKLE_ERROR(Harklepipe, watch_a_pipe, realloc failed);
+			retVal = ENOMEM;
+		}
+		else
+		{
+			loop_ptr->pending_arr = tempPending_ptr;
+			temp_ptr = realloc(loop_ptr->watch_arr, newLen * sizeof(hpWatch));
+
+			if (!temp_ptr)
+			{
+				HARKLE_ERROR(Harklepipe, watch_a_pipe, realloc failed);
+				retVal = ENOMEM;
+			}
+			else
+			{
+				loop_ptr->watch_arr = temp_ptr;
+				loop_ptr->arrLen = newLen;
+			}
+		}
+	}
+
+	// 2. NON-BLOCKING
+	if (0 == retVal)
+	{
+		fdFlags = fcntl(reader_ptr->readFD, F_GETFL);
+
+		if (-1 == fdFlags || -1 == fcntl(reader_ptr->readFD, F_SETFL, fdFlags | O_NONBLOCK))
+		{
+			retVal = errno;
+			HARKLE_ERROR(Harklepipe, watch_a_pipe, fcntl failed);
+		}
+	}
+
+	// 3. REGISTER
+	if (0 == retVal)
+	{
+		newEvent.events = EPOLLIN;
+		newEvent.data.u32 = (uint32_t)loop_ptr->numWatches;
+
+		if (epoll_ctl(loop_ptr->epollFD, EPOLL_CTL_ADD, reader_ptr->readFD, &newEvent))
+		{
+			retVal = errno;
+			HARKLE_ERROR(Harklepipe, watch_a_pipe, epoll_ctl failed);
+		}
+		else
+		{
+			loop_ptr->watch_arr[loop_ptr->numWatches].reader_ptr = reader_ptr;
+			loop_ptr->watch_arr[loop_ptr->numWatches].stop = stop;
+			loop_ptr->watch_arr[loop_ptr->numWatches].framed = framed;
+			loop_ptr->watch_arr[loop_ptr->numWatches].callback = callback;
+			loop_ptr->watch_arr[loop_ptr->numWatches].userData = userData;
+			loop_ptr->watch_arr[loop_ptr->numWatches].pending = false;
+			loop_ptr->numWatches++;
+			loop_ptr->numOpen++;
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+int run_pipe_loop(hpLoop_ptr loop_ptr, int timeout, int* numMessages)
+{
+	// LOCAL VARIABLES
+	int retVal = 0;
+	struct epoll_event event_arr[HPIPE_LOOP_EVENTS];  // Ready pipes
+	int numReady = 0;  // Return value from epoll_wait()
+	int numTodo = 0;  // Entries of pending_arr to dispatch this call
+	int numKept = 0;  // Entries of pending_arr to dispatch again next call
+	int watchIdx = 0;  // Index into watch_arr
+	hpWatch_ptr watch_ptr = NULL;  // Ready pipe currently being read
+	hpReader_ptr reader_ptr = NULL;  // watch_ptr's reader
+	char* message = NULL;  // Current message
+	size_t msgLen = 0;  // Length of message
+	int numRead = 0;  // Messages read from watch_ptr this call
+	int errNum = 0;  // errno from the readers
+	int i = 0;  // Iterating variable
+
+	// INPUT VALIDATION
+	if (numMessages)
+	{
+		*numMessages = 0;
+	}
+
+	if (!loop_ptr)
+	{
+		HARKLE_ERROR(Harklepipe, run_pipe_loop, NULL pointer);
+		retVal = EINVAL;
+	}
+
+	// WAIT
+	// Don't block while buffered messages are already waiting
+	if (0 == retVal)
+	{
+		numReady = epoll_wait(loop_ptr->epollFD, event_arr, HPIPE_LOOP_EVENTS, \
+			                  loop_ptr->numPending ? 0 : timeout);
+
+		if (-1 == numReady)
+		{
+			if (EINTR != errno)
+			{
+				retVal = errno;
+				HARKLE_ERROR(Harklepipe, run_pipe_loop, epoll_wait failed);
+			}
+			numReady = 0;
+		}
+	}
+
+	// QUEUE
+	// Pending pipes go first, followed by the newly ready ones
+	if (0 == retVal)
+	{
+		for (i = 0; i < numReady; i++)
+		{
+			watch_ptr = loop_ptr->watch_arr + event_arr[i].data.u32;
+
+			if (false == watch_ptr->pending)
+			{
+				watch_ptr->pending = true;
+				loop_ptr->pending_arr[loop_ptr->numPending++] = (int)event_arr[i].data.u32;
+			}
+		}
+		numTodo = loop_ptr->numPending;
+	}
+
+	// DISPATCH
+	for (i = 0; i < numTodo; i++)
+	{
+		watchIdx = loop_ptr->pending_arr[i];
+		watch_ptr = loop_ptr->watch_arr + watchIdx;
+
+		// Once a callback stops the loop, leave the rest queued for the next call
+		if (retVal)
+		{
+			loop_ptr->pending_arr[numKept++] = watchIdx;
+			continue;
+		}
+
+		for (numRead = 0; watch_ptr->reader_ptr && numRead < HPIPE_LOOP_BURST; numRead++)
+		{
+			if (true == watch_ptr->framed)
+			{
+				message = read_pipe_frame(watch_ptr->reader_ptr, &msgLen, &errNum);
+			}
+			else
+			{
+				message = read_pipe_message(watch_ptr->reader_ptr, watch_ptr->stop, &msgLen, &errNum);
+			}
+
+			if (message)
+			{
+				if (numMessages)
+				{
+					(*numMessages)++;
+				}
+				if (false == watch_ptr->callback(message, msgLen, watch_ptr->userData))
+				{
+					retVal = ECANCELED;
+				}
+				release_a_string_len(&message, msgLen + 1);
+
+				if (retVal)
+				{
+					break;
+				}
+			}
+			else if (EAGAIN == errNum || EWOULDBLOCK == errNum)
+			{
+				break;  // Drained
+			}
+			else
+			{
+				// The pipe has ended (or failed): stop watching it
+				epoll_ctl(loop_ptr->epollFD, EPOLL_CTL_DEL, watch_ptr->reader_ptr->readFD, NULL);
+				watch_ptr->reader_ptr = NULL;
+				loop_ptr->numOpen--;
+				retVal = errNum;
+			}
+		}
+
+		// Cut short with bytes still buffered?  epoll won't report those, so keep it queued.
+		// (A drained reader may hold a partial message, but that needs more of the pipe.)
+		reader_ptr = watch_ptr->reader_ptr;
+
+		if (reader_ptr && reader_ptr->start < reader_ptr->end \
+			&& (HPIPE_LOOP_BURST == numRead || ECANCELED == retVal))
+		{
+			loop_ptr->pending_arr[numKept++] = watchIdx;
+		}
+		else
+		{
+			watch_ptr->pending = false;
+		}
+	}
+
+	if (numTodo > 0)
+	{
+		loop_ptr->numPending = numKept;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool free_pipe_loop(hpLoop_ptr* oldLoop_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	hpLoop_ptr loop_ptr = NULL;  // Easier to deal with this way
+
+	// INPUT VALIDATION
+	if (!oldLoop_ptr || !(*oldLoop_ptr))
+	{
+		HARKLE_ERROR(Harklepipe, free_pipe_loop, NULL pointer);
+		retVal = false;
+	}
+	else
+	{
+		loop_ptr = *oldLoop_ptr;
+
+		// 1. epoll instance
+		if (loop_ptr->epollFD > -1)
+		{
+			close(loop_ptr->epollFD);
+		}
+
+		// 2. Watches
+		if (loop_ptr->watch_arr)
+		{
+			harkleset(loop_ptr->watch_arr, 0x0, loop_ptr->arrLen * sizeof(hpWatch));
+			free(loop_ptr->watch_arr);
+		}
+		free(loop_ptr->pending_arr);
+
+		// 3. Loop
+		harkleset(loop_ptr, 0x0, sizeof(hpLoop));
+		free(loop_ptr);
+		*oldLoop_ptr = NULL;
+	}
+
+	// DONE
+	return retVal;
+}
@@ -1,12 +1,68 @@
 #ifndef __HARKLEPIPE__
 #define __HARKLEPIPE__
 
+#include <stdbool.h>		// bool, true, false
+#include <stdint.h>			// uint32_t
 #include <stdlib.h>			// size_t
 
 // MACROs to help properly access int array indices
 #define HPIPE_READ 0
 #define HPIPE_WRITE 1
 
+// Size of a length-prefixed frame's header (see: write_pipe_frame())
+#define HPIPE_FRAME_HEADER sizeof(uint32_t)
+
+#ifndef HPIPE_READER_SIZE
+// MACRO to determine the default starting size of a harklePipeReader's buffer
+#define HPIPE_READER_SIZE 4096
+#endif  // HPIPE_READER_SIZE
+
+#ifndef HPIPE_MAX_MESSAGE
+// MACRO to limit the size of one message or frame
+#define HPIPE_MAX_MESSAGE (16 * 1024 * 1024)
+#endif  // HPIPE_MAX_MESSAGE
+
+typedef struct harklePipeReader
+{
+	int readFD;					// The pipe's read file descriptor (not owned)
+	char* buff_ptr;				// Bytes read from readFD but not yet returned
+	size_t buffSize;			// Size of buff_ptr
+	size_t start;				// Offset of the first byte not yet returned
+	size_t end;					// Offset one past the last byte read
+	bool atEOF;					// read() has returned 0
+} hpReader, *hpReader_ptr;
+
+/*
+	run_pipe_loop() callback
+		message - A whole message or frame, freed by run_pipe_loop() after
+			the callback returns
+		msgLen - Length of message
+		userData - Passed through from watch_a_pipe()
+	Return true to keep going, false to stop run_pipe_loop() (ECANCELED)
+ */
+typedef bool (*hpMessageCallback)(char* message, size_t msgLen, void* userData);
+
+typedef struct harklePipeWatch
+{
+	hpReader_ptr reader_ptr;	// Reader for the watched pipe, NULL once the pipe has ended
+	char stop;					// Delimiter for read_pipe_message()
+	bool framed;				// If true, read_pipe_frame() is used instead
+	hpMessageCallback callback;	// Called with each message
+	void* userData;				// Passed through to callback
+	bool pending;				// Listed in the loop's pending_arr
+} hpWatch, *hpWatch_ptr;
+
+typedef struct harklePipeLoop
+{
+	int epollFD;				// epoll instance every watched pipe is registered with
+	hpWatch_ptr watch_arr;		// Watched pipes, indexed by their epoll_event data
+	int numWatches;				// Number of entries in watch_arr
+	int arrLen;					// Number of entries watch_arr (and pending_arr) can hold
+	int numOpen;				// Watched pipes that have not ended
+	int* pending_arr;			// watch_arr indices whose readers still hold buffered messages
+	int numPending;				// Number of entries in pending_arr
+} hpLoop, *hpLoop_ptr;
+
 
 /*
 	PURPOSE - Make plumbing easy
@@ -47,10 +103,87 @@ int make_a_pipe(int emptyPipes[2], int flags);
 		Maybe later we'll support some realloc functionality to
 			continue reading.  Right now, I don't need it and I
 			just want to get the bytes flowing through these pipes.
+		This function calls read() once per byte and can't read past the
+			stop character.  Prefer a harklePipeReader (see: read_pipe_message()).
  */
 char* read_a_pipe(int readFD, char stop, int* errNumber);
 
 
+/*
+	PURPOSE - Allocate a buffered reader for a pipe's read file descriptor
+	INPUT
+		readFD - The pipe's read file descriptor
+		buffSize - Starting size of the reader's buffer, 0 for HPIPE_READER_SIZE
+	OUTPUT
+		On success, a heap-allocated harklePipeReader struct pointer
+		On failure, NULL
+	NOTES
+		Use one reader per file descriptor, for the life of the descriptor.
+			Bytes read past the end of one message are kept for the next.
+		A reader is not thread-safe
+		It is the caller's responsibility to call free_pipe_reader()
+ */
+hpReader_ptr create_pipe_reader(int readFD, size_t buffSize);
+
+
+/*
+	PURPOSE - Read the next 'stop'-delimited message from a pipe
+	INPUT
+		reader_ptr - harklePipeReader for the pipe
+		stop - The delimiter
+		msgLen - [OUT] Optional.  Length of the message.
+		errNumber - [OUT] A pointer to a location to store errno upon error
+	OUTPUT
+		On success, heap-allocated, nul-terminated copy of the message
+			without the delimiter
+		On failure, NULL (errNumber is updated with errno)
+		At the end of the pipe, NULL (errNumber is 0)
+	NOTES
+		The pipe is read in large chunks and searched with memchr()
+		A non-blocking pipe without a whole message yet returns NULL and
+			EAGAIN.  The partial message stays buffered.
+		Messages may be any length up to HPIPE_MAX_MESSAGE (EMSGSIZE)
+		Anything left after the last delimiter is returned as the final message
+		It is the caller's responsibility to free the memory returned
+ */
+char* read_pipe_message(hpReader_ptr reader_ptr, char stop, size_t* msgLen, int* errNumber);
+
+
+/*
+	PURPOSE - Read the next length-prefixed frame from a pipe
+	INPUT
+		reader_ptr - harklePipeReader for the pipe
+		msgLen - [OUT] Length of the frame's payload
+		errNumber - [OUT] A pointer to a location to store errno upon error
+	OUTPUT
+		On success, heap-allocated copy of the payload (with a nul appended
+			for convenience)
+		On failure, NULL (errNumber is updated with errno)
+		At the end of the pipe, NULL (errNumber is 0)
+	NOTES
+		Frames are written by write_pipe_frame(): a native-endian uint32_t
+			payload length followed by the payload, which may hold any bytes
+		A non-blocking pipe without a whole frame yet returns NULL and EAGAIN
+		A pipe that ends mid-frame returns NULL and EPROTO
+		It is the caller's responsibility to free the memory returned
+ */
+void* read_pipe_frame(hpReader_ptr reader_ptr, size_t* msgLen, int* errNumber);
+
+
+/*
+	PURPOSE - Zeroize and free a harklePipeReader
+	INPUT
+		oldReader_ptr - A pointer to a hpReader_ptr
+	OUTPUT
+		On success, true
+		On failure, false
+	NOTES
+		This function will not close the file descriptor
+		*oldReader_ptr will be assigned NULL
+ */
+bool free_pipe_reader(hpReader_ptr* oldReader_ptr);
+
+
 /*
 	PURPOSE - Write "numBytes" worth of "writeStr" into the writeFD file
 		descriptor
@@ -60,10 +193,97 @@ char* read_a_pipe(int readFD, char stop, int* errNumber);
 		numBytpes - Amount of data to copy from writeStr into writeFD
 	OUTPUT
 		On success, 0
-		On failure, error code
+		On failure, error code (EAGAIN if a non-blocking pipe is full)
 	NOTES
 		This function will not close the file descriptor
  */
 int write_a_pipe(int writeFD, void* writeStr, size_t numBytes);
 
+
+/*
+	PURPOSE - Write "numBytes" of "msg" to writeFD as one length-prefixed frame
+	INPUT
+		writeFD - The pipe's write file descriptor
+		msg - Payload to write
+		numBytes - Length of the payload, up to HPIPE_MAX_MESSAGE
+	OUTPUT
+		On success, 0
+		On failure, errno
+	NOTES
+		The header and payload are written with a single writev() so frames
+			up to PIPE_BUF bytes are atomic, even with several writers
+		If a non-blocking pipe is full before anything is written, EAGAIN is
+			returned.  A frame that was partially written is always finished.
+		This function will not close the file descriptor
+ */
+int write_pipe_frame(int writeFD, void* msg, size_t numBytes);
+
+
+
+/*
+	PURPOSE - Allocate an epoll-driven event loop for many pipes
+	INPUT - None
+	OUTPUT
+		On success, a heap-allocated harklePipeLoop struct pointer
+		On failure, NULL
+	NOTES
+		It is the caller's responsibility to call free_pipe_loop()
+ */
+hpLoop_ptr create_pipe_loop(void);
+
+
+/*
+	PURPOSE - Register a pipe with an event loop
+	INPUT
+		loop_ptr - Event loop to register with
+		reader_ptr - harklePipeReader for the pipe's read file descriptor
+		stop - Message delimiter (ignored if framed is true)
+		framed - If true, the pipe carries write_pipe_frame() frames
+		callback - Called with each message read from the pipe
+		userData - Passed through to callback
+	OUTPUT
+		On success, 0
+		On failure, errno
+	NOTES
+		The read file descriptor is switched to non-blocking mode
+		The loop does not take ownership of reader_ptr
+ */
+int watch_a_pipe(hpLoop_ptr loop_ptr, hpReader_ptr reader_ptr, char stop, bool framed, \
+	             hpMessageCallback callback, void* userData);
+
+
+/*
+	PURPOSE - Wait for watched pipes and dispatch the messages of the ready ones
+	INPUT
+		loop_ptr - Event loop to run
+		timeout - Milliseconds to wait for a ready pipe, -1 to wait forever,
+			0 to return immediately
+		numMessages - [OUT] Optional.  Number of messages dispatched.
+	OUTPUT
+		On success (to include a timeout or an interrupted wait), 0
+		On failure, errno (ECANCELED if a callback returned false)
+	NOTES
+		Only ready pipes are read, so an idle pipe never holds up the others
+		At most HPIPE_LOOP_BURST messages are dispatched per pipe per call.
+			A pipe with messages still buffered in its reader is kept on the
+			loop's pending list and dispatched first by the next call, which
+			then polls epoll without waiting.
+		A pipe that has ended is unregistered (see: numOpen)
+ */
+int run_pipe_loop(hpLoop_ptr loop_ptr, int timeout, int* numMessages);
+
+
+/*
+	PURPOSE - Close and free an event loop
+	INPUT
+		oldLoop_ptr - A pointer to a hpLoop_ptr
+	OUTPUT
+		On success, true
+		On failure, false
+	NOTES
+		The watched pipes and their readers are left alone
+		*oldLoop_ptr will be assigned NULL
+ */
+bool free_pipe_loop(hpLoop_ptr* oldLoop_ptr);
+
 #endif  // __HARKLEPIPE__
\ No newline at end of file
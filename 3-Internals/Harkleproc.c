@@ -1,12 +1,14 @@
+#include <dirent.h>							// DT_DIR, DT_UNKNOWN
 #include <errno.h>							// errno
-#include "Harkledir.h"
+#include "Harkledir.h"						// open_dir_stream(), next_dir_entry()
 #include "Harkleproc.h"
 // #include <fcntl.h>	  					// open() flags
 #include "Fileroad.h"   					// read_a_file
-#include "Harklerror.h"						// HARKLE_ERROR
+#include "Harklerror.h"						// HARKLE_ERROR, HARKLE_ERRNO
 // #include "Map_Memory.h"
 #include <inttypes.h>						// strtoimax()
-#include "Memoroad.h"   					// copy_a_string
+#include "Memoroad.h"   					// copy_a_string, get_thread_count()
+#include <pthread.h>						// pthread_create(), pthread_join()
 #include <stdbool.h>						// bool, true, false
 #include <stdio.h>
 #include <stdlib.h>	 						// calloc
@@ -20,6 +22,42 @@
 
 #define HP_PID_BUFF 10
 
+#ifndef HPROC_DENTS_BUFF
+// MACRO defining the size of the getdents64 buffer list_proc_PIDs() uses for /proc
+#define HPROC_DENTS_BUFF 32768
+#endif  // HPROC_DENTS_BUFF
+
+#ifndef HPROC_PID_LIST_START
+// MACRO defining the starting capacity of the list_proc_PIDs() array
+#define HPROC_PID_LIST_START 1024
+#endif  // HPROC_PID_LIST_START
+
+#ifndef HPROC_SCAN_MAX_THREADS
+// MACRO defining the most worker threads refresh_PID_snapshot() will run
+#define HPROC_SCAN_MAX_THREADS 8
+#endif  // HPROC_SCAN_MAX_THREADS
+
+#ifndef HPROC_SCAN_MIN_PER_THREAD
+// MACRO defining the fewest new PIDs worth handing to another thread
+#define HPROC_SCAN_MIN_PER_THREAD 64
+#endif  // HPROC_SCAN_MIN_PER_THREAD
+
+// A PID refresh_PID_snapshot() needs to read and where the result goes
+typedef struct harkleProcScanTodo
+{
+	pid_t pidNum;  // PID to read
+	size_t slot;  // Index into the new pid_arr
+} hpTodo, *hpTodo_ptr;
+
+// State shared between refresh_PID_snapshot() and its worker threads
+typedef struct harkleProcScanDetails
+{
+	pidDetails_ptr* pid_arr;  // Destination array
+	hpTodo_ptr todo_arr;  // PIDs to read
+	size_t numTodo;  // Number of entries in todo_arr
+	size_t nextTodo;  // Next todo_arr entry to claim (atomic)
+} hpScan, *hpScan_ptr;
+
 #ifndef HARKLE_ERROR
 #define HARKLE_ERROR(header, funcName, msg) do { fprintf(stderr, "<<<ERROR>>> - %s - %s() - %s!\n", #header, #funcName, #msg); } while (0);
 #endif  // HARKLE_ERROR
@@ -48,6 +86,25 @@ bool proc_builder(char* buf, char* PID, size_t bufSize);
 pid_t convert_PID(char* PID);
 
 
+/*
+	Purpose - qsort() comparison function for pid_t values
+ */
+int compare_pid_t(const void* left_ptr, const void* right_ptr);
+
+
+/*
+	Purpose - refresh_PID_snapshot() worker thread start routine
+	Input - An hpScan_ptr
+	Output - NULL
+	Notes:
+		Claims todo_arr entries until they run out and stores each
+			populate_PID_struct() result in its pid_arr slot
+		Also called directly by refresh_PID_snapshot() so the calling thread
+			does its share of the work
+ */
+void* hproc_scan_worker(void* scan_ptr);
+
+
 pidDetails_ptr create_PID_struct(void)
 {
 	// LOCAL VARIABLES
@@ -519,58 +576,396 @@ pidDetails_ptr* parse_proc_PID_structs(void)
 {
 	// LOCAL VARIABLES
 	pidDetails_ptr* retVal = NULL;
-	dirDetails_ptr procDetails_ptr = NULL;
-	bool success = true;  // Change this to false if anything fails
+	pidSnapshot_ptr snapshot_ptr = create_PID_snapshot(0);
 
-	// 1. walk_proc()
-	// puts("1. parse_proc_PID_structs() calls walk_proc()");  // DEBUGGING
-	if (success == true)
+	// TAKE THE SNAPSHOT'S ARRAY
+	if (snapshot_ptr)
 	{
-		procDetails_ptr = walk_proc();
+		retVal = snapshot_ptr->pid_arr;
+		snapshot_ptr->pid_arr = NULL;
+		snapshot_ptr->numPIDs = 0;
 
-		if (!procDetails_ptr)
+		if (false == free_PID_snapshot(&snapshot_ptr))
 		{
-			HARKLE_ERROR(Harkleproc, parse_proc_PID_structs, walk_proc failed);
-			success = false;
+			HARKLE_ERROR(Harkleproc, parse_proc_PID_structs, free_PID_snapshot failed);
 		}
 	}
+	else
+	{
+		HARKLE_ERROR(Harkleproc, parse_proc_PID_structs, create_PID_snapshot failed);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+pid_t* list_proc_PIDs(size_t* numPIDs)
+{
+	// LOCAL VARIABLES
+	pid_t* retVal = NULL;
+	pid_t* temp_ptr = NULL;  // Return value from realloc()
+	bool success = true;  // Make this false if anything fails
+	bool isSorted = true;  // Make this false if getdents64 returns PIDs out of order
+	int errNum = 0;  // Store errnos here
+	hdStream procStream = { .dirFD = -1 };  // Bulk reader for /proc
+	const char* entryName = NULL;  // Name of the current /proc entry
+	unsigned char entryType = 0;  // Type of the current /proc entry
+	const char* name_ptr = NULL;  // Iterating variable for entryName
+	pid_t pidNum = 0;  // PID parsed from entryName
+	size_t count = 0;  // Number of PIDs in retVal
+	size_t capacity = HPROC_PID_LIST_START;  // Number of pid_t's retVal can hold
+
+	// INPUT VALIDATION
+	if (!numPIDs)
+	{
+		HARKLE_ERROR(Harkleproc, list_proc_PIDs, NULL pointer);
+		success = false;
+	}
+	else
+	{
+		*numPIDs = 0;
+	}
 
-	// 2. parse_PID_dirs_to_struct_arr()
-	// puts("2. parse_proc_PID_structs() calls parse_PID_dirs_to_struct_arr()");  // DEBUGGING
-	if (success == true && procDetails_ptr)
+	// OPEN /proc
+	if (true == success)
 	{
-		retVal = parse_PID_dirs_to_struct_arr(procDetails_ptr);
+		retVal = malloc(capacity * sizeof(pid_t));
 
 		if (!retVal)
 		{
-			HARKLE_ERROR(Harkleproc, parse_proc_PID_structs, parse_PID_dirs_to_struct_arr failed);
+			HARKLE_ERROR(Harkleproc, list_proc_PIDs, malloc failed);
+			success = false;
+		}
+		else if (false == open_dir_stream(&procStream, "/proc", HPROC_DENTS_BUFF, &errNum))
+		{
+			HARKLE_ERROR(Harkleproc, list_proc_PIDs, open_dir_stream failed);
+			HARKLE_ERRNO(Harkleproc, open_dir_stream, errNum);
 			success = false;
 		}
 	}
 
-	// 3. free_dirDetails_ptr()
-	// puts("3. parse_proc_PID_structs() calls free_dirDetails_ptr()");  // DEBUGGING
-	if (procDetails_ptr)
+	// READ THE DIRECTORY IN BULK
+	while (true == success && true == next_dir_entry(&procStream, &entryName, &entryType, NULL, &errNum))
 	{
-		if (false == free_dirDetails_ptr(&procDetails_ptr))
+		if (DT_DIR != entryType)
 		{
-			HARKLE_ERROR(Harkleproc, parse_proc_PID_structs, free_dirDetails_ptr failed);
-			success = false;
+			continue;
+		}
+
+		// Parse the name, skipping anything that isn't all digits
+		name_ptr = entryName;
+		pidNum = 0;
+
+		while (*name_ptr >= '0' && *name_ptr <= '9')
+		{
+			pidNum = (pidNum * 10) + (*name_ptr - '0');
+			name_ptr++;
 		}
+
+		if (*name_ptr || name_ptr == entryName || pidNum < 1)
+		{
+			continue;
+		}
+
+		// Grow geometrically
+		if (count == capacity)
+		{
+			temp_ptr = realloc(retVal, capacity * 2 * sizeof(pid_t));
+
+			if (!temp_ptr)
+			{
+				HARKLE_ERROR(Harkleproc, list_proc_PIDs, realloc failed);
+				success = false;
+				break;
+			}
+
+			retVal = temp_ptr;
+			capacity *= 2;
+		}
+
+		if (count > 0 && pidNum < retVal[count - 1])
+		{
+			isSorted = false;
+		}
+		retVal[count] = pidNum;
+		count++;
+	}
+
+	if (true == success && errNum)
+	{
+		HARKLE_ERROR(Harkleproc, list_proc_PIDs, next_dir_entry failed);
+		HARKLE_ERRNO(Harkleproc, getdents64, errNum);
+		success = false;
+	}
+
+	// SORT
+	if (true == success && false == isSorted)
+	{
+		qsort(retVal, count, sizeof(pid_t), compare_pid_t);
 	}
 
 	// CLEAN UP
-	if (success == false)
+	if (procStream.dirFD > -1)
 	{
-		if (retVal)
+		close_dir_stream(&procStream);
+	}
+
+	if (true == success)
+	{
+		*numPIDs = count;
+	}
+	else if (retVal)
+	{
+		free(retVal);
+		retVal = NULL;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+pidSnapshot_ptr create_PID_snapshot(int numThreads)
+{
+	// LOCAL VARIABLES
+	pidSnapshot_ptr retVal = NULL;
+	int numTries = 0;  // Check this against HPROC_MAX_TRIES
+
+	// ALLOCATE
+	while (!retVal && numTries < HPROC_MAX_TRIES)
+	{
+		retVal = (pidSnapshot_ptr)calloc(1, sizeof(pidSnapshot));
+		numTries++;
+	}
+
+	// POPULATE
+	if (retVal)
+	{
+		retVal->numThreads = numThreads;
+
+		if (false == refresh_PID_snapshot(retVal))
 		{
-			if (false == free_PID_struct_arr(&retVal))
+			HARKLE_ERROR(Harkleproc, create_PID_snapshot, refresh_PID_snapshot failed);
+
+			if (false == free_PID_snapshot(&retVal))
+			{
+				HARKLE_ERROR(Harkleproc, create_PID_snapshot, free_PID_snapshot failed);
+			}
+		}
+	}
+	else
+	{
+		HARKLE_ERROR(Harkleproc, create_PID_snapshot, Failed to allocate a pidSnapshot struct pointer);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool refresh_PID_snapshot(pidSnapshot_ptr snapshot_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	pid_t* pidList_arr = NULL;  // Current PIDs from list_proc_PIDs()
+	size_t numListed = 0;  // Number of PIDs in pidList_arr
+	pidDetails_ptr* oldArr = NULL;  // The snapshot's current pid_arr
+	size_t numOld = 0;  // Number of entries in oldArr
+	pidDetails_ptr* newArr = NULL;  // The snapshot's next pid_arr
+	size_t numNew = 0;  // Number of entries in newArr
+	size_t numGone = 0;  // Entries newly flagged as !stillExists
+	hpScan scan = { 0 };  // State shared with the worker threads
+	pthread_t threadIDs[HPROC_SCAN_MAX_THREADS];  // Worker threads
+	size_t numThreads = 0;  // Number of threads (including this one) to read new PIDs with
+	size_t numStarted = 0;  // Number of worker threads actually started
+	size_t oldIndex = 0;  // Iterating variable for oldArr
+	size_t listIndex = 0;  // Iterating variable for pidList_arr
+	size_t i = 0;  // Iterating variable
+	int errNum = 0;  // Store errnos here
+
+	// INPUT VALIDATION
+	if (!snapshot_ptr)
+	{
+		HARKLE_ERROR(Harkleproc, refresh_PID_snapshot, NULL pointer);
+		retVal = false;
+	}
+	else
+	{
+		oldArr = snapshot_ptr->pid_arr;
+		numOld = snapshot_ptr->numPIDs;
+	}
+
+	// ENUMERATE
+	if (true == retVal)
+	{
+		pidList_arr = list_proc_PIDs(&numListed);
+
+		if (!pidList_arr)
+		{
+			HARKLE_ERROR(Harkleproc, refresh_PID_snapshot, list_proc_PIDs failed);
+			retVal = false;
+		}
+	}
+
+	// ALLOCATE
+	if (true == retVal)
+	{
+		// Worst case: every old entry survives (flagged or not) and every listed PID is new
+		newArr = (pidDetails_ptr*)calloc(numOld + numListed + 1, sizeof(pidDetails_ptr));
+		scan.todo_arr = (hpTodo_ptr)calloc(numListed + 1, sizeof(hpTodo));
+
+		if (!newArr || !scan.todo_arr)
+		{
+			HARKLE_ERROR(Harkleproc, refresh_PID_snapshot, calloc failed);
+			retVal = false;
+		}
+	}
+
+	// DIFF (both lists are sorted by PID)
+	if (true == retVal)
+	{
+		while (oldIndex < numOld || listIndex < numListed)
+		{
+			if (oldIndex < numOld && false == oldArr[oldIndex]->stillExists)
+			{
+				// Reported as gone last time; drop it now
+				if (false == free_PID_struct(&(oldArr[oldIndex])))
+				{
+					HARKLE_ERROR(Harkleproc, refresh_PID_snapshot, free_PID_struct failed);
+				}
+				oldIndex++;
+			}
+			else if (oldIndex < numOld && (listIndex >= numListed || oldArr[oldIndex]->pidNum < pidList_arr[listIndex]))
+			{
+				// Disappeared
+				oldArr[oldIndex]->stillExists = false;
+				newArr[numNew++] = oldArr[oldIndex++];
+				numGone++;
+			}
+			else if (oldIndex < numOld && oldArr[oldIndex]->pidNum == pidList_arr[listIndex])
 			{
-				HARKLE_ERROR(Harkleproc, parse_proc_PID_structs, free_PID_struct_arr failed);
+				// Still here
+				newArr[numNew++] = oldArr[oldIndex++];
+				listIndex++;
+			}
+			else
+			{
+				// New PID: leave its slot NULL for now
+				scan.todo_arr[scan.numTodo].pidNum = pidList_arr[listIndex++];
+				scan.todo_arr[scan.numTodo].slot = numNew++;
+				scan.numTodo++;
 			}
 		}
 	}
 
+	// READ NEW PIDS IN PARALLEL
+	if (true == retVal && scan.numTodo > 0)
+	{
+		scan.pid_arr = newArr;
+		scan.nextTodo = 0;
+
+		// Thread count
+		numThreads = get_thread_count(snapshot_ptr->numThreads, HPROC_SCAN_MAX_THREADS, scan.numTodo, HPROC_SCAN_MIN_PER_THREAD);
+
+		// This thread is one of the numThreads
+		for (numStarted = 0; numStarted < numThreads - 1; numStarted++)
+		{
+			errNum = pthread_create(&(threadIDs[numStarted]), NULL, hproc_scan_worker, &scan);
+
+			if (errNum)
+			{
+				HARKLE_ERROR(Harkleproc, refresh_PID_snapshot, pthread_create failed);
+				HARKLE_ERRNO(Harkleproc, pthread_create, errNum);
+				break;  // This thread will pick up the slack
+			}
+		}
+
+		hproc_scan_worker(&scan);
+
+		for (i = 0; i < numStarted; i++)
+		{
+			pthread_join(threadIDs[i], NULL);
+		}
+
+		// Squeeze out PIDs that could not be read
+		numListed = 0;  // Reused as the write index
+		for (i = 0; i < numNew; i++)
+		{
+			if (newArr[i])
+			{
+				newArr[numListed++] = newArr[i];
+			}
+		}
+		for (i = numListed; i < numNew; i++)
+		{
+			newArr[i] = NULL;
+		}
+		numNew = numListed;
+	}
+
+	// UPDATE THE SNAPSHOT
+	if (true == retVal)
+	{
+		if (oldArr)
+		{
+			free(oldArr);  // Its surviving entries now live in newArr
+		}
+		snapshot_ptr->pid_arr = newArr;
+		snapshot_ptr->numPIDs = numNew;
+		snapshot_ptr->numNew = scan.numTodo;
+		snapshot_ptr->numGone = numGone;
+	}
+	else if (newArr)
+	{
+		free(newArr);
+	}
+
+	// CLEAN UP
+	if (pidList_arr)
+	{
+		free(pidList_arr);
+	}
+	if (scan.todo_arr)
+	{
+		free(scan.todo_arr);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool free_PID_snapshot(pidSnapshot_ptr* snapshot_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+
+	// INPUT VALIDATION
+	if (snapshot_ptr && *snapshot_ptr)
+	{
+		// 1. Free the PID array
+		if ((*snapshot_ptr)->pid_arr)
+		{
+			if (false == free_PID_struct_arr(&((*snapshot_ptr)->pid_arr)))
+			{
+				HARKLE_ERROR(Harkleproc, free_PID_snapshot, free_PID_struct_arr failed);
+				retVal = false;
+			}
+		}
+
+		// 2. Free the snapshot
+		free(*snapshot_ptr);
+
+		// 3. NULL the snapshot
+		*snapshot_ptr = NULL;
+	}
+	else
+	{
+		HARKLE_ERROR(Harkleproc, free_PID_snapshot, NULL pointer);
+		retVal = false;
+	}
+
 	// DONE
 	return retVal;
 }
@@ -1036,3 +1431,38 @@ pid_t convert_PID(char* PID)
 	// fprintf(stdout, "Converted '%s' to '%jd'\n", PID, (intmax_t)retVal);  // DEBUGGING
 	return retVal;
 }
+
+
+int compare_pid_t(const void* left_ptr, const void* right_ptr)
+{
+	pid_t left = *(const pid_t*)left_ptr;
+	pid_t right = *(const pid_t*)right_ptr;
+
+	return (left > right) - (left < right);
+}
+
+
+void* hproc_scan_worker(void* scan_ptr)
+{
+	// LOCAL VARIABLES
+	hpScan_ptr scan = (hpScan_ptr)scan_ptr;
+	char pidPath[32] = { 0 };  // /proc/<PID>/
+	size_t todoNum = 0;  // todo_arr entry currently claimed
+
+	// READ
+	while (1)
+	{
+		todoNum = __atomic_fetch_add(&(scan->nextTodo), 1, __ATOMIC_ACQ_REL);
+
+		if (todoNum >= scan->numTodo)
+		{
+			break;
+		}
+
+		snprintf(pidPath, sizeof(pidPath), "/proc/%d/", (int)scan->todo_arr[todoNum].pidNum);
+		scan->pid_arr[scan->todo_arr[todoNum].slot] = populate_PID_struct(pidPath);
+	}
+
+	// DONE
+	return NULL;
+}
@@ -2,6 +2,7 @@
 #define __HARKLEPROC__
 
 #include "Harkledir.h"
+#include <stddef.h>							// size_t
 #include <sys/types.h>						// pid_t
 #include <stdbool.h>						// bool, true, false
 
@@ -13,6 +14,15 @@ typedef struct harklePIDDetails
     bool stillExists;       // False if PID ever disappears
 } pidDetails, *pidDetails_ptr;
 
+typedef struct harklePIDSnapshot
+{
+	pidDetails_ptr* pid_arr;  // NULL-terminated array of pidDetails_ptr, sorted by pidNum
+	size_t numPIDs;           // Number of pidDetails_ptr in pid_arr
+	size_t numNew;            // PIDs read by the last refresh
+	size_t numGone;           // PIDs flagged !stillExists by the last refresh
+	int numThreads;           // Worker threads used to read new PIDs, 0 for one-per-CPU
+} pidSnapshot, *pidSnapshot_ptr;
+
 
 /*
     Purpose - Allocated a harklePIDDetails on the heap
@@ -88,15 +98,70 @@ char** parse_proc_PIDs(void);
 	Input - None
 	Ouput - A NULL-terminated, heap-allocated array of heap-allocated harklePIDDetails structs, one-per-directory
 	Notes:
-		Does all the 'heavy lifting' to walk /proc and filter out non-<PID> dirs
-		This function calls walk_proc() to procure a list of /proc directories
-		This function free()s the dirDetails_ptr resulting from walk_proc() before returning
+		Takes a one-off pidSnapshot (see: create_PID_snapshot()) and hands back its pid_arr
+		The array is sorted by pidNum
 		It is your responsibility to free each pidDetails_ptr and the pidDetails_ptr* itself 
 			(or call free_PID_struct_arr())
  */
 pidDetails_ptr* parse_proc_PID_structs(void);
 
 
+/*
+	Purpose - Enumerate the PIDs currently in /proc
+	Input
+		numPIDs - [OUT] Number of PIDs in the return value
+	Output - A heap-allocated, ascending array of pid_t values on success, NULL on failure
+	Notes:
+		Reads /proc with a harkleDirStream (getdents64 in bulk) and parses the
+			names in place, so no per-entry allocations or stat() calls are made
+		It is the caller's responsibility to free() the return value
+ */
+pid_t* list_proc_PIDs(size_t* numPIDs);
+
+
+/*
+	Purpose - Take a snapshot of every running PID
+	Input
+		numThreads - Number of worker threads used to read /proc/<PID>/cmdline,
+			0 for one-per-CPU
+	Output - A heap-allocated pidSnapshot on success, NULL on failure
+	Notes:
+		Calls refresh_PID_snapshot() to populate the snapshot
+		It is your responsibility to call free_PID_snapshot(&pidSnapshot_ptr)
+ */
+pidSnapshot_ptr create_PID_snapshot(int numThreads);
+
+
+/*
+	Purpose - Bring a snapshot up to date with /proc
+	Input
+		snapshot_ptr - A pidSnapshot_ptr from create_PID_snapshot()
+	Output - True on success, False on failure
+	Notes:
+		Only PIDs that are new since the last refresh are read, fanned out
+			across snapshot_ptr->numThreads worker threads
+		PIDs that have disappeared stay in pid_arr with stillExists set to false
+			until the next refresh, which frees them
+		A PID whose entry already had stillExists set to false is read again
+			if it shows up in /proc (e.g., the PID was reused)
+		pidDetails_ptrs for PIDs that still exist are not reallocated, so they
+			remain valid across refreshes
+ */
+bool refresh_PID_snapshot(pidSnapshot_ptr snapshot_ptr);
+
+
+/*
+	Purpose - To free a pidSnapshot and everything in it
+	Input
+		snapshot_ptr - A pointer to a pidSnapshot_ptr
+	Output - True on success, False on failure
+	Notes:
+		Calls free_PID_struct_arr() on pid_arr
+		Will set the pidSnapshot_ptr to NULL when done
+ */
+bool free_PID_snapshot(pidSnapshot_ptr* snapshot_ptr);
+
+
 /*
 	Purpose - Walk the /proc directory for a list of files and dirs
 	Input - None
@@ -1,17 +1,101 @@
+#define _GNU_SOURCE				// pthread_attr_setaffinity_np() is only available when GNU extensions are enabled
 #include <errno.h>				// errno
 #include <fcntl.h>				// O_NONBLOCK
-#include "Harklepipe.h"			// build_a_pipe(), HPIPE_READ, HPIPE_WRITE
+#include "Harklepipe.h"			// build_a_pipe(), create_pipe_reader(), HPIPE_READ, HPIPE_WRITE
 #include "Harklerror.h"			// HARKLE_ERROR()
 #include "Harklethread.h"
 #include "Memoroad.h"			// copy_a_string(), get_me_a_buffer()
-#include <stdlib.h>				// calloc()
-#include <string.h>				// memcpy(), strerror()
+#include <inttypes.h>			// PRIu64
+#include <stdio.h>				// snprintf()
+#include <stdlib.h>				// calloc(), posix_memalign(), strtoull()
+#include <sched.h>				// cpu_set_t, CPU_SET(), sched_getaffinity()
+#include <string.h>				// memcpy(), memmove(), strerror()
+#include <unistd.h>				// sysconf()
 
 #ifndef HARKLETHREAD_MAX_TRIES
 // MACRO to limit repeated allocation attempts
 #define HARKLETHREAD_MAX_TRIES 3
 #endif // HARKLETHREAD_MAX_TRIES
 
+#ifndef HTHR_RING_SLOTS
+// MACRO to determine the default number of messages a hThrRing can hold
+#define HTHR_RING_SLOTS 1024
+#endif  // HTHR_RING_SLOTS
+
+#ifndef HTHR_MESSAGE_BUFF
+// MACRO to size the string send_harklethread() writes to a pipe (UINT64_MAX + newline + nul)
+#define HTHR_MESSAGE_BUFF 24
+#endif  // HTHR_MESSAGE_BUFF
+
+#ifndef HTHR_POOL_MAX_WORKERS
+// MACRO to limit the number of threads in a hThrPool
+#define HTHR_POOL_MAX_WORKERS 256
+#endif  // HTHR_POOL_MAX_WORKERS
+
+#ifndef HTHR_DEQUE_LEN
+// MACRO to determine the starting number of tasks a hThrPool worker's deque can hold
+#define HTHR_DEQUE_LEN 64
+#endif  // HTHR_DEQUE_LEN
+
+// The hThrPool worker running on this thread, if any (see: submit_hThrTask())
+__thread hThrWorker_ptr hthrCurrWorker = NULL;
+
+
+/*
+	PURPOSE - hThrPool worker thread start routine
+	INPUT
+		worker_ptr - This worker's hThreadWorker struct pointer
+	OUTPUT
+		NULL
+	NOTES
+		Runs its own newest task, else steals another worker's oldest task,
+			else sleeps on idleCond until more tasks are queued or the pool shuts down
+ */
+void* hthr_pool_worker(void* worker_ptr);
+
+
+/*
+	PURPOSE - Add a task to the bottom of a worker's deque
+	INPUT
+		pool_ptr - Pool the worker belongs to
+		worker_ptr - Worker whose deque receives the task
+		task_ptr - Task to copy in
+	OUTPUT
+		On success, true
+		On failure, false (the deque could not grow)
+	NOTES
+		numQueued is incremented under the deque's lock, before any worker
+			can take the task back out
+ */
+bool push_hThrTask(hThrPool_ptr pool_ptr, hThrWorker_ptr worker_ptr, hThrTask_ptr task_ptr);
+
+
+/*
+	PURPOSE - Take a task from a worker's deque
+	INPUT
+		pool_ptr - Pool the worker belongs to
+		worker_ptr - Worker whose deque to take from
+		task_ptr - [OUT] The task
+		steal - If true, take the oldest task (top).  Otherwise, the newest (bottom).
+	OUTPUT
+		true if a task was taken, false if the deque was empty
+ */
+bool pop_hThrTask(hThrPool_ptr pool_ptr, hThrWorker_ptr worker_ptr, hThrTask_ptr task_ptr, bool steal);
+
+
+/*
+	PURPOSE - Run a task and report its completion
+	INPUT
+		pool_ptr - Pool the task was submitted to
+		task_ptr - Task to run
+	OUTPUT
+		None
+	NOTES
+		Calls the callback, completes the future, then wakes wait_hThrPool()
+			if this was the last pending task
+ */
+void run_hThrTask(hThrPool_ptr pool_ptr, hThrTask_ptr task_ptr);
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// STRUCT FUNCTIONS START ///////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -21,7 +105,8 @@ hThrDetails_ptr create_a_hThrDetails_ptr(char* threadName, \
 	                                     int threadNum, \
 	                                     void* (*start_routine) (void*), \
 	                                     void* arg, \
-	                                     size_t argSize)
+	                                     size_t argSize, \
+	                                     int transport)
 {
 	// LOCAL VARIABLES
 	hThrDetails_ptr retVal = NULL;
@@ -45,6 +130,11 @@ hThrDetails_ptr create_a_hThrDetails_ptr(char* threadName, \
 		HARKLE_ERROR(Harklethread, create_a_hThrDetails_ptr, Invalid argSize);
 		success = false;
 	}
+	else if (HTHR_TRANSPORT_PIPE != transport && HTHR_TRANSPORT_RING != transport)
+	{
+		HARKLE_ERROR(Harklethread, create_a_hThrDetails_ptr, Invalid transport);
+		success = false;
+	}
 	
 	// ALLOCATE MEMORY
 	if (true == success)
@@ -134,7 +224,7 @@ hThrDetails_ptr create_a_hThrDetails_ptr(char* threadName, \
 	}
 	
 	// 4. Build-A-Pipe Workshop
-	if (true == success)
+	if (true == success && HTHR_TRANSPORT_PIPE == transport)
 	{
 		// Make these pipes non-blocking so reads from an empty pipe don't hang
 		tmpInt = make_a_pipe(retVal->pipeFDs, O_NONBLOCK);
@@ -146,6 +236,37 @@ hThrDetails_ptr create_a_hThrDetails_ptr(char* threadName, \
 			fprintf(stderr, "make_a_pipe() returned errno:\t%s\n", strerror(tmpInt));
 			success = false;
 		}
+		else
+		{
+			// Read the pipe in chunks instead of a byte at a time
+			retVal->pipeReader = create_pipe_reader(retVal->pipeFDs[HPIPE_READ], 0);
+
+			if (!(retVal->pipeReader))
+			{
+				HARKLE_ERROR(Harklethread, create_a_hThrDetails_ptr, create_pipe_reader failed);
+				success = false;
+			}
+		}
+	}
+
+	// 5. Ring
+	if (true == success && HTHR_TRANSPORT_RING == transport)
+	{
+		retVal->pipeFDs[HPIPE_READ] = -1;
+		retVal->pipeFDs[HPIPE_WRITE] = -1;
+		retVal->ring_ptr = create_a_hThrRing(0);
+
+		if (!(retVal->ring_ptr))
+		{
+			HARKLE_ERROR(Harklethread, create_a_hThrDetails_ptr, create_a_hThrRing failed);
+			success = false;
+		}
+	}
+
+	// 6. Transport
+	if (true == success)
+	{
+		retVal->transport = transport;
 	}
 	
 	// CLEAN UP
@@ -241,6 +362,26 @@ bool free_a_hThrDetails_ptr(hThrDetails_ptr* oldStruct_ptr)
 	// 10. int pipeFDs[2]; // Pipe used to send data from the thread to the main thread
 	tmpStruct_ptr->pipeFDs[HPIPE_READ] = 0;
 	tmpStruct_ptr->pipeFDs[HPIPE_WRITE] = 0;
+	// 11. hpReader_ptr pipeReader;				// Buffered reader for pipeFDs[HPIPE_READ]
+	if (tmpStruct_ptr->pipeReader)
+	{
+		if (false == free_pipe_reader(&(tmpStruct_ptr->pipeReader)))
+		{
+			HARKLE_ERROR(Harklethread, free_a_hThrDetails_ptr, free_pipe_reader failed);
+			success = false;
+		}
+	}
+	// 12. int transport;						// HTHR_TRANSPORT_PIPE or HTHR_TRANSPORT_RING
+	tmpStruct_ptr->transport = 0;
+	// 13. hThrRing_ptr ring_ptr;				// Single-producer/single-consumer ring for HTHR_TRANSPORT_RING
+	if (tmpStruct_ptr->ring_ptr)
+	{
+		if (false == free_a_hThrRing(&(tmpStruct_ptr->ring_ptr)))
+		{
+			HARKLE_ERROR(Harklethread, free_a_hThrDetails_ptr, free_a_hThrRing failed);
+			success = false;
+		}
+	}
 
 	// DONE
 	if (false == success)
@@ -256,6 +397,160 @@ bool free_a_hThrDetails_ptr(hThrDetails_ptr* oldStruct_ptr)
 /////////////////////////// STRUCT FUNCTIONS STOP ////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////// RING FUNCTIONS START ////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+hThrRing_ptr create_a_hThrRing(size_t numSlots)
+{
+	// LOCAL VARIABLES
+	hThrRing_ptr retVal = NULL;
+	size_t ringLen = 2;  // Power of 2 that fits numSlots
+	int tmpInt = 0;  // Return value from posix_memalign()
+
+	// INPUT VALIDATION
+	if (!numSlots)
+	{
+		numSlots = HTHR_RING_SLOTS;
+	}
+
+	while (ringLen < numSlots)
+	{
+		ringLen <<= 1;
+	}
+
+	// ALLOCATE
+	// 1. Ring, aligned so head and tail each get a cache line
+	tmpInt = posix_memalign((void**)&retVal, HTHR_CACHE_LINE, sizeof(hThrRing));
+
+	if (tmpInt)
+	{
+		HARKLE_ERROR(Harklethread, create_a_hThrRing, posix_memalign failed);
+		HARKLE_ERRNO(Harklethread, posix_memalign, tmpInt);
+		retVal = NULL;
+	}
+	else
+	{
+		harkleset(retVal, 0x0, sizeof(hThrRing));
+		retVal->mask = ringLen - 1;
+
+		// 2. Slots
+		retVal->slot_arr = calloc(ringLen, sizeof(uint64_t));
+
+		if (!(retVal->slot_arr))
+		{
+			HARKLE_ERROR(Harklethread, create_a_hThrRing, calloc failed);
+			free(retVal);
+			retVal = NULL;
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool push_hThrRing(hThrRing_ptr ring_ptr, uint64_t message)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	size_t head = ring_ptr->head;  // Only this thread stores head
+
+	// FULL?
+	if (head - ring_ptr->tailCache > ring_ptr->mask)
+	{
+		// Pairs with the release in pop_hThrRing() so the slot is free to reuse
+		ring_ptr->tailCache = __atomic_load_n(&(ring_ptr->tail), __ATOMIC_ACQUIRE);
+
+		if (head - ring_ptr->tailCache > ring_ptr->mask)
+		{
+			retVal = false;
+		}
+	}
+
+	// PUSH
+	if (true == retVal)
+	{
+		ring_ptr->slot_arr[head & ring_ptr->mask] = message;
+		// Publish the slot before the new head
+		__atomic_store_n(&(ring_ptr->head), head + 1, __ATOMIC_RELEASE);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool pop_hThrRing(hThrRing_ptr ring_ptr, uint64_t* message)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	size_t tail = ring_ptr->tail;  // Only this thread stores tail
+
+	// EMPTY?
+	if (tail == ring_ptr->headCache)
+	{
+		// Pairs with the release in push_hThrRing() so the slot is visible
+		ring_ptr->headCache = __atomic_load_n(&(ring_ptr->head), __ATOMIC_ACQUIRE);
+
+		if (tail == ring_ptr->headCache)
+		{
+			retVal = false;
+		}
+	}
+
+	// POP
+	if (true == retVal)
+	{
+		*message = ring_ptr->slot_arr[tail & ring_ptr->mask];
+		// Read the slot before handing it back to the producer
+		__atomic_store_n(&(ring_ptr->tail), tail + 1, __ATOMIC_RELEASE);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool free_a_hThrRing(hThrRing_ptr* oldRing_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	hThrRing_ptr ring_ptr = NULL;  // Easier to deal with this way
+
+	// INPUT VALIDATION
+	if (!oldRing_ptr || !(*oldRing_ptr))
+	{
+		HARKLE_ERROR(Harklethread, free_a_hThrRing, NULL pointer);
+		retVal = false;
+	}
+	else
+	{
+		ring_ptr = *oldRing_ptr;
+
+		// 1. Slots
+		if (ring_ptr->slot_arr)
+		{
+			harkleset(ring_ptr->slot_arr, 0x0, (ring_ptr->mask + 1) * sizeof(uint64_t));
+			free(ring_ptr->slot_arr);
+		}
+
+		// 2. Ring
+		harkleset(ring_ptr, 0x0, sizeof(hThrRing));
+		free(ring_ptr);
+		*oldRing_ptr = NULL;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////// RING FUNCTIONS STOP /////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// PTHREAD FUNCTIONS START //////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -310,6 +605,749 @@ int spawn_harklethread(hThrDetails_ptr babyThread)
 }
 
 
+/*
+	PURPOSE - Register a thread's pipe with an epoll-driven pipe loop
+	INPUT
+		loop_ptr - Event loop from Harklepipe's create_pipe_loop()
+		watchThread - hThreadDetails struct pointer whose pipeReader will be watched
+		stop - Message delimiter
+		callback - Called with each message the thread writes
+		userData - Passed through to callback
+	OUTPUT
+		On success, 0
+		On failure, errno
+	NOTES
+		Wraps Harklepipe's watch_a_pipe() so the thread's messages are only read
+			once they have arrived (see: run_pipe_loop())
+ */
+int watch_harklethread(hpLoop_ptr loop_ptr, hThrDetails_ptr watchThread, char stop, \
+	                   hpMessageCallback callback, void* userData)
+{
+	// LOCAL VARIABLES
+	int retVal = 0;
+
+	// INPUT VALIDATION
+	if (!loop_ptr || !watchThread || !callback)
+	{
+		HARKLE_ERROR(Harklethread, watch_harklethread, NULL pointer);
+		retVal = EINVAL;
+	}
+	else if (!(watchThread->pipeReader))
+	{
+		HARKLE_ERROR(Harklethread, watch_harklethread, Thread has no pipe reader);
+		retVal = EINVAL;
+	}
+
+	// WATCH THE PIPE
+	if (0 == retVal)
+	{
+		retVal = watch_a_pipe(loop_ptr, watchThread->pipeReader, stop, false, callback, userData);
+
+		if (retVal)
+		{
+			HARKLE_ERROR(Harklethread, watch_harklethread, watch_a_pipe failed);
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+/*
+	PURPOSE - Send a message from a thread to the main thread
+	INPUT
+		sendThread - hThreadDetails struct pointer of the sending thread
+		message - Message to send
+	OUTPUT
+		On success, 0
+		On failure, errno (EAGAIN if the pipe or ring is full)
+	NOTES
+		HTHR_TRANSPORT_PIPE writes message as a newline-terminated decimal
+			string while holding pipeMutex
+		HTHR_TRANSPORT_RING pushes message onto ring_ptr without a lock or
+			a system call
+ */
+int send_harklethread(hThrDetails_ptr sendThread, uint64_t message)
+{
+	// LOCAL VARIABLES
+	int retVal = 0;
+	char localNum[HTHR_MESSAGE_BUFF] = { 0 };  // message as a string
+	int numBytes = 0;  // Return value from snprintf()
+	int tmpInt = 0;  // Return value from pthread_mutex_*()
+
+	// INPUT VALIDATION
+	if (!sendThread)
+	{
+		HARKLE_ERROR(Harklethread, send_harklethread, NULL pointer);
+		retVal = EINVAL;
+	}
+	// RING
+	else if (HTHR_TRANSPORT_RING == sendThread->transport)
+	{
+		if (false == push_hThrRing(sendThread->ring_ptr, message))
+		{
+			retVal = EAGAIN;
+		}
+	}
+	// PIPE
+	else
+	{
+		numBytes = snprintf(localNum, sizeof(localNum), "%" PRIu64 "\n", message);
+		tmpInt = pthread_mutex_lock(&(sendThread->pipeMutex));
+
+		if (tmpInt)
+		{
+			HARKLE_ERROR(Harklethread, send_harklethread, pthread_mutex_lock failed);
+			retVal = tmpInt;
+		}
+		else
+		{
+			retVal = write_a_pipe(sendThread->pipeFDs[HPIPE_WRITE], localNum, numBytes);
+			tmpInt = pthread_mutex_unlock(&(sendThread->pipeMutex));
+
+			if (tmpInt)
+			{
+				HARKLE_ERROR(Harklethread, send_harklethread, pthread_mutex_unlock failed);
+				retVal = tmpInt;
+			}
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+/*
+	PURPOSE - Receive the oldest message a thread has sent
+	INPUT
+		recvThread - hThreadDetails struct pointer of the sending thread
+		message - [OUT] The oldest message
+	OUTPUT
+		On success, 0
+		On failure, errno (EAGAIN if nothing has arrived)
+	NOTES
+		HTHR_TRANSPORT_PIPE reads through pipeReader, so do not mix this with
+			watch_harklethread() on the same thread
+ */
+int receive_harklethread(hThrDetails_ptr recvThread, uint64_t* message)
+{
+	// LOCAL VARIABLES
+	int retVal = 0;
+	char* pipeRead = NULL;  // Return value from read_pipe_message()
+	size_t msgLen = 0;  // Length of pipeRead
+
+	// INPUT VALIDATION
+	if (!recvThread || !message)
+	{
+		HARKLE_ERROR(Harklethread, receive_harklethread, NULL pointer);
+		retVal = EINVAL;
+	}
+	// RING
+	else if (HTHR_TRANSPORT_RING == recvThread->transport)
+	{
+		if (false == pop_hThrRing(recvThread->ring_ptr, message))
+		{
+			retVal = EAGAIN;
+		}
+	}
+	// PIPE
+	else
+	{
+		pipeRead = read_pipe_message(recvThread->pipeReader, '\n', &msgLen, &retVal);
+
+		if (pipeRead)
+		{
+			*message = strtoull(pipeRead, NULL, 10);
+			release_a_string_len(&pipeRead, msgLen + 1);
+		}
+		else if (0 == retVal)
+		{
+			retVal = EPIPE;  // The thread closed its end
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// PTHREAD FUNCTIONS STOP ///////////////////////////
 //////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////// POOL FUNCTIONS START ////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+hThrPool_ptr create_a_hThrPool(int numWorkers, bool pinWorkers)
+{
+	// LOCAL VARIABLES
+	hThrPool_ptr retVal = NULL;
+	bool success = true;  // If anything fails, make this false
+	long numCPUs = sysconf(_SC_NPROCESSORS_ONLN);  // Online CPUs
+	pthread_attr_t workerAttr;  // Worker thread attributes
+	cpu_set_t allowedCPUs;  // CPUs this process may run on
+	cpu_set_t workerCPU;  // CPU a pinned worker runs on
+	int numAllowed = 0;  // Number of CPUs in allowedCPUs
+	int cpuNum = -1;  // CPU the last pinned worker runs on
+	int tmpInt = 0;  // Return value from pthread functions
+	int numStarted = 0;  // Number of workers running
+	int i = 0;  // Iterating variable
+
+	// INPUT VALIDATION
+	if (numCPUs < 1)
+	{
+		numCPUs = 1;
+	}
+
+	if (numWorkers < 0)
+	{
+		HARKLE_ERROR(Harklethread, create_a_hThrPool, Invalid number of workers);
+		success = false;
+	}
+	else if (0 == numWorkers)
+	{
+		numWorkers = numCPUs;
+	}
+
+	if (numWorkers > HTHR_POOL_MAX_WORKERS)
+	{
+		numWorkers = HTHR_POOL_MAX_WORKERS;
+	}
+
+	// ALLOCATE
+	if (true == success)
+	{
+		retVal = calloc(1, sizeof(hThrPool));
+
+		if (retVal)
+		{
+			retVal->worker_arr = calloc(numWorkers, sizeof(hThrWorker));
+		}
+
+		if (!retVal || !(retVal->worker_arr))
+		{
+			HARKLE_ERROR(Harklethread, create_a_hThrPool, calloc failed);
+			free(retVal);
+			retVal = NULL;
+			success = false;
+		}
+	}
+
+	// INITIALIZE
+	if (true == success)
+	{
+		pthread_mutex_init(&(retVal->idleLock), NULL);
+		pthread_cond_init(&(retVal->idleCond), NULL);
+		pthread_cond_init(&(retVal->drainedCond), NULL);
+		retVal->numWorkers = numWorkers;
+
+		for (i = 0; i < numWorkers; i++)
+		{
+			retVal->worker_arr[i].workerNum = i;
+			retVal->worker_arr[i].pool_ptr = retVal;
+			pthread_mutex_init(&(retVal->worker_arr[i].lock), NULL);
+		}
+	}
+
+	// START THE WORKERS
+	if (true == success)
+	{
+		pthread_attr_init(&workerAttr);
+
+		// Only pin within the CPUs we're allowed (e.g., a restricted cpuset or taskset)
+		if (true == pinWorkers)
+		{
+			CPU_ZERO(&allowedCPUs);
+
+			if (sched_getaffinity(0, sizeof(cpu_set_t), &allowedCPUs) || 0 == (numAllowed = CPU_COUNT(&allowedCPUs)))
+			{
+				HARKLE_WARNG(Harklethread, create_a_hThrPool, Unable to read the allowed CPUs);
+				numAllowed = 0;
+			}
+		}
+
+		for (i = 0; i < numWorkers; i++)
+		{
+			if (numAllowed > 0)
+			{
+				// Worker i gets the (i % numAllowed)th allowed CPU
+				do
+				{
+					cpuNum = (cpuNum + 1) % CPU_SETSIZE;
+				} while (!CPU_ISSET(cpuNum, &allowedCPUs));
+
+				CPU_ZERO(&workerCPU);
+				CPU_SET(cpuNum, &workerCPU);
+
+				if (pthread_attr_setaffinity_np(&workerAttr, sizeof(cpu_set_t), &workerCPU))
+				{
+					HARKLE_WARNG(Harklethread, create_a_hThrPool, Unable to pin a worker);
+				}
+			}
+
+			tmpInt = pthread_create(&(retVal->worker_arr[i].threadID), &workerAttr, \
+				                    hthr_pool_worker, retVal->worker_arr + i);
+
+			if (tmpInt)
+			{
+				HARKLE_ERROR(Harklethread, create_a_hThrPool, pthread_create failed);
+				HARKLE_ERRNO(Harklethread, pthread_create, tmpInt);
+				success = false;
+				break;
+			}
+			numStarted++;
+		}
+
+		pthread_attr_destroy(&workerAttr);
+	}
+
+	// CLEAN UP
+	if (false == success && retVal)
+	{
+		// 1. Stop whichever workers did start
+		pthread_mutex_lock(&(retVal->idleLock));
+		__atomic_store_n(&(retVal->shutdown), true, __ATOMIC_RELEASE);
+		pthread_cond_broadcast(&(retVal->idleCond));
+		pthread_mutex_unlock(&(retVal->idleLock));
+
+		for (i = 0; i < numStarted; i++)
+		{
+			pthread_join(retVal->worker_arr[i].threadID, NULL);
+		}
+
+		// 2. Nothing was ever queued, so only the locks need tearing down
+		for (i = 0; i < retVal->numWorkers; i++)
+		{
+			pthread_mutex_destroy(&(retVal->worker_arr[i].lock));
+		}
+		pthread_cond_destroy(&(retVal->drainedCond));
+		pthread_cond_destroy(&(retVal->idleCond));
+		pthread_mutex_destroy(&(retVal->idleLock));
+		free(retVal->worker_arr);
+		free(retVal);
+		retVal = NULL;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+int submit_hThrTask(hThrPool_ptr pool_ptr, void* (*taskFunc) (void*), void* taskArg, \
+	                void (*callback) (void*, void*), void* userData, hThrFuture_ptr future_ptr)
+{
+	// LOCAL VARIABLES
+	int retVal = 0;
+	hThrTask newTask = { taskFunc, taskArg, callback, userData, future_ptr };  // Task to queue
+	hThrWorker_ptr worker_ptr = hthrCurrWorker;  // Deque to push to
+
+	// INPUT VALIDATION
+	if (!pool_ptr || !taskFunc)
+	{
+		HARKLE_ERROR(Harklethread, submit_hThrTask, NULL pointer);
+		retVal = EINVAL;
+	}
+	else if (true == __atomic_load_n(&(pool_ptr->shutdown), __ATOMIC_ACQUIRE))
+	{
+		HARKLE_ERROR(Harklethread, submit_hThrTask, Pool is shutting down);
+		retVal = ESHUTDOWN;
+	}
+
+	// QUEUE IT
+	if (0 == retVal)
+	{
+		// 1. Keep a worker's own tasks on its own deque, deal everyone else's out
+		if (!worker_ptr || worker_ptr->pool_ptr != pool_ptr)
+		{
+			worker_ptr = pool_ptr->worker_arr + (__atomic_fetch_add(&(pool_ptr->nextWorker), 1, \
+				                                 __ATOMIC_RELAXED) % pool_ptr->numWorkers);
+		}
+
+		// 2. Push
+		__atomic_add_fetch(&(pool_ptr->numPending), 1, __ATOMIC_ACQ_REL);
+
+		if (false == push_hThrTask(pool_ptr, worker_ptr, &newTask))
+		{
+			HARKLE_ERROR(Harklethread, submit_hThrTask, push_hThrTask failed);
+			__atomic_sub_fetch(&(pool_ptr->numPending), 1, __ATOMIC_ACQ_REL);
+			retVal = ENOMEM;
+		}
+		// 3. Only take idleLock if someone is asleep.  Pairs with the numIdle
+		//	increment in hthr_pool_worker(): either the worker sees numQueued or we see it.
+		else if (__atomic_load_n(&(pool_ptr->numIdle), __ATOMIC_SEQ_CST) > 0)
+		{
+			pthread_mutex_lock(&(pool_ptr->idleLock));
+			pthread_cond_signal(&(pool_ptr->idleCond));
+			pthread_mutex_unlock(&(pool_ptr->idleLock));
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+int submit_harklethread(hThrPool_ptr pool_ptr, hThrDetails_ptr taskThread, hThrFuture_ptr future_ptr)
+{
+	// LOCAL VARIABLES
+	int retVal = 0;
+
+	// INPUT VALIDATION
+	if (!taskThread)
+	{
+		HARKLE_ERROR(Harklethread, submit_harklethread, NULL struct pointer);
+		retVal = EINVAL;
+	}
+	else
+	{
+		retVal = submit_hThrTask(pool_ptr, taskThread->strtFunc, taskThread->tArgvString, NULL, NULL, future_ptr);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+int wait_hThrPool(hThrPool_ptr pool_ptr)
+{
+	// LOCAL VARIABLES
+	int retVal = 0;
+
+	// INPUT VALIDATION
+	if (!pool_ptr)
+	{
+		HARKLE_ERROR(Harklethread, wait_hThrPool, NULL pointer);
+		retVal = EINVAL;
+	}
+	else
+	{
+		pthread_mutex_lock(&(pool_ptr->idleLock));
+
+		while (__atomic_load_n(&(pool_ptr->numPending), __ATOMIC_ACQUIRE) > 0)
+		{
+			pthread_cond_wait(&(pool_ptr->drainedCond), &(pool_ptr->idleLock));
+		}
+
+		pthread_mutex_unlock(&(pool_ptr->idleLock));
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool free_a_hThrPool(hThrPool_ptr* oldPool_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	hThrPool_ptr pool_ptr = NULL;  // Easier to deal with this way
+	int i = 0;  // Iterating variable
+
+	// INPUT VALIDATION
+	if (!oldPool_ptr || !(*oldPool_ptr))
+	{
+		HARKLE_ERROR(Harklethread, free_a_hThrPool, NULL pointer);
+		retVal = false;
+	}
+	else
+	{
+		pool_ptr = *oldPool_ptr;
+
+		// 1. Finish what's queued
+		wait_hThrPool(pool_ptr);
+
+		// 2. Wake and stop the workers
+		pthread_mutex_lock(&(pool_ptr->idleLock));
+		__atomic_store_n(&(pool_ptr->shutdown), true, __ATOMIC_RELEASE);
+		pthread_cond_broadcast(&(pool_ptr->idleCond));
+		pthread_mutex_unlock(&(pool_ptr->idleLock));
+
+		for (i = 0; i < pool_ptr->numWorkers; i++)
+		{
+			pthread_join(pool_ptr->worker_arr[i].threadID, NULL);
+		}
+
+		// 3. Deques
+		for (i = 0; i < pool_ptr->numWorkers; i++)
+		{
+			pthread_mutex_destroy(&(pool_ptr->worker_arr[i].lock));
+			free(pool_ptr->worker_arr[i].task_arr);
+		}
+		harkleset(pool_ptr->worker_arr, 0x0, pool_ptr->numWorkers * sizeof(hThrWorker));
+		free(pool_ptr->worker_arr);
+
+		// 4. Pool
+		pthread_cond_destroy(&(pool_ptr->drainedCond));
+		pthread_cond_destroy(&(pool_ptr->idleCond));
+		pthread_mutex_destroy(&(pool_ptr->idleLock));
+		harkleset(pool_ptr, 0x0, sizeof(hThrPool));
+		free(pool_ptr);
+		*oldPool_ptr = NULL;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+hThrFuture_ptr create_a_hThrFuture(void)
+{
+	// LOCAL VARIABLES
+	hThrFuture_ptr retVal = calloc(1, sizeof(hThrFuture));
+
+	if (!retVal)
+	{
+		HARKLE_ERROR(Harklethread, create_a_hThrFuture, calloc failed);
+	}
+	else
+	{
+		pthread_mutex_init(&(retVal->lock), NULL);
+		pthread_cond_init(&(retVal->doneCond), NULL);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+void* wait_hThrFuture(hThrFuture_ptr future_ptr)
+{
+	// LOCAL VARIABLES
+	void* retVal = NULL;
+
+	// INPUT VALIDATION
+	if (!future_ptr)
+	{
+		HARKLE_ERROR(Harklethread, wait_hThrFuture, NULL pointer);
+	}
+	else
+	{
+		pthread_mutex_lock(&(future_ptr->lock));
+
+		while (false == future_ptr->done)
+		{
+			pthread_cond_wait(&(future_ptr->doneCond), &(future_ptr->lock));
+		}
+
+		retVal = future_ptr->result;
+		// Ready for the next task
+		future_ptr->done = false;
+		future_ptr->result = NULL;
+
+		pthread_mutex_unlock(&(future_ptr->lock));
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool free_a_hThrFuture(hThrFuture_ptr* oldFuture_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	hThrFuture_ptr future_ptr = NULL;  // Easier to deal with this way
+
+	// INPUT VALIDATION
+	if (!oldFuture_ptr || !(*oldFuture_ptr))
+	{
+		HARKLE_ERROR(Harklethread, free_a_hThrFuture, NULL pointer);
+		retVal = false;
+	}
+	else
+	{
+		future_ptr = *oldFuture_ptr;
+		pthread_cond_destroy(&(future_ptr->doneCond));
+		pthread_mutex_destroy(&(future_ptr->lock));
+		harkleset(future_ptr, 0x0, sizeof(hThrFuture));
+		free(future_ptr);
+		*oldFuture_ptr = NULL;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+void* hthr_pool_worker(void* worker_ptr)
+{
+	// LOCAL VARIABLES
+	hThrWorker_ptr self_ptr = (hThrWorker_ptr)worker_ptr;  // This worker
+	hThrPool_ptr pool_ptr = self_ptr->pool_ptr;  // Shared state
+	hThrTask task = { 0 };  // Task currently claimed
+	bool gotOne = false;  // true if a task was claimed
+	bool stopping = false;  // true once the pool is shutting down and drained
+	int i = 0;  // Iterating variable
+
+	// Tasks this worker submits stay on its own deque
+	hthrCurrWorker = self_ptr;
+
+	// WORK
+	while (false == stopping)
+	{
+		// 1. Newest task of our own, or the oldest of someone else's
+		gotOne = pop_hThrTask(pool_ptr, self_ptr, &task, false);
+
+		for (i = 1; false == gotOne && i < pool_ptr->numWorkers; i++)
+		{
+			gotOne = pop_hThrTask(pool_ptr, pool_ptr->worker_arr + ((self_ptr->workerNum + i) % pool_ptr->numWorkers), \
+				                  &task, true);
+		}
+
+		if (true == gotOne)
+		{
+			run_hThrTask(pool_ptr, &task);
+			continue;
+		}
+
+		// 2. Nothing anywhere, so sleep until something is submitted
+		pthread_mutex_lock(&(pool_ptr->idleLock));
+		__atomic_add_fetch(&(pool_ptr->numIdle), 1, __ATOMIC_SEQ_CST);
+
+		while (0 == __atomic_load_n(&(pool_ptr->numQueued), __ATOMIC_SEQ_CST) \
+			   && false == __atomic_load_n(&(pool_ptr->shutdown), __ATOMIC_ACQUIRE))
+		{
+			pthread_cond_wait(&(pool_ptr->idleCond), &(pool_ptr->idleLock));
+		}
+
+		__atomic_sub_fetch(&(pool_ptr->numIdle), 1, __ATOMIC_SEQ_CST);
+		stopping = __atomic_load_n(&(pool_ptr->shutdown), __ATOMIC_ACQUIRE) \
+			       && 0 == __atomic_load_n(&(pool_ptr->numQueued), __ATOMIC_SEQ_CST);
+		pthread_mutex_unlock(&(pool_ptr->idleLock));
+	}
+
+	// DONE
+	hthrCurrWorker = NULL;
+	return NULL;
+}
+
+
+bool push_hThrTask(hThrPool_ptr pool_ptr, hThrWorker_ptr worker_ptr, hThrTask_ptr task_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	hThrTask_ptr temp_ptr = NULL;  // Return value from realloc()
+	size_t newLen = 0;  // New number of tasks task_arr can hold
+
+	pthread_mutex_lock(&(worker_ptr->lock));
+
+	// 1. Make room
+	if (worker_ptr->bottom == worker_ptr->arrLen)
+	{
+		if (worker_ptr->top > 0)
+		{
+			// Slide the live tasks back to the start
+			memmove(worker_ptr->task_arr, worker_ptr->task_arr + worker_ptr->top, \
+				    (worker_ptr->bottom - worker_ptr->top) * sizeof(hThrTask));
+			worker_ptr->bottom -= worker_ptr->top;
+			worker_ptr->top = 0;
+		}
+
+		if (worker_ptr->bottom == worker_ptr->arrLen)
+		{
+			newLen = worker_ptr->arrLen ? worker_ptr->arrLen * 2 : HTHR_DEQUE_LEN;
+			temp_ptr = realloc(worker_ptr->task_arr, newLen * sizeof(hThrTask));
+
+			if (temp_ptr)
+			{
+				worker_ptr->task_arr = temp_ptr;
+				worker_ptr->arrLen = newLen;
+			}
+			else
+			{
+				retVal = false;
+			}
+		}
+	}
+
+	// 2. Push
+	if (true == retVal)
+	{
+		__atomic_add_fetch(&(pool_ptr->numQueued), 1, __ATOMIC_SEQ_CST);
+		worker_ptr->task_arr[worker_ptr->bottom++] = *task_ptr;
+	}
+
+	pthread_mutex_unlock(&(worker_ptr->lock));
+
+	// DONE
+	return retVal;
+}
+
+
+bool pop_hThrTask(hThrPool_ptr pool_ptr, hThrWorker_ptr worker_ptr, hThrTask_ptr task_ptr, bool steal)
+{
+	// LOCAL VARIABLES
+	bool retVal = false;
+
+	pthread_mutex_lock(&(worker_ptr->lock));
+
+	if (worker_ptr->top < worker_ptr->bottom)
+	{
+		if (true == steal)
+		{
+			*task_ptr = worker_ptr->task_arr[worker_ptr->top++];
+		}
+		else
+		{
+			*task_ptr = worker_ptr->task_arr[--(worker_ptr->bottom)];
+		}
+		__atomic_sub_fetch(&(pool_ptr->numQueued), 1, __ATOMIC_SEQ_CST);
+		retVal = true;
+
+		if (worker_ptr->top == worker_ptr->bottom)
+		{
+			worker_ptr->top = 0;
+			worker_ptr->bottom = 0;
+		}
+	}
+
+	pthread_mutex_unlock(&(worker_ptr->lock));
+
+	// DONE
+	return retVal;
+}
+
+
+void run_hThrTask(hThrPool_ptr pool_ptr, hThrTask_ptr task_ptr)
+{
+	// LOCAL VARIABLES
+	void* result = NULL;  // Return value from taskFunc
+
+	// 1. Run it
+	result = task_ptr->taskFunc(task_ptr->taskArg);
+
+	// 2. Completion callback
+	if (task_ptr->callback)
+	{
+		task_ptr->callback(result, task_ptr->userData);
+	}
+
+	// 3. Future
+	if (task_ptr->future_ptr)
+	{
+		pthread_mutex_lock(&(task_ptr->future_ptr->lock));
+		task_ptr->future_ptr->result = result;
+		task_ptr->future_ptr->done = true;
+		pthread_cond_broadcast(&(task_ptr->future_ptr->doneCond));
+		pthread_mutex_unlock(&(task_ptr->future_ptr->lock));
+	}
+
+	// 4. Last one out wakes wait_hThrPool()
+	if (0 == __atomic_sub_fetch(&(pool_ptr->numPending), 1, __ATOMIC_ACQ_REL))
+	{
+		pthread_mutex_lock(&(pool_ptr->idleLock));
+		pthread_cond_broadcast(&(pool_ptr->drainedCond));
+		pthread_mutex_unlock(&(pool_ptr->idleLock));
+	}
+
+	return;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////// POOL FUNCTIONS STOP /////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
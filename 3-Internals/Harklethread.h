@@ -1,8 +1,31 @@
 #ifndef __HARKLETHREAD__
 #define __HARKLETHREAD__
 
+#include "Harklepipe.h"			// hpReader_ptr
 #include <pthread.h>
 #include <stdbool.h>			// bool, true, false
+#include <stdint.h>				// uint64_t
+
+#define HTHR_TRANSPORT_PIPE 0	// Thread messages travel through pipeFDs
+#define HTHR_TRANSPORT_RING 1	// Thread messages travel through an in-process hThrRing
+
+#ifndef HTHR_CACHE_LINE
+// MACRO to keep the producer's and consumer's halves of a hThrRing from sharing a cache line
+#define HTHR_CACHE_LINE 64
+#endif  // HTHR_CACHE_LINE
+
+typedef struct hThreadRing
+{
+	// Producer's cache line
+	size_t head __attribute__((aligned(HTHR_CACHE_LINE)));	// Next slot to write, only the producer stores it
+	size_t tailCache;					// Producer's last look at tail
+	// Consumer's cache line
+	size_t tail __attribute__((aligned(HTHR_CACHE_LINE)));	// Next slot to read, only the consumer stores it
+	size_t headCache;					// Consumer's last look at head
+	// Read-only after create_a_hThrRing()
+	size_t mask __attribute__((aligned(HTHR_CACHE_LINE)));	// Number of slots - 1
+	uint64_t* slot_arr;					// Messages
+} hThrRing, *hThrRing_ptr;
 
 typedef struct hThreadDetails
 {
@@ -16,8 +39,56 @@ typedef struct hThreadDetails
 	pthread_mutex_t pipeMutex; 			// Thread's pipe mutex
 	pthread_mutexattr_t pipeMutexAttr;	// Attributes for thread's pipe mutex
 	int pipeFDs[2];						// Pipe used to send data from the thread to the main thread
+	hpReader_ptr pipeReader;			// Buffered reader for pipeFDs[HPIPE_READ]
+	int transport;						// HTHR_TRANSPORT_PIPE or HTHR_TRANSPORT_RING
+	hThrRing_ptr ring_ptr;				// Single-producer/single-consumer ring for HTHR_TRANSPORT_RING
 } hThrDetails, *hThrDetails_ptr;
 
+typedef struct hThreadFuture
+{
+	pthread_mutex_t lock;				// Guards done
+	pthread_cond_t doneCond;			// Signaled once done is true
+	bool done;							// true once result is set
+	void* result;						// Task's return value
+} hThrFuture, *hThrFuture_ptr;
+
+// A unit of work for a hThrPool
+typedef struct hThreadTask
+{
+	void*(*taskFunc)(void*);			// Task to run
+	void* taskArg;						// Passed to taskFunc
+	void (*callback)(void*, void*);		// Optional. Called with (result, userData) once taskFunc returns
+	void* userData;						// Passed through to callback
+	hThrFuture_ptr future_ptr;			// Optional. Receives taskFunc's return value.
+} hThrTask, *hThrTask_ptr;
+
+// One hThrPool worker: the owner uses the bottom of its deque, thieves the top
+typedef struct hThreadWorker
+{
+	pthread_t threadID;					// ID returned by pthread_create()
+	int workerNum;						// Index into the pool's worker_arr
+	struct hThreadPool* pool_ptr;		// Pool this worker belongs to
+	pthread_mutex_t lock;				// Guards everything below
+	hThrTask_ptr task_arr;				// Tasks [top, bottom) are queued
+	size_t top;							// Oldest task (stolen first)
+	size_t bottom;						// One past the newest task (popped first)
+	size_t arrLen;						// Number of tasks task_arr can hold
+} hThrWorker, *hThrWorker_ptr;
+
+typedef struct hThreadPool
+{
+	hThrWorker_ptr worker_arr;			// One worker per thread
+	int numWorkers;						// Number of entries in worker_arr
+	pthread_mutex_t idleLock;			// Guards sleeping on idleCond and drainedCond
+	pthread_cond_t idleCond;			// Idle workers wait here for a task
+	pthread_cond_t drainedCond;			// wait_hThrPool() waits here for numPending to reach 0
+	size_t numQueued;					// Tasks sitting in a deque (atomic)
+	size_t numPending;					// Tasks submitted but not finished (atomic)
+	int numIdle;						// Workers waiting on idleCond (atomic)
+	unsigned int nextWorker;			// Round-robin deque for tasks from outside the pool (atomic)
+	bool shutdown;						// Set by free_a_hThrPool() (atomic)
+} hThrPool, *hThrPool_ptr;
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// STRUCT FUNCTIONS START ///////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -33,11 +104,14 @@ typedef struct hThreadDetails
 		argSize - The number of bytes to allocate in order to copy arg into
 			a buffer 'owned' by this new struct.  Ensure argSize is large
 			enough to account for any nul/NULL termination include in arg.
+		transport - HTHR_TRANSPORT_PIPE or HTHR_TRANSPORT_RING
 	NOTES
 		This function calls:
 			Memoroad's copy_a_string() it threadName is not NULL
 			allocate_a_hThrDetails_ptr() to allocate heap memory
-			Harklepipe's make_a_pipe() to initialize pipeFDs
+			Harklepipe's make_a_pipe() to initialize pipeFDs (HTHR_TRANSPORT_PIPE)
+			Harklepipe's create_pipe_reader() to initialize pipeReader (HTHR_TRANSPORT_PIPE)
+			create_a_hThrRing() to initialize ring_ptr (HTHR_TRANSPORT_RING)
 			_____() to initialize the mutex
 		This function does NOT call pthread_create().  The caller should:
 			pthread_create(&(self->threadID), NULL, start_routine, argvString);
@@ -50,7 +124,8 @@ hThrDetails_ptr create_a_hThrDetails_ptr(char* threadName, \
 	                                     int threadNum, \
 	                                     void* (*start_routine) (void*), \
 	                                     void* arg, \
-	                                     size_t argSize);
+	                                     size_t argSize, \
+	                                     int transport);
 
 
 /*
@@ -83,6 +158,9 @@ hThrDetails_ptr allocate_a_hThrDetails_ptr(void);
 			pipeMutex
 			pipeMutexAttr
 			pipeFDs
+			pipeReader
+			transport
+			ring_ptr
 		This function will not close() any FDs that may remain in pipeFDs
 		The variable pointed at by oldStruct_ptr will be assigned NULL
  */
@@ -93,6 +171,72 @@ bool free_a_hThrDetails_ptr(hThrDetails_ptr* oldStruct_ptr);
 /////////////////////////// STRUCT FUNCTIONS STOP ////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////// RING FUNCTIONS START ////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+/*
+	PURPOSE - Allocate a lock-free single-producer/single-consumer ring
+	INPUT
+		numSlots - Minimum number of messages the ring can hold, rounded up
+			to a power of 2 (0 for HTHR_RING_SLOTS)
+	OUTPUT
+		On success, a heap-allocated, cache-line aligned hThrRing struct pointer
+		On failure, NULL
+	NOTES
+		It is the caller's responsibility to call free_a_hThrRing()
+ */
+hThrRing_ptr create_a_hThrRing(size_t numSlots);
+
+
+/*
+	PURPOSE - Add a message to a ring
+	INPUT
+		ring_ptr - Ring to add to
+		message - Message to add
+	OUTPUT
+		On success, true
+		If the ring is full, false
+	NOTES
+		Only one thread (the producer) may ever call this for a given ring
+		The producer only loads tail, with acquire, when its cached copy
+			says the ring is full
+ */
+bool push_hThrRing(hThrRing_ptr ring_ptr, uint64_t message);
+
+
+/*
+	PURPOSE - Remove the oldest message from a ring
+	INPUT
+		ring_ptr - Ring to remove from
+		message - [OUT] The oldest message
+	OUTPUT
+		On success, true
+		If the ring is empty, false
+	NOTES
+		Only one thread (the consumer) may ever call this for a given ring
+ */
+bool pop_hThrRing(hThrRing_ptr ring_ptr, uint64_t* message);
+
+
+/*
+	PURPOSE - Zeroize, free, and NULL a ring
+	INPUT
+		oldRing_ptr - A pointer to a hThrRing_ptr
+	OUTPUT
+		On success, true
+		On failure, false
+	NOTES
+		*oldRing_ptr will be assigned NULL
+ */
+bool free_a_hThrRing(hThrRing_ptr* oldRing_ptr);
+
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////// RING FUNCTIONS STOP /////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// PTHREAD FUNCTIONS START //////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -110,8 +254,190 @@ bool free_a_hThrDetails_ptr(hThrDetails_ptr* oldStruct_ptr);
 int spawn_harklethread(hThrDetails_ptr babyThread);
 
 
+/*
+	PURPOSE - Register a thread's pipe with an epoll-driven pipe loop
+	INPUT
+		loop_ptr - Event loop from Harklepipe's create_pipe_loop()
+		watchThread - hThreadDetails struct pointer whose pipeReader will be watched
+		stop - Message delimiter
+		callback - Called with each message the thread writes
+		userData - Passed through to callback
+	OUTPUT
+		On success, 0
+		On failure, errno
+	NOTES
+		Wraps Harklepipe's watch_a_pipe() so the thread's messages are only read
+			once they have arrived (see: run_pipe_loop())
+ */
+int watch_harklethread(hpLoop_ptr loop_ptr, hThrDetails_ptr watchThread, char stop, \
+	                   hpMessageCallback callback, void* userData);
+
+
+/*
+	PURPOSE - Send a message from a thread to the main thread
+	INPUT
+		sendThread - hThreadDetails struct pointer of the sending thread
+		message - Message to send
+	OUTPUT
+		On success, 0
+		On failure, errno (EAGAIN if the pipe or ring is full)
+	NOTES
+		HTHR_TRANSPORT_PIPE writes message as a newline-terminated decimal
+			string while holding pipeMutex
+		HTHR_TRANSPORT_RING pushes message onto ring_ptr without a lock or
+			a system call
+ */
+int send_harklethread(hThrDetails_ptr sendThread, uint64_t message);
+
+
+/*
+	PURPOSE - Receive the oldest message a thread has sent
+	INPUT
+		recvThread - hThreadDetails struct pointer of the sending thread
+		message - [OUT] The oldest message
+	OUTPUT
+		On success, 0
+		On failure, errno (EAGAIN if nothing has arrived)
+	NOTES
+		HTHR_TRANSPORT_PIPE reads through pipeReader, so do not mix this with
+			watch_harklethread() on the same thread
+ */
+int receive_harklethread(hThrDetails_ptr recvThread, uint64_t* message);
+
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// PTHREAD FUNCTIONS STOP ///////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////// POOL FUNCTIONS START ////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+/*
+	PURPOSE - Start a fixed-size pool of worker threads
+	INPUT
+		numWorkers - Number of worker threads, 0 for one-per-CPU
+		pinWorkers - If true, worker n is pinned to the nth CPU this process may
+			run on (modulo the number of them, see: sched_getaffinity())
+	OUTPUT
+		On success, a heap-allocated hThreadPool struct pointer
+		On failure, NULL
+	NOTES
+		Each worker owns a deque.  Workers run their own newest task first and,
+			when their deque is empty, steal the oldest task from another worker.
+		Idle workers sleep on a condition variable instead of spinning
+		It is the caller's responsibility to call free_a_hThrPool()
+ */
+hThrPool_ptr create_a_hThrPool(int numWorkers, bool pinWorkers);
+
+
+/*
+	PURPOSE - Queue a task on a pool
+	INPUT
+		pool_ptr - Pool to run the task
+		taskFunc - Task to run
+		taskArg - Passed to taskFunc
+		callback [optional] - Called, on the worker, with taskFunc's return
+			value and userData once taskFunc returns
+		userData - Passed through to callback
+		future_ptr [optional] - From create_a_hThrFuture().  Receives
+			taskFunc's return value.
+	OUTPUT
+		On success, 0
+		On failure, errno
+	NOTES
+		Tasks submitted from one of the pool's own workers go on that worker's
+			deque; all others are dealt round-robin
+ */
+int submit_hThrTask(hThrPool_ptr pool_ptr, void* (*taskFunc) (void*), void* taskArg, \
+	                void (*callback) (void*, void*), void* userData, hThrFuture_ptr future_ptr);
+
+
+/*
+	PURPOSE - Run a hThreadDetails struct's start routine on a pool instead of
+		its own thread
+	INPUT
+		pool_ptr - Pool to run the start routine
+		taskThread - hThreadDetails struct pointer with strtFunc and tArgvString
+		future_ptr [optional] - Receives strtFunc's return value
+	OUTPUT
+		On success, 0
+		On failure, errno
+	NOTES
+		Use this in place of spawn_harklethread().  threadID and tAttr are not used.
+ */
+int submit_harklethread(hThrPool_ptr pool_ptr, hThrDetails_ptr taskThread, hThrFuture_ptr future_ptr);
+
+
+/*
+	PURPOSE - Block until every task submitted to a pool has finished
+	INPUT
+		pool_ptr - Pool to wait on
+	OUTPUT
+		On success, 0
+		On failure, errno
+	NOTES
+		Do not call this from one of the pool's own tasks
+ */
+int wait_hThrPool(hThrPool_ptr pool_ptr);
+
+
+/*
+	PURPOSE - Finish the queued tasks, stop the workers, and free a pool
+	INPUT
+		oldPool_ptr - A pointer to a hThrPool_ptr
+	OUTPUT
+		On success, true
+		On failure, false
+	NOTES
+		*oldPool_ptr will be assigned NULL
+ */
+bool free_a_hThrPool(hThrPool_ptr* oldPool_ptr);
+
+
+/*
+	PURPOSE - Allocate a future for submit_hThrTask()
+	INPUT - None
+	OUTPUT
+		On success, a heap-allocated hThreadFuture struct pointer
+		On failure, NULL
+	NOTES
+		A future may be reused once it has been waited on, but it only
+			tracks one task at a time
+		It is the caller's responsibility to call free_a_hThrFuture()
+ */
+hThrFuture_ptr create_a_hThrFuture(void);
+
+
+/*
+	PURPOSE - Block until a future's task has finished
+	INPUT
+		future_ptr - Future given to submit_hThrTask()
+	OUTPUT
+		The task's return value (NULL on failure)
+	NOTES
+		Resets the future so it can be given to another task
+ */
+void* wait_hThrFuture(hThrFuture_ptr future_ptr);
+
+
+/*
+	PURPOSE - Zeroize, free, and NULL a future
+	INPUT
+		oldFuture_ptr - A pointer to a hThrFuture_ptr
+	OUTPUT
+		On success, true
+		On failure, false
+	NOTES
+		Do not free a future whose task has not finished
+		*oldFuture_ptr will be assigned NULL
+ */
+bool free_a_hThrFuture(hThrFuture_ptr* oldFuture_ptr);
+
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////// POOL FUNCTIONS STOP /////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
 #endif  // __HARKLETHREAD__
@@ -1,19 +1,84 @@
 #include <errno.h>								// errno
+#include <fcntl.h>								// open()
 #include "Harklerror.h"							// HARKLE_ERROR, HARKLE_ERRNO, HARKLE_WARNG
-#include "Memoroad.h"							// get_me_memory()
+#include "Harkletrace.h"
+#include "Memoroad.h"							// get_me_memory(), copy_remote_to_local_vec(), mem_hunt(), get_thread_count()
+#include <pthread.h>							// pthread_create(), pthread_join()
 #include <stdbool.h>							// bool, true, false
+#include <stdint.h>								// uintptr_t, SIZE_MAX
+#include <stdio.h>								// snprintf()
+#include <stdlib.h>								// malloc(), free()
+#include <string.h>								// memcpy()
 #include <sys/ptrace.h>							// ptrace()
 #include <sys/types.h>							// pid_t
+#include <sys/uio.h>							// struct iovec
+#include <unistd.h>								// pread(), close()
+
+#ifndef HTRACE_PROC_PATH_LEN
+// MACRO defining the buffer size for "/proc/<PID>/mem"
+#define HTRACE_PROC_PATH_LEN 32
+#endif  // HTRACE_PROC_PATH_LEN
+
+#ifndef HTRACE_HUNT_CHUNK
+// MACRO defining the default number of remote bytes pid_mem_hunt() reads per chunk
+#define HTRACE_HUNT_CHUNK (1024 * 1024)
+#endif  // HTRACE_HUNT_CHUNK
+
+#ifndef HTRACE_HUNT_MAX_THREADS
+// MACRO defining the most worker threads pid_mem_hunt() will start
+#define HTRACE_HUNT_MAX_THREADS 8
+#endif  // HTRACE_HUNT_MAX_THREADS
+
+
+// State shared between pid_mem_hunt_chunked() and its worker threads
+typedef struct htraceHuntDetails
+{
+	pid_t pid;  // Remote process
+	uintptr_t haystack;  // Remote address of the haystack
+	void* needle_ptr;  // Local needle
+	size_t haystackLen;  // Size of the remote haystack
+	size_t needleLen;  // Size of the needle
+	size_t chunkSize;  // Haystack bytes 'owned' by each chunk
+	size_t numChunks;  // Number of chunks in the haystack
+	size_t nextChunk;  // Next chunk to claim (atomic)
+	size_t bestOffset;  // Lowest match offset found so far, SIZE_MAX if none (atomic)
+	bool* failed_arr;  // Per chunk: true if a worker thread could not read it
+} htHunt, *htHunt_ptr;
+
+
+/*
+	Purpose - Read and search a single pid_mem_hunt_chunked() chunk
+	Input
+		hunt_ptr - Shared hunt state
+		chunkNum - Chunk to search
+		buff_ptr - Local buffer of at least chunkSize + needleLen - 1 bytes
+	Output - 0 on success (match or not), otherwise the errno from htrace_read_into()
+	Notes:
+		Each chunk reads needleLen - 1 bytes past its end so matches that straddle
+			two chunks are found by the earlier chunk
+		A match updates hunt_ptr->bestOffset if it is the lowest so far
+ */
+int htrace_hunt_chunk(htHunt_ptr hunt_ptr, size_t chunkNum, unsigned char* buff_ptr);
+
+
+/*
+	Purpose - pid_mem_hunt_chunked() worker thread start routine
+	Input - An htHunt_ptr
+	Output - NULL
+	Notes:
+		Claims chunks in ascending order until they run out or a match has been
+			found at a lower offset than the next chunk starts
+		Chunks that fail to read are flagged for the calling thread to retry since
+			only the tracer thread may use the ptrace() fallback
+ */
+void* htrace_hunt_worker(void* hunt_ptr);
 
 
 void* htrace_read_data(pid_t pid, void* src_ptr, size_t srcLen, int* errNum)
 {
 	// LOCAL VARIABLES
 	void* retVal = NULL;
-	void* tmp_ptr = NULL;  // Return value from string.h function calls
 	bool success = true;
-	size_t i = 0;  // Iterating variable
-	long ptRetVal = 0;  // Store the ptrace() return value here
 	
 	// INPUT VALIDATION
 	if (!errNum)
@@ -44,17 +109,6 @@ void* htrace_read_data(pid_t pid, void* src_ptr, size_t srcLen, int* errNum)
 			success = false;
 			*errNum = EINVAL;
 		}
-		
-		// Warnings
-		if (srcLen % sizeof(void*))
-		{
-			HARKLE_WARNG(Harkletrace, htrace_read_data, The length of the 'blob' is not word-aligned);  // DEBUGGING
-		}
-		
-		if (sizeof(void*) != sizeof(ptRetVal))
-		{
-			HARKLE_WARNG(Harkletrace, htrace_read_data, Size mismatch between a void* and a 'word');  // DEBUGGING
-		}
 	}
 	
 	// ALLOCATE MEMORY
@@ -79,35 +133,17 @@ void* htrace_read_data(pid_t pid, void* src_ptr, size_t srcLen, int* errNum)
 		}
 	}
 	
-	// LOOP PTRACE
+	// READ IT
 	if (true == success)
 	{
-		for (i = 0; i < (srcLen - sizeof(void*)); i++)  // Errors reading from the last 8 bytes?!
+		*errNum = htrace_read_into(pid, src_ptr, retVal, srcLen);
+
+		if (*errNum)
 		{
-			ptRetVal = ptrace(PTRACE_PEEKDATA, pid, src_ptr + i, NULL);
-			
-			if (ptRetVal == -1)
-			{
-				*errNum = errno;
-				HARKLE_ERROR(Harkletrace, htrace_read_data, ptrace failed);
-				HARKLE_ERRNO(Harkletrace, ptrace, *errNum);
-				success = false;
-				break;
-			}
-			else
-			{
-				tmp_ptr = memcpy(retVal + i, &ptRetVal, sizeof(ptRetVal));
-				
-				if (tmp_ptr != retVal + i)
-				{
-					*errNum = errno;
-					HARKLE_ERROR(Harkletrace, htrace_read_data, memcpy failed);
-					HARKLE_ERRNO(Harkletrace, memcpy, *errNum);
-					success = false;
-					break;
-				}
-			}
-		}		
+			HARKLE_ERROR(Harkletrace, htrace_read_data, htrace_read_into failed);
+			HARKLE_ERRNO(Harkletrace, htrace_read_into, *errNum);
+			success = false;
+		}
 	}
 	
 	// CLEAN UP
@@ -128,6 +164,125 @@ void* htrace_read_data(pid_t pid, void* src_ptr, size_t srcLen, int* errNum)
 }
 
 
+int htrace_read_into(pid_t pid, void* src_ptr, void* dest_ptr, size_t srcLen)
+{
+	// LOCAL VARIABLES
+	int retVal = 0;
+	struct iovec locMem[1];  // Local buffer for process_vm_readv()
+	struct iovec remMem[1];  // Remote range for process_vm_readv()
+	size_t numRead = 0;  // Number of bytes read by the current method
+	char memPath[HTRACE_PROC_PATH_LEN + 1] = { 0 };  // /proc/<PID>/mem
+	int memFD = -1;  // File descriptor for /proc/<PID>/mem
+	ssize_t preadRetVal = 0;  // Return value from pread()
+	uintptr_t currAddr = 0;  // Aligned address of the current word
+	uintptr_t startAddr = (uintptr_t)src_ptr;  // First address to read
+	uintptr_t stopAddr = startAddr + srcLen;  // One past the last address to read
+	size_t copyOffset = 0;  // Offset into the current word to start copying from
+	size_t copyLen = 0;  // Number of bytes to copy from the current word
+	long ptRetVal = 0;  // Store the ptrace() return value here
+	bool done = false;  // Set to true once a read method succeeds
+	
+	// INPUT VALIDATION
+	if (pid < 1)
+	{
+		HARKLE_ERROR(Harkletrace, htrace_read_into, Invalid PID);
+		retVal = EINVAL;
+	}
+	else if (!src_ptr || !dest_ptr)
+	{
+		HARKLE_ERROR(Harkletrace, htrace_read_into, NULL pointer);
+		retVal = EINVAL;
+	}
+	else if (srcLen < 1)
+	{
+		HARKLE_ERROR(Harkletrace, htrace_read_into, Invalid length);
+		retVal = EINVAL;
+	}
+	
+	// 1. PROCESS_VM_READV
+	if (0 == retVal)
+	{
+		locMem[0].iov_base = dest_ptr;
+		locMem[0].iov_len = srcLen;
+		remMem[0].iov_base = src_ptr;
+		remMem[0].iov_len = srcLen;
+
+		retVal = copy_remote_to_local_vec(pid, locMem, remMem, 1, &numRead);
+
+		if (0 == retVal && numRead == srcLen)
+		{
+			done = true;
+		}
+		retVal = 0;
+	}
+
+	// 2. /PROC/<PID>/MEM
+	if (0 == retVal && false == done)
+	{
+		snprintf(memPath, sizeof(memPath), "/proc/%d/mem", pid);
+		memFD = open(memPath, O_RDONLY | O_CLOEXEC);
+
+		if (memFD > -1)
+		{
+			numRead = 0;
+
+			while (numRead < srcLen)
+			{
+				preadRetVal = pread(memFD, dest_ptr + numRead, srcLen - numRead, (off_t)(startAddr + numRead));
+
+				if (preadRetVal < 1)
+				{
+					break;
+				}
+				numRead += preadRetVal;
+			}
+			close(memFD);
+			memFD = -1;
+
+			if (numRead == srcLen)
+			{
+				done = true;
+			}
+		}
+	}
+
+	// 3. PTRACE ONE ALIGNED WORD AT A TIME
+	if (0 == retVal && false == done)
+	{
+		currAddr = startAddr - (startAddr % sizeof(long));
+
+		while (currAddr < stopAddr)
+		{
+			errno = 0;  // -1 is a valid 'word' so errno is the only indicator of failure
+			ptRetVal = ptrace(PTRACE_PEEKDATA, pid, (void*)currAddr, NULL);
+			
+			if (ptRetVal == -1 && errno)
+			{
+				retVal = errno;
+				HARKLE_ERROR(Harkletrace, htrace_read_into, ptrace failed);
+				HARKLE_ERRNO(Harkletrace, ptrace, retVal);
+				break;
+			}
+
+			// Copy the overlap between this word and [startAddr, stopAddr)
+			copyOffset = (currAddr < startAddr) ? (startAddr - currAddr) : 0;
+			copyLen = sizeof(long) - copyOffset;
+
+			if (currAddr + copyOffset + copyLen > stopAddr)
+			{
+				copyLen = stopAddr - (currAddr + copyOffset);
+			}
+			memcpy(dest_ptr + (currAddr + copyOffset - startAddr), ((char*)&ptRetVal) + copyOffset, copyLen);
+
+			currAddr += sizeof(long);
+		}
+	}
+		
+	// DONE
+	return retVal;
+}
+
+
 int htrace_write_data(pid_t pid, void* dest_ptr, void* src_ptr, size_t srcLen)
 {
 	// LOCAL VARIABLES
@@ -229,89 +384,217 @@ int htrace_write_data(pid_t pid, void* dest_ptr, void* src_ptr, size_t srcLen)
 
 
 size_t pid_mem_hunt(pid_t pid, void* haystack_ptr, void* needle_ptr, size_t haystackLen, size_t needleLen)
+{
+	return pid_mem_hunt_chunked(pid, haystack_ptr, needle_ptr, haystackLen, needleLen, HTRACE_HUNT_CHUNK, 0);
+}
+
+
+size_t pid_mem_hunt_chunked(pid_t pid, void* haystack_ptr, void* needle_ptr, size_t haystackLen, size_t needleLen, \
+	                        size_t chunkSize, int numThreads)
 {
 	// LOCAL VARIABLES
 	size_t retVal = -1;
 	bool success = true;  // Make this false if anything fails
-	// void* tempRetVal = NULL;  // Store string.h function calls here
+	htHunt hunt = { 0 };  // State shared with the worker threads
+	pthread_t threadIDs[HTRACE_HUNT_MAX_THREADS];  // Worker threads
+	size_t numWorkers = 0;  // Number of worker threads to search with
+	size_t numStarted = 0;  // Number of worker threads actually started
+	unsigned char* buff_ptr = NULL;  // This thread's chunk buffer
 	size_t i = 0;  // Iterating variable
-	void* pidHaystack_ptr = NULL;  // Read the PID's memory here
 	int errNum = 0;  // Store errnos here
 	
 	// INPUT VALIDATION
 	if (pid < 1)
 	{
-		HARKLE_ERROR(Harkletrace, pid_mem_hunt, Invalid PID);
+		HARKLE_ERROR(Harkletrace, pid_mem_hunt_chunked, Invalid PID);
 		success = false;
 	}
 	else if (!haystack_ptr || !needle_ptr)
 	{
-		HARKLE_ERROR(Harkletrace, pid_mem_hunt, NULL pointer);
+		HARKLE_ERROR(Harkletrace, pid_mem_hunt_chunked, NULL pointer);
 		success = false;
 	}
 	else if (haystackLen < 1 || needleLen < 1 || needleLen > haystackLen)
 	{
-		HARKLE_ERROR(Harkletrace, pid_mem_hunt, Invalid length);
+		HARKLE_ERROR(Harkletrace, pid_mem_hunt_chunked, Invalid length);
+		success = false;
+	}
+	else if (chunkSize < 1)
+	{
+		HARKLE_ERROR(Harkletrace, pid_mem_hunt_chunked, Invalid chunk size);
 		success = false;
 	}
 
-	// READ HAYSTACK LOCALLY
+	// PREPARE
 	if (true == success)
 	{
-		pidHaystack_ptr = htrace_read_data(pid, haystack_ptr, haystackLen, &errNum);
+		hunt.pid = pid;
+		hunt.haystack = (uintptr_t)haystack_ptr;
+		hunt.needle_ptr = needle_ptr;
+		hunt.haystackLen = haystackLen;
+		hunt.needleLen = needleLen;
+		hunt.chunkSize = chunkSize;
+		hunt.numChunks = (haystackLen + chunkSize - 1) / chunkSize;
+		hunt.nextChunk = 0;
+		hunt.bestOffset = SIZE_MAX;
 
-		if (!pidHaystack_ptr && errNum)
+		// Thread count
+		numWorkers = get_thread_count(numThreads, HTRACE_HUNT_MAX_THREADS, hunt.numChunks, 1);
+
+		hunt.failed_arr = get_me_memory(hunt.numChunks * sizeof(bool));
+		buff_ptr = malloc(chunkSize + needleLen - 1);
+
+		if (!hunt.failed_arr || !buff_ptr)
 		{
-			HARKLE_ERROR(Harkletrace, pid_mem_hunt, htrace_read_data failed);
-			HARKLE_ERRNO(Harkletrace, htrace_read_data, errNum);
+			HARKLE_ERROR(Harkletrace, pid_mem_hunt_chunked, Allocation failed);
 			success = false;
 			retVal = -2;
 		}
-		else if (pidHaystack_ptr && !errNum)
+	}
+
+	// SEARCH IN PARALLEL
+	if (true == success && numWorkers > 1)
+	{
+		for (numStarted = 0; numStarted < numWorkers; numStarted++)
 		{
-			if (haystack_ptr > pidHaystack_ptr)
-			{
-				HARKLE_ERROR(Harkletrace, pid_mem_hunt, htrace_read_data failed out of bounds);
-				HARKLE_ERRNO(Harkletrace, htrace_read_data, errNum);
-				success = false;
-			retVal = -2;
-			}
-			else
+			errNum = pthread_create(&(threadIDs[numStarted]), NULL, htrace_hunt_worker, &hunt);
+
+			if (errNum)
 			{
-				retVal = pidHaystack_ptr - haystack_ptr;
+				HARKLE_ERROR(Harkletrace, pid_mem_hunt_chunked, pthread_create failed);
+				HARKLE_ERRNO(Harkletrace, pthread_create, errNum);
+				break;  // The chunks will still get searched below
 			}
 		}
-		else  // How did we get here?!
+
+		for (i = 0; i < numStarted; i++)
 		{
-			HARKLE_ERROR(Harkletrace, pid_mem_hunt, Haystack logic failed);
-			HARKLE_ERRNO(Harkletrace, htrace_read_data, errNum);
-			success = false;
-			retVal = -2;
+			pthread_join(threadIDs[i], NULL);
 		}
 	}
 
-	// FIND IT
+	// SEARCH WHAT'S LEFT (UNCLAIMED OR FAILED CHUNKS) FROM THIS THREAD
 	if (true == success)
 	{
-		for (i = 0; i <= (haystackLen - needleLen); i++)
+		for (i = 0; i < hunt.numChunks; i++)
 		{
-			if (0 == memcmp(pidHaystack_ptr + i, needle_ptr, needleLen))
+			if (i * chunkSize >= hunt.bestOffset)
 			{
-				retVal = i;
-				break;
+				break;  // Nothing after this can beat the match we have
+			}
+			else if (i >= hunt.nextChunk || true == hunt.failed_arr[i])
+			{
+				errNum = htrace_hunt_chunk(&hunt, i, buff_ptr);
+
+				if (errNum)
+				{
+					HARKLE_ERROR(Harkletrace, pid_mem_hunt_chunked, htrace_hunt_chunk failed);
+					HARKLE_ERRNO(Harkletrace, htrace_hunt_chunk, errNum);
+					success = false;
+					retVal = -2;
+					break;
+				}
 			}
 		}
 	}
 
+	// RESULTS
+	if (true == success && SIZE_MAX != hunt.bestOffset)
+	{
+		retVal = hunt.bestOffset;
+	}
+
 	// CLEAN UP
-	if (pidHaystack_ptr)
+	if (buff_ptr)
+	{
+		free(buff_ptr);
+	}
+
+	if (hunt.failed_arr)
+	{
+		free(hunt.failed_arr);
+	}
+	
+	// DONE
+	return retVal;
+}
+
+
+int htrace_hunt_chunk(htHunt_ptr hunt_ptr, size_t chunkNum, unsigned char* buff_ptr)
+{
+	// LOCAL VARIABLES
+	int retVal = 0;
+	size_t chunkStart = chunkNum * hunt_ptr->chunkSize;  // Haystack offset of this chunk
+	size_t readLen = hunt_ptr->chunkSize + hunt_ptr->needleLen - 1;  // Bytes to read, including the overlap
+	unsigned char* match_ptr = NULL;  // Return value from mem_hunt()
+	size_t matchOffset = 0;  // Haystack offset of the match
+	size_t currBest = 0;  // Snapshot of hunt_ptr->bestOffset
+
+	// SIZE THE READ
+	if (chunkStart + readLen > hunt_ptr->haystackLen)
+	{
+		readLen = hunt_ptr->haystackLen - chunkStart;
+	}
+
+	// READ AND SEARCH
+	if (readLen >= hunt_ptr->needleLen)
 	{
-		if (false == release_a_string_len((char**)&pidHaystack_ptr, haystackLen))
+		retVal = htrace_read_into(hunt_ptr->pid, (void*)(hunt_ptr->haystack + chunkStart), buff_ptr, readLen);
+
+		if (0 == retVal)
 		{
-			HARKLE_ERROR(Harkletrace, pid_mem_hunt, release_a_string_len failed);
+			match_ptr = mem_hunt(buff_ptr, hunt_ptr->needle_ptr, readLen, hunt_ptr->needleLen);
+
+			if (match_ptr)
+			{
+				// Keep the lowest offset
+				matchOffset = chunkStart + (match_ptr - buff_ptr);
+				currBest = __atomic_load_n(&(hunt_ptr->bestOffset), __ATOMIC_ACQUIRE);
+
+				while (matchOffset < currBest && \
+				       !__atomic_compare_exchange_n(&(hunt_ptr->bestOffset), &currBest, matchOffset, \
+				                                    false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+			}
 		}
 	}
-	
+
 	// DONE
 	return retVal;
 }
+
+
+void* htrace_hunt_worker(void* hunt_ptr)
+{
+	// LOCAL VARIABLES
+	htHunt_ptr hunt = (htHunt_ptr)hunt_ptr;
+	unsigned char* buff_ptr = malloc(hunt->chunkSize + hunt->needleLen - 1);  // This thread's chunk buffer
+	size_t chunkNum = 0;  // Chunk currently claimed
+
+	// SEARCH
+	while (buff_ptr)
+	{
+		chunkNum = __atomic_fetch_add(&(hunt->nextChunk), 1, __ATOMIC_ACQ_REL);
+
+		if (chunkNum >= hunt->numChunks)
+		{
+			break;
+		}
+		else if (chunkNum * hunt->chunkSize >= __atomic_load_n(&(hunt->bestOffset), __ATOMIC_ACQUIRE))
+		{
+			break;  // Already found something earlier
+		}
+		else if (htrace_hunt_chunk(hunt, chunkNum, buff_ptr))
+		{
+			hunt->failed_arr[chunkNum] = true;
+		}
+	}
+
+	// CLEAN UP
+	if (buff_ptr)
+	{
+		free(buff_ptr);
+	}
+
+	// DONE
+	return NULL;
+}
@@ -9,25 +9,52 @@
 #ifndef __HARKLETRACE__
 #define __HARKLETRACE__
 
+#include <stddef.h>								// size_t
+#include <sys/types.h>							// pid_t
+
 
 /*
-	Purpose - Read a 'blob' from a PID's memory address using ptrace(PTRACE_PEEKDATA) into
-		a heap-allocated buffer
+	Purpose - Read a 'blob' from a PID's memory address into a heap-allocated buffer
 	Input
 		pid - The "tracee" PID (see: ptrace(2))
-		src_ptr - Offset into the "tracee"s USER area
+		src_ptr - Virtual address in the "tracee"s memory to start reading from
 		srcLen - Length of the 'blob'
 		errNum [Out] - Pointer to an integer in which to store errno on error
 	Output
 		On success, pointer to a heap-allocated buffer containing the 'blob' being read
 		On failure, NULL is returned and errno is assigned to errNum
 	Notes:
+		The read itself is htrace_read_into(): process_vm_readv() first, then
+			pread() from /proc/<PID>/mem, then ptrace(PTRACE_PEEKDATA) a word
+			at a time, so the tracee only needs to be ptrace-stopped for the
+			last one
 		The void* returned by this function is NOT nul-terminated
 		It is the caller's responsibility to free() the memory returned by this function
  */
 void* htrace_read_data(pid_t pid, void* src_ptr, size_t srcLen, int* errNum);
 
 
+/*
+	Purpose - Read a 'blob' from a PID's memory address into a caller-supplied buffer
+	Input
+		pid - The "tracee" PID (see: ptrace(2))
+		src_ptr - Address in the "tracee"s memory to start reading from
+		dest_ptr - Local buffer of at least srcLen bytes
+		srcLen - Length of the 'blob'
+	Output
+		On success, 0
+		On failure, the errno of the last read method attempted
+	Notes:
+		Read methods are attempted fastest first:
+			1. process_vm_readv() (see: Memoroad's copy_remote_to_local_vec())
+			2. pread() from /proc/<PID>/mem
+			3. ptrace(PTRACE_PEEKDATA) one aligned word at a time
+		The PTRACE_PEEKDATA fallback handles unaligned heads and tails by
+			reading the containing aligned words and copying the overlap
+ */
+int htrace_read_into(pid_t pid, void* src_ptr, void* dest_ptr, size_t srcLen);
+
+
 /*
 	Purpose - Write a 'blob' to a PID's memory address using ptrace(PTRACE_POKEDATA)
 	Input
@@ -66,4 +93,29 @@ int htrace_write_data(pid_t pid, void* dest_ptr, void* src_ptr, size_t srcLen);
 size_t pid_mem_hunt(pid_t pid, void* haystack_ptr, void* needle_ptr, size_t haystackLen, size_t needleLen);
 
 
+/*
+	Purpose - Do the heavy lifting for pid_mem_hunt() by streaming the remote haystack
+		in overlapping chunks searched concurrently by worker threads
+	Input
+		pid - The PID of the target process
+		haystack_ptr - A pointer to an RVA inside PID's mapped memory that is of length haystackLen
+		needle_ptr - A pointer to a memory area of length needleLen
+		haystackLen - The size of the memory area haystack_ptr points to
+		needleLen - The size of the memory area needle_ptr points to
+		chunkSize - Number of haystack bytes per chunk (pid_mem_hunt() uses HTRACE_HUNT_CHUNK)
+		numThreads - Number of worker threads, 0 for one per online CPU (capped at
+			HTRACE_HUNT_MAX_THREADS)
+	Output - Same as pid_mem_hunt()
+	Notes:
+		Each chunk is read with needleLen - 1 extra bytes so matches spanning two chunks
+			are not missed
+		Worker threads read with process_vm_readv() or /proc/<PID>/mem.  Chunks they
+			can't read are retried by the calling thread, which may fall back to
+			ptrace(PTRACE_PEEKDATA) as the tracer.
+		Link with -pthread
+ */
+size_t pid_mem_hunt_chunked(pid_t pid, void* haystack_ptr, void* needle_ptr, size_t haystackLen, size_t needleLen, \
+	                        size_t chunkSize, int numThreads);
+
+
 #endif  // __HARKLETRACE__
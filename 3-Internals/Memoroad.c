@@ -1,7 +1,10 @@
 #define _GNU_SOURCE							// process_vm_readv() and process_vm_writev() are only available when GNU extensions are enabled
 #include <errno.h>							// errno
+#include <limits.h>							// IOV_MAX
+#include <malloc.h>							// malloc_usable_size()
 #include "Harklerror.h"						// HARKLE_ERROR
 #include "Memoroad.h"
+#include "../4-User_Mode/Map_Memory.h"		// mapMem_ptr
 #include <stdbool.h>						// bool, true, false
 #include <stdio.h>							// fprintf
 #include <stdlib.h>							// calloc
@@ -9,6 +12,11 @@
 #include <sys/uio.h>						// process_vm_readv(), process_vm_writev()
 #include <unistd.h>							// sysconf()
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MROAD_HUNT_X86						// SSE2/AVX2 candidate filtering is available
+#include <immintrin.h>						// _mm_*(), _mm256_*()
+#endif  // x86 GCC/Clang
+
 #ifndef MEMOROAD_MAX_TRIES
 // MACRO to limit repeated allocation attempts
 #define MEMOROAD_MAX_TRIES 3
@@ -18,6 +26,141 @@
 #define MEMSET_DEFAULT 0x0
 #endif  // MEMSET_DEFAULT
 
+#ifndef MROAD_ARENA_BLOCK_SIZE
+// MACRO defining the default size of a memArena block
+#define MROAD_ARENA_BLOCK_SIZE (64 * 1024)
+#endif  // MROAD_ARENA_BLOCK_SIZE
+
+#ifndef MROAD_ARENA_ALIGN
+// MACRO defining the alignment of every arena allocation
+#define MROAD_ARENA_ALIGN (sizeof(max_align_t))
+#endif  // MROAD_ARENA_ALIGN
+
+#ifndef MROAD_STR_SET_SIZE
+// MACRO defining the default number of memStrSet slots
+#define MROAD_STR_SET_SIZE 64
+#endif  // MROAD_STR_SET_SIZE
+
+#ifndef MROAD_IOV_BATCH
+// MACRO defining the maximum number of iovecs passed to a single process_vm_readv() call
+#ifdef IOV_MAX
+#define MROAD_IOV_BATCH IOV_MAX
+#else
+#define MROAD_IOV_BATCH 1024
+#endif  // IOV_MAX
+#endif  // MROAD_IOV_BATCH
+
+#ifndef MROAD_HUNT_LONG_NEEDLE
+// MACRO defining the needle length at which mem_hunt() switches to Boyer-Moore-Horspool
+#define MROAD_HUNT_LONG_NEEDLE 64
+#endif  // MROAD_HUNT_LONG_NEEDLE
+
+
+/*
+	Purpose - mem_hunt() engine for short needles: memchr() to the next
+		occurrence of the needle's first byte, then memcmp() the rest
+	Input - Same as mem_hunt() but pre-validated
+	Output - Pointer to the first match, NULL if not found
+ */
+void* mem_hunt_memchr(const unsigned char* haystack_ptr, const unsigned char* needle_ptr, size_t haystackLen, size_t needleLen);
+
+
+/*
+	Purpose - mem_hunt() engine for long needles: Boyer-Moore-Horspool
+	Input - Same as mem_hunt() but pre-validated
+	Output - Pointer to the first match, NULL if not found
+	Notes:
+		Skips up to needleLen bytes per comparison by consulting a 256 entry
+			bad character table built from the needle
+ */
+void* mem_hunt_bmh(const unsigned char* haystack_ptr, const unsigned char* needle_ptr, size_t haystackLen, size_t needleLen);
+
+
+#ifdef MROAD_HUNT_X86
+/*
+	Purpose - mem_hunt() engines for medium needles: compare the needle's first
+		and last bytes against 16 (SSE2) or 32 (AVX2) haystack offsets at once
+		and only memcmp() the candidates that match both
+	Input - Same as mem_hunt() but pre-validated, needleLen must be at least 2
+	Output - Pointer to the first match, NULL if not found
+	Notes:
+		The tail of the haystack that does not fill a vector is handed to
+			mem_hunt_memchr()
+ */
+void* mem_hunt_sse2(const unsigned char* haystack_ptr, const unsigned char* needle_ptr, size_t haystackLen, size_t needleLen) __attribute__((target("sse2")));
+void* mem_hunt_avx2(const unsigned char* haystack_ptr, const unsigned char* needle_ptr, size_t haystackLen, size_t needleLen) __attribute__((target("avx2")));
+
+
+/*
+	Purpose - Upgrade mroadHuntEngine to the widest engine the CPU supports
+	Notes:
+		Runs as a constructor, before main() and any threads, so mem_hunt()
+			never writes mroadHuntEngine
+ */
+void pick_mem_hunt_engine(void) __attribute__((constructor));
+#endif  // MROAD_HUNT_X86
+
+
+// mem_hunt() engine for medium needles, upgraded by pick_mem_hunt_engine() where available
+void* (*mroadHuntEngine)(const unsigned char*, const unsigned char*, size_t, size_t) = mem_hunt_memchr;
+
+
+/*
+	Purpose - Allocate a new block for a memArena
+	Input
+		blockSize - Usable size of the block
+	Output - Heap-allocated, empty, block on success, NULL on failure
+ */
+memBlock_ptr allocate_mem_block(size_t blockSize);
+
+
+/*
+	Purpose - Hash a nul-terminated string (64-bit FNV-1a)
+	Input
+		char_ptr - Nul-terminated string
+	Output - The hash
+ */
+uint64_t hash_a_string(const char* char_ptr);
+
+
+/*
+	Purpose - Find char_ptr's slot in a memStrSet
+	Input
+		set_ptr - Set to search
+		char_ptr - Nul-terminated string
+		hash - hash_a_string(char_ptr)
+	Output - The slot holding char_ptr, or the empty slot where it belongs
+ */
+memStrSlot_ptr find_str_slot(memStrSet_ptr set_ptr, const char* char_ptr, uint64_t hash);
+
+
+/*
+	Purpose - Double the number of slots in a memStrSet
+	Input
+		set_ptr - Set to grow
+	Output - On success, true.  Otherwise, false (and the set is unchanged).
+ */
+bool grow_mem_str_set(memStrSet_ptr set_ptr);
+
+
+// mem_hunt_multi_arr() growable result array
+typedef struct memHitCollector
+{
+	memHit_ptr hit_arr;  // Heap-allocated array of hits
+	size_t numHits;  // Number of hits stored in hit_arr
+	size_t arrSize;  // Number of hits hit_arr can hold
+	bool failed;  // true if a reallocation failed
+} memHitCol, *memHitCol_ptr;
+
+
+/*
+	Purpose - mem_hunt_multi() callback used by mem_hunt_multi_arr() to append
+		each hit to a memHitCollector, doubling the array as necessary
+	Input - See memHuntCallback, userData is a memHitCol_ptr
+	Output - true to keep scanning, false if the array could not grow
+ */
+bool collect_mem_hit(size_t needleID, size_t offset, void* userData);
+
 
 //////////////////////////////////////////////////////////////////////////////
 ///////////////////////// ALLOCATION FUNCTIONS START /////////////////////////
@@ -230,33 +373,25 @@ struct iovec* allocate_iovec_struct(void)
 //////////////////////////////////////////////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
-//////////////////////////// FREE FUNCTIONS START ////////////////////////////
+/////////////////////////// ARENA FUNCTIONS START ////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
 
-bool release_a_string(char** charPtr_ptr)
+memArena_ptr create_mem_arena(size_t blockSize)
 {
 	// LOCAL VARIABLES
-	bool retVal = true;
-	char* char_ptr = NULL;
-	size_t stringLen = 0;  // Attempt to get the string length
+	memArena_ptr retVal = NULL;
 
-	if (charPtr_ptr)
+	// ALLOCATE
+	retVal = get_me_memory(sizeof(memArena));
+
+	if (!retVal)
 	{
-		if (*charPtr_ptr)
-		{
-			retVal = release_a_string_len(charPtr_ptr, strlen(*charPtr_ptr));
-		}
-		else
-		{
-			HARKLE_ERROR(Fileroad, release_a_string, NULL pointer);
-			retVal = false;
-		}
+		HARKLE_ERROR(Memoroad, create_mem_arena, get_me_memory failed);
 	}
 	else
 	{
-		HARKLE_ERROR(Fileroad, release_a_string, NULL pointer);
-		retVal = false;
+		retVal->blockSize = blockSize > 0 ? blockSize : MROAD_ARENA_BLOCK_SIZE;
 	}
 
 	// DONE
@@ -264,57 +399,103 @@ bool release_a_string(char** charPtr_ptr)
 }
 
 
-bool release_a_string_len(char** charPtr_ptr, size_t buffSize)
+memBlock_ptr allocate_mem_block(size_t blockSize)
 {
 	// LOCAL VARIABLES
-	bool retVal = true;  // Default... prove it wrong
-	char* char_ptr = NULL;  // Easier to deal with it this way
-	char* temp_ptr = NULL;  // Return value from string.h function calls
+	memBlock_ptr retVal = NULL;
+	int numTries = 0;  // Max number to malloc attempts
+
+	// ALLOCATE
+	while (!retVal && numTries < MEMOROAD_MAX_TRIES)
+	{
+		retVal = malloc(sizeof(memBlock) + blockSize);
+		numTries++;
+	}
+
+	if (!retVal)
+	{
+		HARKLE_ERROR(Memoroad, allocate_mem_block, malloc failed);
+	}
+	else
+	{
+		retVal->next = NULL;
+		retVal->blockSize = blockSize;
+		retVal->used = 0;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+void* arena_get_memory(memArena_ptr arena_ptr, size_t length, bool zeroize)
+{
+	// LOCAL VARIABLES
+	void* retVal = NULL;
+	bool success = true;  // If anything fails, this is becomes false
+	memBlock_ptr block_ptr = NULL;  // Block to bump
+	memBlock_ptr new_ptr = NULL;  // Newly allocated block
+	size_t alignedLen = 0;  // length rounded up to MROAD_ARENA_ALIGN
 
 	// INPUT VALIDATION
-	if (!charPtr_ptr)
+	if (!arena_ptr)
 	{
-		HARKLE_ERROR(Fileroad, release_a_string_len, NULL pointer);
-		retVal = false;
+		HARKLE_ERROR(Memoroad, arena_get_memory, NULL pointer);
+		success = false;
 	}
-	else if (!(*charPtr_ptr))
+	else if (length < 1 || length > SIZE_MAX - MROAD_ARENA_ALIGN)
 	{
-		HARKLE_ERROR(Fileroad, release_a_string_len, NULL pointer);
-		retVal = false;
+		HARKLE_ERROR(Memoroad, arena_get_memory, Invalid buffer length);
+		success = false;
 	}
-	else if (buffSize < 0)
+	else
 	{
-		HARKLE_ERROR(Fileroad, release_a_string_len, Invalid buffer size);
-		retVal = false;
+		alignedLen = (length + MROAD_ARENA_ALIGN - 1) & ~(MROAD_ARENA_ALIGN - 1);
 	}
 
-	if (retVal == true)
+	// FIND ROOM
+	if (true == success)
 	{
-		// RELEASE THE STRING
-		char_ptr = *charPtr_ptr;
+		block_ptr = arena_ptr->current;
 
-		if (buffSize > 0)
+		// Move on to blocks kept from before a reset
+		while (block_ptr && block_ptr->blockSize - block_ptr->used < alignedLen && block_ptr->next)
 		{
-			// 1. harkleset
-			// fprintf(stdout, "release_a_string_len() - About to memset() char_ptr %s (%p)\n", char_ptr, char_ptr);
-			// temp_ptr = (void*)memset((void*)char_ptr, MEMSET_DEFAULT, buffSize);
-			temp_ptr = (void*)harkleset((void*)char_ptr, MEMSET_DEFAULT, buffSize);
-			// fprintf(stdout, "release_a_string_len() - Just memset() char_ptr %s (%p)\n", char_ptr, char_ptr);
+			block_ptr = block_ptr->next;
+		}
 
-			if (temp_ptr != char_ptr)
+		if (!block_ptr || block_ptr->blockSize - block_ptr->used < alignedLen)
+		{
+			new_ptr = allocate_mem_block(alignedLen > arena_ptr->blockSize ? alignedLen : arena_ptr->blockSize);
+
+			if (!new_ptr)
 			{
-				// HARKLE_ERROR(Fileroad, release_a_string_len, memset failed);
-				HARKLE_ERROR(Fileroad, release_a_string_len, harkleset failed);
+				HARKLE_ERROR(Memoroad, arena_get_memory, allocate_mem_block failed);
+				success = false;
+			}
+			else if (!block_ptr)
+			{
+				arena_ptr->first = new_ptr;
 			}
+			else
+			{
+				block_ptr->next = new_ptr;
+			}
+			block_ptr = new_ptr;
 		}
+	}
 
-		// 2. free
-		// fprintf(stdout, "release_a_string_len() - About to free() char_ptr (%p)\n", char_ptr);
-		free(char_ptr);
+	// BUMP
+	if (true == success)
+	{
+		retVal = block_ptr->data + block_ptr->used;
+		block_ptr->used += alignedLen;
+		arena_ptr->current = block_ptr;
 
-		// 3. NULL
-		char_ptr = NULL;
-		*charPtr_ptr = NULL;
+		if (true == zeroize)
+		{
+			memset(retVal, 0x0, length);
+		}
 	}
 
 	// DONE
@@ -322,144 +503,141 @@ bool release_a_string_len(char** charPtr_ptr, size_t buffSize)
 }
 
 
-bool free_char_arr(char*** charArr_ptr)
+char* arena_get_a_buffer(memArena_ptr arena_ptr, size_t length)
 {
 	// LOCAL VARIABLES
-	bool retVal = true;
-	char* currChar_ptr = NULL;  // C-string to be cleared
-	char* temp_ptr = NULL;  // Return value from harkleset
-	char** currChar_arr = NULL;  // Array of C-strings to be cleared
-	size_t currLen = 0;  // Length of the current string
+	char* retVal = NULL;
 
 	// INPUT VALIDATION
-	if (charArr_ptr)
+	if (length < 1 || length == SIZE_MAX)
 	{
-		if (*charArr_ptr)
-		{
-			currChar_arr = *charArr_ptr;
+		HARKLE_ERROR(Memoroad, arena_get_a_buffer, Invalid buffer length);
+	}
+	else
+	{
+		retVal = arena_get_memory(arena_ptr, length + 1, true);
+	}
 
-			while (*currChar_arr)
-			{
-				currChar_ptr = *currChar_arr;
+	// DONE
+	return retVal;
+}
 
-				if (currChar_ptr)
-				{
-					// fprintf(stdout, "About to memset (%p):\t%s\n", currChar_ptr, currChar_ptr);  // DEBUGGING
-					// harkleset char*
-					if (*currChar_ptr)
-					{
-						currLen = strlen(currChar_ptr);
-
-						if (currLen > 0)
-						{
-							// temp_ptr = memset(currChar_ptr, 0x0, currLen);
-							temp_ptr = (void*)harkleset((void*)currChar_ptr, MEMSET_DEFAULT, currLen);
-
-							if (temp_ptr != currChar_ptr)
-							{
-								HARKLE_ERROR(Memoroad, free_char_arr, harkleset failed);
-								// HARKLE_ERROR(Memoroad, free_char_arr, memset failed);
-								retVal = false;
-							}
-							else
-							{
-								temp_ptr = NULL;
-							}
-						}
-					}
 
-					// free char*
-					// free(*currChar_arr);
-					free(currChar_ptr);
+char** arena_get_a_buffer_array(memArena_ptr arena_ptr, size_t arraySize, bool nullTerm)
+{
+	// LOCAL VARIABLES
+	char** retVal = NULL;
+	size_t actualArrSize = arraySize;
 
-					// NULL char*
-					currChar_ptr = NULL;
-					*currChar_arr = NULL;
-				}
-				// Next char*
-				currChar_arr++;
-			}
+	// INPUT VALIDATION
+	if (arraySize < 1 || arraySize > (SIZE_MAX / sizeof(char*)) - 1)
+	{
+		HARKLE_ERROR(Memoroad, arena_get_a_buffer_array, Invalid array size);
+	}
+	else
+	{
+		// NULL terminate?
+		if (nullTerm == true)
+		{
+			actualArrSize++;
+		}
+		retVal = arena_get_memory(arena_ptr, actualArrSize * sizeof(char*), true);
+	}
 
-			// free char**
-			free(*charArr_ptr);
+	// DONE
+	return retVal;
+}
 
-			// NULL char**
-			charArr_ptr = NULL;
+
+char* arena_copy_a_string(memArena_ptr arena_ptr, const char* char_ptr)
+{
+	// LOCAL VARIABLES
+	char* retVal = NULL;
+	size_t charLen = 0;  // Length of char_ptr
+
+	// INPUT VALIDATION
+	if (char_ptr && *char_ptr)
+	{
+		charLen = strlen(char_ptr);
+		retVal = arena_get_memory(arena_ptr, charLen + 1, false);
+
+		if (retVal)
+		{
+			memcpy(retVal, char_ptr, charLen + 1);
 		}
 		else
 		{
-			HARKLE_ERROR(Memoroad, free_char_arr, NULL pointer);
-			retVal = false;
+			HARKLE_ERROR(Memoroad, arena_copy_a_string, arena_get_memory failed);
 		}
 	}
-	else
-	{
-		HARKLE_ERROR(Memoroad, free_char_arr, NULL pointer);
-		retVal = false;
-	}
 
 	// DONE
 	return retVal;
 }
 
 
-bool free_iovec_struct(struct iovec** oldStruct_ptr, bool freeAll)
+bool reset_mem_arena(memArena_ptr arena_ptr, bool secureWipe)
 {
 	// LOCAL VARIABLES
-	bool retVal = true;  // Default... prove it wrong
-	struct iovec* iovec_ptr = NULL;  // Easier to deal with it this way
-	void* temp_ptr = NULL;  // Return value from string.h function calls
+	bool retVal = true;
+	memBlock_ptr block_ptr = NULL;  // Iterating variable
 
 	// INPUT VALIDATION
-	if (!oldStruct_ptr)
-	{
-		HARKLE_ERROR(Fileroad, free_iovec_struct, NULL pointer);
-		retVal = false;
-	}
-	else if (!(*oldStruct_ptr))
+	if (!arena_ptr)
 	{
-		HARKLE_ERROR(Fileroad, free_iovec_struct, NULL pointer);
+		HARKLE_ERROR(Memoroad, reset_mem_arena, NULL pointer);
 		retVal = false;
 	}
 	else
 	{
-		iovec_ptr = *oldStruct_ptr;
-	}
-
-	if (true == retVal)
-	{
-		// 1. Clear void *iov_base;    /* Starting address */
-		if (true == freeAll && iovec_ptr->iov_base)
+		for (block_ptr = arena_ptr->first; block_ptr; block_ptr = block_ptr->next)
 		{
-			// 1.1. memset the memory
-			if (iovec_ptr->iov_len > 0)
+			if (true == secureWipe && block_ptr->used > 0)
 			{
-				temp_ptr = memset(iovec_ptr->iov_base, MEMSET_DEFAULT, iovec_ptr->iov_len);
-
-				if (temp_ptr != iovec_ptr->iov_base)
-				{
-					HARKLE_ERROR(Memoroad, free_iovec_struct, memset failed);
-					retVal = false;
-				}
-				else
-				{
-					temp_ptr = NULL;
-				}
+				harkleset(block_ptr->data, MEMSET_DEFAULT, block_ptr->used);
 			}
-			// 1.2. free() the memory
-			free(iovec_ptr->iov_base);
+			block_ptr->used = 0;
 		}
-		iovec_ptr->iov_base = NULL;
+		arena_ptr->current = arena_ptr->first;
+	}
 
-		// 2. Clear size_t iov_len;     /* Number of bytes to transfer */
-		iovec_ptr->iov_len = 0;
+	// DONE
+	return retVal;
+}
 
-		// 3. Free the struct pointer
-		free(iovec_ptr);
 
-		// 4. NULL the variables
-		iovec_ptr = NULL;
-		*oldStruct_ptr = NULL;
+bool free_mem_arena(memArena_ptr* oldArena_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	memBlock_ptr block_ptr = NULL;  // Iterating variable
+	memBlock_ptr next_ptr = NULL;  // Next block to free
+
+	// INPUT VALIDATION
+	if (!oldArena_ptr || !(*oldArena_ptr))
+	{
+		HARKLE_ERROR(Memoroad, free_mem_arena, NULL pointer);
+		retVal = false;
+	}
+	else
+	{
+		// 1. Wipe and free the blocks
+		// The whole block, not just used: a reset_mem_arena() without secureWipe
+		// leaves older data past the current used mark
+		block_ptr = (*oldArena_ptr)->first;
+
+		while (block_ptr)
+		{
+			next_ptr = block_ptr->next;
+			harkleset(block_ptr->data, MEMSET_DEFAULT, block_ptr->blockSize);
+			free(block_ptr);
+			block_ptr = next_ptr;
+		}
+
+		// 2. Free the arena
+		memset(*oldArena_ptr, MEMSET_DEFAULT, sizeof(memArena));
+		free(*oldArena_ptr);
+		*oldArena_ptr = NULL;
 	}
 
 	// DONE
@@ -468,113 +646,1268 @@ bool free_iovec_struct(struct iovec** oldStruct_ptr, bool freeAll)
 
 
 //////////////////////////////////////////////////////////////////////////////
-//////////////////////////// FREE FUNCTIONS STOP /////////////////////////////
+//////////////////////////// ARENA FUNCTIONS STOP ////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
-//////////////////////// MEM TRANSFER FUNCTIONS START ////////////////////////
+///////////////////////// STRING SET FUNCTIONS START /////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
 
-struct iovec* copy_remote_to_local(pid_t pid, void* remoteMem, size_t numBytes)
+memStrSet_ptr create_mem_str_set(size_t numExpected, bool internCopies)
 {
 	// LOCAL VARIABLES
-	struct iovec* retVal = NULL;
+	memStrSet_ptr retVal = NULL;
 	bool success = true;  // Make this false if anything fails
-	int numTries = 0;  // Keep count of allocation attempts
-	ssize_t pvrRetVal = 0;  // Return value from process_vm_readv() call
-	struct iovec remMem[1];  // iovec struct array to hold the remote copy info
-	int errNum = 0;  // Capture errno here
+	size_t numSlots = MROAD_STR_SET_SIZE;  // Keep the load factor at or under one half
 
-	// INPUT VALIDATION
-	if (pid < 1)
-	{
-		HARKLE_ERROR(Memoroad, copy_remote_to_local, Invalid PID);
-		success = false;
-	}
-	else if (!remoteMem)
+	// SIZE IT
+	while (numSlots / 2 < numExpected)
 	{
-		HARKLE_ERROR(Memoroad, copy_remote_to_local, NULL pointer);
-		success = false;
+		numSlots *= 2;
 	}
-	else if (numBytes < 1)
+
+	// ALLOCATE
+	retVal = get_me_memory(sizeof(memStrSet));
+
+	if (!retVal)
 	{
-		HARKLE_ERROR(Memoroad, copy_remote_to_local, Invalid number of bytes);
+		HARKLE_ERROR(Memoroad, create_mem_str_set, get_me_memory failed);
 		success = false;
 	}
-
-	// ALLOCATE A STRUCT
-	if (true == success)
+	else
 	{
-		retVal = (struct iovec*)allocate_iovec_struct();
+		retVal->numSlots = numSlots;
+		retVal->slot_arr = get_me_memory(numSlots * sizeof(memStrSlot));
 
-		if (!retVal)
+		if (!(retVal->slot_arr))
 		{
-			HARKLE_ERROR(Memoroad, copy_remote_to_local, allocate_iovec_struct failed);
+			HARKLE_ERROR(Memoroad, create_mem_str_set, get_me_memory failed);
 			success = false;
 		}
-	}
-
-	// ALLOCATE MEMORY
-	if (true == success)
-	{
-		while (NULL == retVal->iov_base && numTries < MEMOROAD_MAX_TRIES)
+		else if (true == internCopies)
 		{
-			retVal->iov_base = (void*)calloc(numBytes, 1);
+			retVal->arena_ptr = create_mem_arena(0);
 
-			if (retVal->iov_base)
+			if (!(retVal->arena_ptr))
 			{
-				retVal->iov_len = numBytes;
-				numTries++;
+				HARKLE_ERROR(Memoroad, create_mem_str_set, create_mem_arena failed);
+				success = false;
 			}
 		}
+	}
 
-		if (NULL == retVal->iov_base)
-		{
-			HARKLE_ERROR(Memoroad, copy_remote_to_local, calloc failed);
-			success = false;
-		}
+	// CLEAN UP
+	if (false == success && retVal)
+	{
+		free_mem_str_set(&retVal);
 	}
 
+	// DONE
+	return retVal;
+}
+
+
+const char* str_set_add(memStrSet_ptr set_ptr, const char* char_ptr, bool* isNew)
+{
+	// LOCAL VARIABLES
+	const char* retVal = NULL;
+	uint64_t hash = 0;  // Hash of char_ptr
+	memStrSlot_ptr slot_ptr = NULL;  // char_ptr's slot
+
+	// INPUT VALIDATION
+	if (isNew)
+	{
+		*isNew = false;
+	}
+
+	if (!set_ptr || !char_ptr)
+	{
+		HARKLE_ERROR(Memoroad, str_set_add, NULL pointer);
+	}
+	else
+	{
+		hash = hash_a_string(char_ptr);
+		slot_ptr = find_str_slot(set_ptr, char_ptr, hash);
+
+		if (slot_ptr->str)
+		{
+			retVal = slot_ptr->str;  // Already a member
+		}
+		else if ((set_ptr->numStrings + 1) > set_ptr->numSlots / 2 && false == grow_mem_str_set(set_ptr))
+		{
+			HARKLE_ERROR(Memoroad, str_set_add, grow_mem_str_set failed);
+		}
+		else
+		{
+			// The table may have moved
+			slot_ptr = find_str_slot(set_ptr, char_ptr, hash);
+
+			if (set_ptr->arena_ptr)
+			{
+				retVal = arena_get_memory(set_ptr->arena_ptr, strlen(char_ptr) + 1, false);
+
+				if (retVal)
+				{
+					strcpy((char*)retVal, char_ptr);
+				}
+				else
+				{
+					HARKLE_ERROR(Memoroad, str_set_add, arena_get_memory failed);
+				}
+			}
+			else
+			{
+				retVal = char_ptr;
+			}
+
+			if (retVal)
+			{
+				slot_ptr->hash = hash;
+				slot_ptr->str = retVal;
+				set_ptr->numStrings++;
+
+				if (isNew)
+				{
+					*isNew = true;
+				}
+			}
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool str_set_contains(memStrSet_ptr set_ptr, const char* char_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = false;
+
+	// INPUT VALIDATION
+	if (!set_ptr || !char_ptr)
+	{
+		HARKLE_ERROR(Memoroad, str_set_contains, NULL pointer);
+	}
+	else if (find_str_slot(set_ptr, char_ptr, hash_a_string(char_ptr))->str)
+	{
+		retVal = true;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool free_mem_str_set(memStrSet_ptr* oldSet_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	memStrSet_ptr set_ptr = NULL;  // Easier to deal with this way
+
+	// INPUT VALIDATION
+	if (!oldSet_ptr || !(*oldSet_ptr))
+	{
+		HARKLE_ERROR(Memoroad, free_mem_str_set, NULL pointer);
+		retVal = false;
+	}
+	else
+	{
+		set_ptr = *oldSet_ptr;
+
+		// 1. Interned copies
+		if (set_ptr->arena_ptr && false == free_mem_arena(&(set_ptr->arena_ptr)))
+		{
+			HARKLE_ERROR(Memoroad, free_mem_str_set, free_mem_arena failed);
+			retVal = false;
+		}
+
+		// 2. Slots
+		if (set_ptr->slot_arr)
+		{
+			harkleset(set_ptr->slot_arr, MEMSET_DEFAULT, set_ptr->numSlots * sizeof(memStrSlot));
+			free(set_ptr->slot_arr);
+		}
+
+		// 3. The set
+		harkleset(set_ptr, MEMSET_DEFAULT, sizeof(memStrSet));
+		free(set_ptr);
+		*oldSet_ptr = NULL;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+uint64_t hash_a_string(const char* char_ptr)
+{
+	// LOCAL VARIABLES
+	uint64_t retVal = 0xcbf29ce484222325ULL;  // FNV offset basis
+	const unsigned char* temp_ptr = (const unsigned char*)char_ptr;  // Iterating variable
+
+	// HASH
+	while (*temp_ptr)
+	{
+		retVal ^= *temp_ptr;
+		retVal *= 0x100000001b3ULL;  // FNV prime
+		temp_ptr++;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+memStrSlot_ptr find_str_slot(memStrSet_ptr set_ptr, const char* char_ptr, uint64_t hash)
+{
+	// LOCAL VARIABLES
+	size_t mask = set_ptr->numSlots - 1;  // numSlots is a power of two
+	size_t index = hash & mask;  // Current slot
+	memStrSlot_ptr retVal = set_ptr->slot_arr + index;
+
+	// PROBE
+	while (retVal->str)
+	{
+		if (retVal->hash == hash && 0 == strcmp(retVal->str, char_ptr))
+		{
+			break;  // Found it
+		}
+
+		index = (index + 1) & mask;
+		retVal = set_ptr->slot_arr + index;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool grow_mem_str_set(memStrSet_ptr set_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	memStrSlot_ptr oldSlot_arr = set_ptr->slot_arr;  // Current table
+	size_t oldNumSlots = set_ptr->numSlots;  // Current table size
+	memStrSlot_ptr newSlot_arr = get_me_memory(oldNumSlots * 2 * sizeof(memStrSlot));
+	size_t mask = (oldNumSlots * 2) - 1;  // New table mask
+	size_t index = 0;  // Slot in the new table
+	size_t i = 0;  // Iterating variable
+
+	// REHASH
+	if (!newSlot_arr)
+	{
+		HARKLE_ERROR(Memoroad, grow_mem_str_set, get_me_memory failed);
+		retVal = false;
+	}
+	else
+	{
+		for (i = 0; i < oldNumSlots; i++)
+		{
+			if (oldSlot_arr[i].str)
+			{
+				// No duplicates, so no need to compare strings
+				index = oldSlot_arr[i].hash & mask;
+
+				while (newSlot_arr[index].str)
+				{
+					index = (index + 1) & mask;
+				}
+				newSlot_arr[index] = oldSlot_arr[i];
+			}
+		}
+
+		set_ptr->slot_arr = newSlot_arr;
+		set_ptr->numSlots = oldNumSlots * 2;
+		free(oldSlot_arr);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+////////////////////////// STRING SET FUNCTIONS STOP /////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////// FREE FUNCTIONS START ////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+bool release_a_string(char** charPtr_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	char* char_ptr = NULL;
+	size_t stringLen = 0;  // Attempt to get the string length
+
+	if (charPtr_ptr)
+	{
+		if (*charPtr_ptr)
+		{
+			retVal = release_a_string_len(charPtr_ptr, malloc_usable_size(*charPtr_ptr));
+		}
+		else
+		{
+			HARKLE_ERROR(Fileroad, release_a_string, NULL pointer);
+			retVal = false;
+		}
+	}
+	else
+	{
+		HARKLE_ERROR(Fileroad, release_a_string, NULL pointer);
+		retVal = false;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool release_a_string_len(char** charPtr_ptr, size_t buffSize)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;  // Default... prove it wrong
+	char* char_ptr = NULL;  // Easier to deal with it this way
+	char* temp_ptr = NULL;  // Return value from string.h function calls
+
+	// INPUT VALIDATION
+	if (!charPtr_ptr)
+	{
+		HARKLE_ERROR(Fileroad, release_a_string_len, NULL pointer);
+		retVal = false;
+	}
+	else if (!(*charPtr_ptr))
+	{
+		HARKLE_ERROR(Fileroad, release_a_string_len, NULL pointer);
+		retVal = false;
+	}
+	else if (buffSize < 0)
+	{
+		HARKLE_ERROR(Fileroad, release_a_string_len, Invalid buffer size);
+		retVal = false;
+	}
+
+	if (retVal == true)
+	{
+		// RELEASE THE STRING
+		char_ptr = *charPtr_ptr;
+
+		if (buffSize > 0)
+		{
+			// 1. harkleset
+			// fprintf(stdout, "release_a_string_len() - About to memset() char_ptr %s (%p)\n", char_ptr, char_ptr);
+			// temp_ptr = (void*)memset((void*)char_ptr, MEMSET_DEFAULT, buffSize);
+			temp_ptr = (void*)harkleset((void*)char_ptr, MEMSET_DEFAULT, buffSize);
+			// fprintf(stdout, "release_a_string_len() - Just memset() char_ptr %s (%p)\n", char_ptr, char_ptr);
+
+			if (temp_ptr != char_ptr)
+			{
+				// HARKLE_ERROR(Fileroad, release_a_string_len, memset failed);
+				HARKLE_ERROR(Fileroad, release_a_string_len, harkleset failed);
+			}
+		}
+
+		// 2. free
+		// fprintf(stdout, "release_a_string_len() - About to free() char_ptr (%p)\n", char_ptr);
+		free(char_ptr);
+
+		// 3. NULL
+		char_ptr = NULL;
+		*charPtr_ptr = NULL;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool free_char_arr(char*** charArr_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	char* currChar_ptr = NULL;  // C-string to be cleared
+	char** currChar_arr = NULL;  // Array of C-strings to be cleared
+
+	// INPUT VALIDATION
+	if (charArr_ptr)
+	{
+		if (*charArr_ptr)
+		{
+			currChar_arr = *charArr_ptr;
+
+			// One pass per string: wipe the entire allocation (no strlen()), free, NULL
+			while (*currChar_arr)
+			{
+				currChar_ptr = *currChar_arr;
+				harkleset((void*)currChar_ptr, MEMSET_DEFAULT, malloc_usable_size(currChar_ptr));
+				free(currChar_ptr);
+				*currChar_arr = NULL;
+
+				// Next char*
+				currChar_arr++;
+			}
+
+			// free char**
+			free(*charArr_ptr);
+
+			// NULL char**
+			*charArr_ptr = NULL;
+		}
+		else
+		{
+			HARKLE_ERROR(Memoroad, free_char_arr, NULL pointer);
+			retVal = false;
+		}
+	}
+	else
+	{
+		HARKLE_ERROR(Memoroad, free_char_arr, NULL pointer);
+		retVal = false;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool free_iovec_struct(struct iovec** oldStruct_ptr, bool freeAll)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;  // Default... prove it wrong
+	struct iovec* iovec_ptr = NULL;  // Easier to deal with it this way
+	void* temp_ptr = NULL;  // Return value from string.h function calls
+
+	// INPUT VALIDATION
+	if (!oldStruct_ptr)
+	{
+		HARKLE_ERROR(Fileroad, free_iovec_struct, NULL pointer);
+		retVal = false;
+	}
+	else if (!(*oldStruct_ptr))
+	{
+		HARKLE_ERROR(Fileroad, free_iovec_struct, NULL pointer);
+		retVal = false;
+	}
+	else
+	{
+		iovec_ptr = *oldStruct_ptr;
+	}
+
+	if (true == retVal)
+	{
+		// 1. Clear void *iov_base;    /* Starting address */
+		if (true == freeAll && iovec_ptr->iov_base)
+		{
+			// 1.1. memset the memory
+			if (iovec_ptr->iov_len > 0)
+			{
+				temp_ptr = harkleset(iovec_ptr->iov_base, MEMSET_DEFAULT, iovec_ptr->iov_len);
+
+				if (temp_ptr != iovec_ptr->iov_base)
+				{
+					HARKLE_ERROR(Memoroad, free_iovec_struct, harkleset failed);
+					retVal = false;
+				}
+				else
+				{
+					temp_ptr = NULL;
+				}
+			}
+			// 1.2. free() the memory
+			free(iovec_ptr->iov_base);
+		}
+		iovec_ptr->iov_base = NULL;
+
+		// 2. Clear size_t iov_len;     /* Number of bytes to transfer */
+		iovec_ptr->iov_len = 0;
+
+		// 3. Free the struct pointer
+		free(iovec_ptr);
+
+		// 4. NULL the variables
+		iovec_ptr = NULL;
+		*oldStruct_ptr = NULL;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////// FREE FUNCTIONS STOP /////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////// MEM TRANSFER FUNCTIONS START ////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+struct iovec* copy_remote_to_local(pid_t pid, void* remoteMem, size_t numBytes)
+{
+	// LOCAL VARIABLES
+	struct iovec* retVal = NULL;
+	bool success = true;  // Make this false if anything fails
+	int numTries = 0;  // Keep count of allocation attempts
+	ssize_t pvrRetVal = 0;  // Return value from process_vm_readv() call
+	struct iovec remMem[1];  // iovec struct array to hold the remote copy info
+	int errNum = 0;  // Capture errno here
+
+	// INPUT VALIDATION
+	if (pid < 1)
+	{
+		HARKLE_ERROR(Memoroad, copy_remote_to_local, Invalid PID);
+		success = false;
+	}
+	else if (!remoteMem)
+	{
+		HARKLE_ERROR(Memoroad, copy_remote_to_local, NULL pointer);
+		success = false;
+	}
+	else if (numBytes < 1)
+	{
+		HARKLE_ERROR(Memoroad, copy_remote_to_local, Invalid number of bytes);
+		success = false;
+	}
+
+	// ALLOCATE A STRUCT
+	if (true == success)
+	{
+		retVal = (struct iovec*)allocate_iovec_struct();
+
+		if (!retVal)
+		{
+			HARKLE_ERROR(Memoroad, copy_remote_to_local, allocate_iovec_struct failed);
+			success = false;
+		}
+	}
+
+	// ALLOCATE MEMORY
+	if (true == success)
+	{
+		while (NULL == retVal->iov_base && numTries < MEMOROAD_MAX_TRIES)
+		{
+			retVal->iov_base = (void*)calloc(numBytes, 1);
+
+			if (retVal->iov_base)
+			{
+				retVal->iov_len = numBytes;
+				numTries++;
+			}
+		}
+
+		if (NULL == retVal->iov_base)
+		{
+			HARKLE_ERROR(Memoroad, copy_remote_to_local, calloc failed);
+			success = false;
+		}
+	}
+
+	// COPY THE MEMORY
+	if (true == success)
+	{
+		// Prepare the remote struct pointer
+		remMem[0].iov_base = remoteMem;
+		remMem[0].iov_len = numBytes;
+
+		// ssize_t process_vm_readv(pid_t pid,
+		//                          const struct iovec *local_iov,
+		//                          unsigned long liovcnt,
+		//                          const struct iovec *remote_iov,
+		//                          unsigned long riovcnt,
+		//                          unsigned long flags);
+		pvrRetVal = process_vm_readv(pid, retVal, 1, remMem, 1, 0);
+
+		if (-1 == pvrRetVal)
+		{
+			errNum = errno;
+			HARKLE_ERROR(Memoroad, copy_remote_to_local, process_vm_readv failed);
+			HARKLE_ERRNO(Memoroad, process_vm_readv, errNum);
+			// fprintf(stderr, "process_vm_readv() returned errno:\t%s\n", strerror(errNum));
+			success = false;
+		}
+		else if (pvrRetVal != numBytes)
+		{
+			HARKLE_ERROR(Memoroad, copy_remote_to_local, process_vm_readv only made a partial read);
+			success = false;
+		}
+	}
+
+	// CLEAN UP
+	if (false == success)
+	{
+		if (retVal)
+		{
+			if (false == free_iovec_struct(&retVal, true))
+			{
+				HARKLE_ERROR(Memoroad, copy_remote_to_local, free_iovec_struct failed);
+			}
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+int copy_remote_to_local_vec(pid_t pid, struct iovec* local_arr, struct iovec* remote_arr, size_t numRanges, size_t* bytesRead_arr)
+{
+	// LOCAL VARIABLES
+	int retVal = 0;
+	struct iovec locBatch[MROAD_IOV_BATCH];  // Local iovecs trimmed to match the remote lengths
+	size_t batchStart = 0;  // Index of the first range in the current batch
+	size_t batchLen = 0;  // Number of ranges in the current batch
+	size_t i = 0;  // Iterating variable
+	ssize_t pvrRetVal = 0;  // Return value from process_vm_readv() call
+	size_t remaining = 0;  // Bytes of pvrRetVal not yet attributed to a range
+
+	// INPUT VALIDATION
+	if (pid < 1)
+	{
+		HARKLE_ERROR(Memoroad, copy_remote_to_local_vec, Invalid PID);
+		retVal = EINVAL;
+	}
+	else if (!local_arr || !remote_arr)
+	{
+		HARKLE_ERROR(Memoroad, copy_remote_to_local_vec, NULL pointer);
+		retVal = EINVAL;
+	}
+	else
+	{
+		for (i = 0; i < numRanges; i++)
+		{
+			if (local_arr[i].iov_len < remote_arr[i].iov_len || (remote_arr[i].iov_len && !local_arr[i].iov_base))
+			{
+				HARKLE_ERROR(Memoroad, copy_remote_to_local_vec, Local buffer is too small);
+				retVal = EINVAL;
+				break;
+			}
+			else if (bytesRead_arr)
+			{
+				bytesRead_arr[i] = 0;
+			}
+		}
+	}
+
+	// COPY THE MEMORY
+	while (0 == retVal || EFAULT == retVal)
+	{
+		if (batchStart >= numRanges)
+		{
+			break;
+		}
+
+		// 1. Prepare the batch
+		batchLen = numRanges - batchStart;
+		if (batchLen > MROAD_IOV_BATCH)
+		{
+			batchLen = MROAD_IOV_BATCH;
+		}
+
+		for (i = 0; i < batchLen; i++)
+		{
+			locBatch[i].iov_base = local_arr[batchStart + i].iov_base;
+			locBatch[i].iov_len = remote_arr[batchStart + i].iov_len;
+		}
+
+		// 2. Read it
+		pvrRetVal = process_vm_readv(pid, locBatch, batchLen, remote_arr + batchStart, batchLen, 0);
+
+		if (-1 == pvrRetVal)
+		{
+			if (EFAULT == errno)
+			{
+				// The first range of the batch is unreadable so skip it
+				retVal = EFAULT;
+				batchStart++;
+			}
+			else
+			{
+				retVal = errno;
+				HARKLE_ERROR(Memoroad, copy_remote_to_local_vec, process_vm_readv failed);
+				HARKLE_ERRNO(Memoroad, process_vm_readv, retVal);
+			}
+			continue;
+		}
+
+		// 3. Attribute the bytes read to each range
+		remaining = pvrRetVal;
+
+		for (i = batchStart; i < batchStart + batchLen; i++)
+		{
+			if (remaining >= remote_arr[i].iov_len)
+			{
+				remaining -= remote_arr[i].iov_len;
+
+				if (bytesRead_arr)
+				{
+					bytesRead_arr[i] = remote_arr[i].iov_len;
+				}
+			}
+			else
+			{
+				// Partial read.  Record it and resume after this range.
+				if (bytesRead_arr)
+				{
+					bytesRead_arr[i] = remaining;
+				}
+				retVal = EFAULT;
+				i++;
+				break;
+			}
+		}
+		batchStart = i;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+void* copy_remote_ranges(pid_t pid, struct iovec* remote_arr, struct iovec* local_arr, size_t numRanges, size_t* bytesRead_arr, int* errNum)
+{
+	// LOCAL VARIABLES
+	void* retVal = NULL;
+	bool success = true;  // Make this false if anything fails
+	size_t poolSize = 0;  // Total size of every remote range
+	size_t i = 0;  // Iterating variable
+
+	// INPUT VALIDATION
+	if (!errNum)
+	{
+		HARKLE_ERROR(Memoroad, copy_remote_ranges, NULL errNum pointer);
+		success = false;
+	}
+	else if (!remote_arr || !local_arr || numRanges < 1)
+	{
+		HARKLE_ERROR(Memoroad, copy_remote_ranges, Invalid ranges);
+		*errNum = EINVAL;
+		success = false;
+	}
+	else
+	{
+		for (i = 0; i < numRanges; i++)
+		{
+			if (remote_arr[i].iov_len > SIZE_MAX - poolSize)
+			{
+				break;  // The total won't fit in a size_t
+			}
+			poolSize += remote_arr[i].iov_len;
+		}
+
+		if (i < numRanges)
+		{
+			HARKLE_ERROR(Memoroad, copy_remote_ranges, Ranges overflow a size_t);
+			*errNum = EOVERFLOW;
+			success = false;
+		}
+		else if (poolSize < 1)
+		{
+			HARKLE_ERROR(Memoroad, copy_remote_ranges, Invalid number of bytes);
+			*errNum = EINVAL;
+			success = false;
+		}
+	}
+
+	// ALLOCATE THE POOL
+	if (true == success)
+	{
+		retVal = malloc(poolSize);
+
+		if (!retVal)
+		{
+			HARKLE_ERROR(Memoroad, copy_remote_ranges, malloc failed);
+			*errNum = ENOMEM;
+			success = false;
+		}
+		else
+		{
+			poolSize = 0;
+
+			for (i = 0; i < numRanges; i++)
+			{
+				local_arr[i].iov_base = retVal + poolSize;
+				local_arr[i].iov_len = remote_arr[i].iov_len;
+				poolSize += remote_arr[i].iov_len;
+			}
+		}
+	}
+
+	// COPY THE MEMORY
+	if (true == success)
+	{
+		*errNum = copy_remote_to_local_vec(pid, local_arr, remote_arr, numRanges, bytesRead_arr);
+
+		if (0 != *errNum && EFAULT != *errNum)
+		{
+			HARKLE_ERROR(Memoroad, copy_remote_ranges, copy_remote_to_local_vec failed);
+			success = false;
+		}
+	}
+
+	// CLEAN UP
+	if (false == success && retVal)
+	{
+		free(retVal);
+		retVal = NULL;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+int copy_local_to_remote(pid_t pid, void* remoteMem, void* localMem, size_t numBytes)
+{
+	// LOCAL VARIABLES
+	int retVal = 0;
+	bool success = true;  // Make this false if anything fails
+	int numTries = 0;  // Keep count of allocation attempts
+	ssize_t pvwRetVal = 0;  // Return value from process_vm_writev() call
+	struct iovec locMem[1];  // iovec struct array to hold the local memory info
+	struct iovec remMem[1];  // iovec struct array to hold the remote memory info
+
+	// INPUT VALIDATION
+	if (pid < 1)
+	{
+		HARKLE_ERROR(Memoroad, copy_local_to_remote, Invalid PID);
+		success = false;
+	}
+	else if (!remoteMem || !localMem)
+	{
+		HARKLE_ERROR(Memoroad, copy_local_to_remote, NULL pointer);
+		success = false;
+	}
+	else if (numBytes < 1)
+	{
+		HARKLE_ERROR(Memoroad, copy_local_to_remote, Invalid number of bytes);
+		success = false;
+	}
+	
 	// COPY THE MEMORY
 	if (true == success)
 	{
-		// Prepare the remote struct pointer
-		remMem[0].iov_base = remoteMem;
-		remMem[0].iov_len = numBytes;
+		// Prepare the local struct pointer
+		locMem[0].iov_base = localMem;
+		locMem[0].iov_len = numBytes;
+		
+		// Prepare the remote struct pointer
+		remMem[0].iov_base = remoteMem;
+		remMem[0].iov_len = numBytes;
+
+		// ssize_t process_vm_writev(pid_t pid,
+		//                           const struct iovec *local_iov,
+		//                           unsigned long liovcnt,
+		//                           const struct iovec *remote_iov,
+		//                           unsigned long riovcnt,
+		//                           unsigned long flags);
+		pvwRetVal = process_vm_writev(pid, locMem, 1, remMem, 1, 0);
+		
+		if (-1 == pvwRetVal)
+		{
+			retVal = errno;
+			HARKLE_ERROR(Memoroad, copy_local_to_remote, process_vm_writev failed);
+			HARKLE_ERRNO(Memoroad, process_vm_writev, retVal);
+			// fprintf(stderr, "process_vm_writev() returned errno:\t%s\n", strerror(retVal));
+			success = false;
+		}
+		else if (pvwRetVal != numBytes)
+		{
+			HARKLE_ERROR(Memoroad, copy_local_to_remote, process_vm_writev only made a partial write);
+			success = false;
+		}
+	}
+	
+	// DONE
+	return retVal;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////// MEM TRANSFER FUNCTIONS STOP /////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////////////////////
+///////////////////////// MAPPED MEM FUNCTIONS START /////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+int change_mmap_prot(void* mem_ptr, size_t memLen, int newProt)
+{
+	// LOCAL VARIABLES
+	int retVal = 0;
+	long pageSize = get_page_size();
+	
+	// INPUT VALIDATION
+	if (!mem_ptr)
+	{
+		HARKLE_ERROR(Memoroad, change_mmap_prot, NULL pointer);
+		retVal = EINVAL;
+	}
+	else if (memLen < 1)
+	{
+		HARKLE_ERROR(Memoroad, change_mmap_prot, Invalid page length);
+		retVal = EINVAL;
+	}
+	else if (pageSize > 0 && (memLen % pageSize))
+	{
+		HARKLE_ERROR(Memoroad, change_mmap_prot, Memory length is not page aligned);
+		retVal = EINVAL;
+	}
+	else if (newProt && 0 == (newProt & \
+			 (MROAD_PROT_NONE | MROAD_PROT_READ | MROAD_PROT_WRITE | \
+			  MROAD_PROT_EXEC | MROAD_PROT_SEM | MROAD_PROT_SAO | \
+			  MROAD_PROT_GROWSUP | MROAD_PROT_GROWSDOWN)))
+	{
+		HARKLE_ERROR(Memoroad, change_mmap_prot, Unrecognized protection setting);
+		retVal = EINVAL;
+	}
+	
+	// SYSTEM CALL
+	if (0 == retVal)
+	{
+		retVal = mprotect(mem_ptr, memLen, newProt);
+		
+		if (-1 == retVal)
+		{
+			retVal = errno;
+			HARKLE_ERROR(Memoroad, change_mmap_prot, mprotect failed);
+			HARKLE_ERRNO(Memoroad, mprotect, retVal);
+			// fprintf(stderr, "mprotect() returned errno:\t%s\n", strerror(retVal));
+		}
+		else
+		{
+			// fprintf(stdout, "[*] mprotect returned %d\n", retVal);  // DEBUGGING
+		}
+	}
+	
+	// DONE
+	return retVal;
+}
 
-		// ssize_t process_vm_readv(pid_t pid,
-		//                          const struct iovec *local_iov,
-		//                          unsigned long liovcnt,
-		//                          const struct iovec *remote_iov,
-		//                          unsigned long riovcnt,
-		//                          unsigned long flags);
-		pvrRetVal = process_vm_readv(pid, retVal, 1, remMem, 1, 0);
 
-		if (-1 == pvrRetVal)
+//////////////////////////////////////////////////////////////////////////////
+///////////////////////// MAPPED MEM FUNCTIONS STOP //////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////// MULTI-PATTERN FUNCTIONS START ///////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+memHunter_ptr build_mem_hunter(void** needle_arr, size_t* needleLen_arr, size_t numNeedles)
+{
+	// LOCAL VARIABLES
+	memHunter_ptr retVal = NULL;
+	bool success = true;  // Make this false if anything fails
+	size_t maxStates = 1;  // Upper bound on the number of states: every needle byte plus the root
+	int32_t* failLink = NULL;  // Per state: longest proper suffix state
+	int32_t* queue = NULL;  // Breadth-first work queue of states
+	size_t qHead = 0;  // Next state to pop from queue
+	size_t qTail = 0;  // Next empty slot in queue
+	size_t i = 0;  // Iterating variable
+	size_t j = 0;  // Iterating variable
+	int32_t currState = 0;  // Current state
+	int32_t nextState = 0;  // Transition target
+	int32_t* slot_ptr = NULL;  // Transition currently being updated
+	const unsigned char* needle_ptr = NULL;  // Current needle
+
+	// INPUT VALIDATION
+	if (!needle_arr || !needleLen_arr)
+	{
+		HARKLE_ERROR(Memoroad, build_mem_hunter, NULL pointer);
+		success = false;
+	}
+	else if (numNeedles < 1 || numNeedles > INT32_MAX)
+	{
+		HARKLE_ERROR(Memoroad, build_mem_hunter, Invalid number of needles);
+		success = false;
+	}
+	else
+	{
+		for (i = 0; i < numNeedles; i++)
 		{
-			errNum = errno;
-			HARKLE_ERROR(Memoroad, copy_remote_to_local, process_vm_readv failed);
-			HARKLE_ERRNO(Memoroad, process_vm_readv, errNum);
-			// fprintf(stderr, "process_vm_readv() returned errno:\t%s\n", strerror(errNum));
+			if (!needle_arr[i] || needleLen_arr[i] < 1)
+			{
+				HARKLE_ERROR(Memoroad, build_mem_hunter, Invalid needle);
+				success = false;
+				break;
+			}
+			maxStates += needleLen_arr[i];
+		}
+
+		if (true == success && maxStates > INT32_MAX / 256)
+		{
+			HARKLE_ERROR(Memoroad, build_mem_hunter, Needles are too large);
 			success = false;
 		}
-		else if (pvrRetVal != numBytes)
+	}
+
+	// ALLOCATE
+	if (true == success)
+	{
+		retVal = get_me_memory(sizeof(memHunter));
+		failLink = get_me_memory(maxStates * sizeof(int32_t));
+		queue = get_me_memory(maxStates * sizeof(int32_t));
+
+		if (retVal)
 		{
-			HARKLE_ERROR(Memoroad, copy_remote_to_local, process_vm_readv only made a partial read);
+			retVal->gotoTable = malloc(maxStates * 256 * sizeof(int32_t));
+			retVal->termNeedle = malloc(maxStates * sizeof(int32_t));
+			retVal->dictLink = get_me_memory(maxStates * sizeof(int32_t));
+			retVal->needleNext = malloc(numNeedles * sizeof(int32_t));
+			retVal->needleLen_arr = get_me_memory(numNeedles * sizeof(size_t));
+			retVal->numNeedles = numNeedles;
+		}
+
+		if (!retVal || !failLink || !queue || !retVal->gotoTable || !retVal->termNeedle || \
+			!retVal->dictLink || !retVal->needleNext || !retVal->needleLen_arr)
+		{
+			HARKLE_ERROR(Memoroad, build_mem_hunter, Allocation failed);
 			success = false;
 		}
+		else
+		{
+			memset(retVal->gotoTable, 0xFF, maxStates * 256 * sizeof(int32_t));  // -1
+			memset(retVal->termNeedle, 0xFF, maxStates * sizeof(int32_t));  // -1
+			memset(retVal->needleNext, 0xFF, numNeedles * sizeof(int32_t));  // -1
+			retVal->numStates = 1;  // Root
+		}
+	}
+
+	// BUILD THE TRIE
+	if (true == success)
+	{
+		for (i = 0; i < numNeedles; i++)
+		{
+			needle_ptr = needle_arr[i];
+			currState = 0;
+			retVal->needleLen_arr[i] = needleLen_arr[i];
+
+			for (j = 0; j < needleLen_arr[i]; j++)
+			{
+				slot_ptr = retVal->gotoTable + (currState * 256) + needle_ptr[j];
+
+				if (-1 == *slot_ptr)
+				{
+					*slot_ptr = retVal->numStates++;
+				}
+				currState = *slot_ptr;
+			}
+
+			// Duplicate needles end at the same state so chain them
+			retVal->needleNext[i] = retVal->termNeedle[currState];
+			retVal->termNeedle[currState] = i;
+		}
+	}
+
+	// FOLD FAILURE LINKS INTO THE TRANSITIONS (BREADTH FIRST)
+	if (true == success)
+	{
+		for (i = 0; i < 256; i++)
+		{
+			slot_ptr = retVal->gotoTable + i;
+
+			if (-1 == *slot_ptr)
+			{
+				*slot_ptr = 0;
+			}
+			else
+			{
+				failLink[*slot_ptr] = 0;
+				queue[qTail++] = *slot_ptr;
+			}
+		}
+
+		while (qHead < qTail)
+		{
+			currState = queue[qHead++];
+
+			for (i = 0; i < 256; i++)
+			{
+				slot_ptr = retVal->gotoTable + (currState * 256) + i;
+				nextState = retVal->gotoTable[(failLink[currState] * 256) + i];
+
+				if (-1 == *slot_ptr)
+				{
+					*slot_ptr = nextState;
+				}
+				else
+				{
+					failLink[*slot_ptr] = nextState;
+					retVal->dictLink[*slot_ptr] = (-1 != retVal->termNeedle[nextState]) ? \
+					                              nextState : retVal->dictLink[nextState];
+					queue[qTail++] = *slot_ptr;
+				}
+			}
+		}
 	}
 
 	// CLEAN UP
-	if (false == success)
+	if (failLink)
 	{
-		if (retVal)
+		free(failLink);
+	}
+
+	if (queue)
+	{
+		free(queue);
+	}
+
+	if (false == success && retVal)
+	{
+		if (false == free_mem_hunter(&retVal))
+		{
+			HARKLE_ERROR(Memoroad, build_mem_hunter, free_mem_hunter failed);
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+size_t mem_hunt_multi(memHunter_ptr hunter_ptr, void* haystack_ptr, size_t haystackLen, memHuntCallback callback, void* userData, int* errNum)
+{
+	// LOCAL VARIABLES
+	size_t retVal = 0;
+	bool success = true;  // Make this false if anything fails
+	const unsigned char* curr_ptr = haystack_ptr;  // Current haystack byte
+	const int32_t* gotoTable = NULL;  // Local copy of hunter_ptr->gotoTable
+	const int32_t* termNeedle = NULL;  // Local copy of hunter_ptr->termNeedle
+	const int32_t* dictLink = NULL;  // Local copy of hunter_ptr->dictLink
+	int32_t state = 0;  // Current automaton state
+	int32_t outState = 0;  // State currently being reported
+	int32_t needleID = 0;  // Needle currently being reported
+	size_t i = 0;  // Iterating variable
+
+	// INPUT VALIDATION
+	if (!errNum)
+	{
+		HARKLE_ERROR(Memoroad, mem_hunt_multi, NULL errNum pointer);
+		success = false;
+	}
+	else if (!hunter_ptr || !haystack_ptr || !callback)
+	{
+		HARKLE_ERROR(Memoroad, mem_hunt_multi, NULL pointer);
+		*errNum = EINVAL;
+		success = false;
+	}
+	else if (!hunter_ptr->gotoTable || !hunter_ptr->termNeedle || !hunter_ptr->dictLink)
+	{
+		HARKLE_ERROR(Memoroad, mem_hunt_multi, Invalid memHunter);
+		*errNum = EINVAL;
+		success = false;
+	}
+	else
+	{
+		*errNum = 0;
+		gotoTable = hunter_ptr->gotoTable;
+		termNeedle = hunter_ptr->termNeedle;
+		dictLink = hunter_ptr->dictLink;
+	}
+
+	// SCAN
+	if (true == success)
+	{
+		for (i = 0; i < haystackLen && true == success; i++)
+		{
+			state = gotoTable[(state * 256) + curr_ptr[i]];
+
+			// Fast path: nothing ends here
+			if (-1 == termNeedle[state] && 0 == dictLink[state])
+			{
+				continue;
+			}
+
+			// Report every needle ending at this state and its dictionary suffixes
+			for (outState = state; outState && true == success; outState = dictLink[outState])
+			{
+				for (needleID = termNeedle[outState]; -1 != needleID; needleID = hunter_ptr->needleNext[needleID])
+				{
+					retVal++;
+
+					if (false == callback(needleID, i + 1 - hunter_ptr->needleLen_arr[needleID], userData))
+					{
+						success = false;  // Caller asked to stop
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+size_t mem_hunt_multi_mapMem(memHunter_ptr hunter_ptr, mapMem_ptr haystack_ptr, memHuntCallback callback, void* userData, int* errNum)
+{
+	// LOCAL VARIABLES
+	size_t retVal = 0;
+
+	// INPUT VALIDATION
+	if (!errNum)
+	{
+		HARKLE_ERROR(Memoroad, mem_hunt_multi_mapMem, NULL errNum pointer);
+	}
+	else if (!haystack_ptr || !(haystack_ptr->fileMem_ptr))
+	{
+		HARKLE_ERROR(Memoroad, mem_hunt_multi_mapMem, NULL pointer);
+		*errNum = EINVAL;
+	}
+	else
+	{
+		retVal = mem_hunt_multi(hunter_ptr, haystack_ptr->fileMem_ptr, haystack_ptr->memSize, \
+		                        callback, userData, errNum);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+memHit_ptr mem_hunt_multi_arr(memHunter_ptr hunter_ptr, void* haystack_ptr, size_t haystackLen, size_t* numHits, int* errNum)
+{
+	// LOCAL VARIABLES
+	memHit_ptr retVal = NULL;
+	memHitCol collector = { NULL, 0, 0, false };
+
+	// INPUT VALIDATION
+	if (!numHits || !errNum)
+	{
+		HARKLE_ERROR(Memoroad, mem_hunt_multi_arr, NULL pointer);
+		if (errNum)
+		{
+			*errNum = EINVAL;
+		}
+	}
+	else
+	{
+		*numHits = 0;
+		mem_hunt_multi(hunter_ptr, haystack_ptr, haystackLen, collect_mem_hit, &collector, errNum);
+
+		if (true == collector.failed)
+		{
+			HARKLE_ERROR(Memoroad, mem_hunt_multi_arr, collect_mem_hit failed);
+			*errNum = ENOMEM;
+		}
+
+		if (0 == *errNum)
 		{
-			if (false == free_iovec_struct(&retVal, true))
-			{
-				HARKLE_ERROR(Memoroad, copy_remote_to_local, free_iovec_struct failed);
-			}
+			retVal = collector.hit_arr;
+			*numHits = collector.numHits;
+		}
+		else if (collector.hit_arr)
+		{
+			free(collector.hit_arr);
 		}
 	}
 
@@ -583,138 +1916,84 @@ struct iovec* copy_remote_to_local(pid_t pid, void* remoteMem, size_t numBytes)
 }
 
 
-int copy_local_to_remote(pid_t pid, void* remoteMem, void* localMem, size_t numBytes)
+bool collect_mem_hit(size_t needleID, size_t offset, void* userData)
 {
 	// LOCAL VARIABLES
-	int retVal = 0;
-	bool success = true;  // Make this false if anything fails
-	int numTries = 0;  // Keep count of allocation attempts
-	ssize_t pvwRetVal = 0;  // Return value from process_vm_writev() call
-	struct iovec locMem[1];  // iovec struct array to hold the local memory info
-	struct iovec remMem[1];  // iovec struct array to hold the remote memory info
+	bool retVal = true;
+	memHitCol_ptr col_ptr = (memHitCol_ptr)userData;
+	memHit_ptr tmp_arr = NULL;  // Return value from realloc()
+	size_t newSize = 0;  // New capacity of the array
 
-	// INPUT VALIDATION
-	if (pid < 1)
-	{
-		HARKLE_ERROR(Memoroad, copy_local_to_remote, Invalid PID);
-		success = false;
-	}
-	else if (!remoteMem || !localMem)
-	{
-		HARKLE_ERROR(Memoroad, copy_local_to_remote, NULL pointer);
-		success = false;
-	}
-	else if (numBytes < 1)
-	{
-		HARKLE_ERROR(Memoroad, copy_local_to_remote, Invalid number of bytes);
-		success = false;
-	}
-	
-	// COPY THE MEMORY
-	if (true == success)
+	// GROW
+	if (col_ptr->numHits == col_ptr->arrSize)
 	{
-		// Prepare the local struct pointer
-		locMem[0].iov_base = localMem;
-		locMem[0].iov_len = numBytes;
-		
-		// Prepare the remote struct pointer
-		remMem[0].iov_base = remoteMem;
-		remMem[0].iov_len = numBytes;
+		newSize = col_ptr->arrSize ? col_ptr->arrSize * 2 : 64;
+		tmp_arr = realloc(col_ptr->hit_arr, newSize * sizeof(memHit));
 
-		// ssize_t process_vm_writev(pid_t pid,
-		//                           const struct iovec *local_iov,
-		//                           unsigned long liovcnt,
-		//                           const struct iovec *remote_iov,
-		//                           unsigned long riovcnt,
-		//                           unsigned long flags);
-		pvwRetVal = process_vm_writev(pid, locMem, 1, remMem, 1, 0);
-		
-		if (-1 == pvwRetVal)
+		if (!tmp_arr)
 		{
-			retVal = errno;
-			HARKLE_ERROR(Memoroad, copy_local_to_remote, process_vm_writev failed);
-			HARKLE_ERRNO(Memoroad, process_vm_writev, retVal);
-			// fprintf(stderr, "process_vm_writev() returned errno:\t%s\n", strerror(retVal));
-			success = false;
+			col_ptr->failed = true;
+			retVal = false;
 		}
-		else if (pvwRetVal != numBytes)
+		else
 		{
-			HARKLE_ERROR(Memoroad, copy_local_to_remote, process_vm_writev only made a partial write);
-			success = false;
+			col_ptr->hit_arr = tmp_arr;
+			col_ptr->arrSize = newSize;
 		}
 	}
-	
+
+	// APPEND
+	if (true == retVal)
+	{
+		col_ptr->hit_arr[col_ptr->numHits].needleID = needleID;
+		col_ptr->hit_arr[col_ptr->numHits].offset = offset;
+		col_ptr->numHits++;
+	}
+
 	// DONE
 	return retVal;
 }
 
 
-//////////////////////////////////////////////////////////////////////////////
-//////////////////////// MEM TRANSFER FUNCTIONS STOP /////////////////////////
-//////////////////////////////////////////////////////////////////////////////
-
-
-//////////////////////////////////////////////////////////////////////////////
-///////////////////////// MAPPED MEM FUNCTIONS START /////////////////////////
-//////////////////////////////////////////////////////////////////////////////
-
-
-int change_mmap_prot(void* mem_ptr, size_t memLen, int newProt)
+bool free_mem_hunter(memHunter_ptr* oldHunter_ptr)
 {
 	// LOCAL VARIABLES
-	int retVal = 0;
-	long pageSize = get_page_size();
-	
+	bool retVal = true;
+	memHunter_ptr hunter_ptr = NULL;  // Easier to deal with it this way
+
 	// INPUT VALIDATION
-	if (!mem_ptr)
-	{
-		HARKLE_ERROR(Memoroad, change_mmap_prot, NULL pointer);
-		retVal = EINVAL;
-	}
-	else if (memLen < 1)
-	{
-		HARKLE_ERROR(Memoroad, change_mmap_prot, Invalid page length);
-		retVal = EINVAL;
-	}
-	else if (pageSize > 0 && (memLen % pageSize))
-	{
-		HARKLE_ERROR(Memoroad, change_mmap_prot, Memory length is not page aligned);
-		retVal = EINVAL;
-	}
-	else if (newProt && 0 == (newProt & \
-			 (MROAD_PROT_NONE | MROAD_PROT_READ | MROAD_PROT_WRITE | \
-			  MROAD_PROT_EXEC | MROAD_PROT_SEM | MROAD_PROT_SAO | \
-			  MROAD_PROT_GROWSUP | MROAD_PROT_GROWSDOWN)))
+	if (!oldHunter_ptr || !(*oldHunter_ptr))
 	{
-		HARKLE_ERROR(Memoroad, change_mmap_prot, Unrecognized protection setting);
-		retVal = EINVAL;
+		HARKLE_ERROR(Memoroad, free_mem_hunter, NULL pointer);
+		retVal = false;
 	}
-	
-	// SYSTEM CALL
-	if (0 == retVal)
+	else
 	{
-		retVal = mprotect(mem_ptr, memLen, newProt);
-		
-		if (-1 == retVal)
-		{
-			retVal = errno;
-			HARKLE_ERROR(Memoroad, change_mmap_prot, mprotect failed);
-			HARKLE_ERRNO(Memoroad, mprotect, retVal);
-			// fprintf(stderr, "mprotect() returned errno:\t%s\n", strerror(retVal));
-		}
-		else
-		{
-			// fprintf(stdout, "[*] mprotect returned %d\n", retVal);  // DEBUGGING
-		}
+		hunter_ptr = *oldHunter_ptr;
+
+		// 1. Free the tables
+		free(hunter_ptr->gotoTable);
+		free(hunter_ptr->termNeedle);
+		free(hunter_ptr->dictLink);
+		free(hunter_ptr->needleNext);
+		free(hunter_ptr->needleLen_arr);
+
+		// 2. Free the struct
+		memset(hunter_ptr, MEMSET_DEFAULT, sizeof(memHunter));
+		free(hunter_ptr);
+
+		// 3. NULL the pointer
+		hunter_ptr = NULL;
+		*oldHunter_ptr = NULL;
 	}
-	
+
 	// DONE
 	return retVal;
 }
 
 
 //////////////////////////////////////////////////////////////////////////////
-///////////////////////// MAPPED MEM FUNCTIONS STOP //////////////////////////
+//////////////////////// MULTI-PATTERN FUNCTIONS STOP ////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
 
@@ -759,13 +2038,39 @@ long get_page_size(void)
 }
 
 
+size_t get_thread_count(int numThreads, size_t maxThreads, size_t numTasks, size_t minPerThread)
+{
+	// LOCAL VARIABLES
+	size_t retVal = numThreads > 0 ? (size_t)numThreads : 0;
+	long numCPUs = 0;  // Return value from sysconf()
+
+	// ONE PER CPU
+	if (0 == retVal)
+	{
+		numCPUs = sysconf(_SC_NPROCESSORS_ONLN);
+		retVal = numCPUs > 0 ? (size_t)numCPUs : 1;
+	}
+
+	// CAPS
+	if (retVal > maxThreads)
+	{
+		retVal = maxThreads;
+	}
+	if (minPerThread > 0 && retVal > numTasks / minPerThread)
+	{
+		retVal = numTasks / minPerThread;
+	}
+
+	// DONE
+	return retVal > 0 ? retVal : 1;
+}
+
+
 void* mem_hunt(void* haystack_ptr, void* needle_ptr, size_t haystackLen, size_t needleLen)
 {
 	// LOCAL VARIABLES
 	void* retVal = NULL;
 	bool success = true;  // Make this false if anything fails
-	void* tempRetVal = NULL;  // Store string.h function calls here
-	int i = 0;  // Iterating variable
 	
 	// INPUT VALIDATION
 	if (!haystack_ptr || !needle_ptr)
@@ -779,43 +2084,236 @@ void* mem_hunt(void* haystack_ptr, void* needle_ptr, size_t haystackLen, size_t
 		success = false;
 	}
 
-	// fprintf(stdout, "needleLen is %zu\n", needleLen);  // DEBUGGING
-	// for (int i = 0; i < needleLen; i++)
-	// {
-	// 	fprintf(stdout, "%02X", (*(((unsigned char*)needle_ptr) + i)));
-	// }
-	// fprintf(stdout, "\n");
-
-	// for (int i = 0; i < haystackLen; i++)
-	// {
-	// 	fprintf(stdout, "%02X", (*(((unsigned char*)haystack_ptr) + i)));
-	// }
-	// fprintf(stdout, "\n");
-
 	
 	// FIND IT
 	if (true == success)
 	{
-		for (i = 0; i <= (haystackLen - needleLen); i++)
+		if (1 == needleLen)
+		{
+			retVal = memchr(haystack_ptr, *((unsigned char*)needle_ptr), haystackLen);
+		}
+		else if (needleLen < MROAD_HUNT_LONG_NEEDLE)
+		{
+			retVal = mroadHuntEngine(haystack_ptr, needle_ptr, haystackLen, needleLen);
+		}
+		else
+		{
+			retVal = mem_hunt_bmh(haystack_ptr, needle_ptr, haystackLen, needleLen);
+		}
+	}
+	
+	// DONE
+	return retVal;
+}
+
+
+void* mem_hunt_memchr(const unsigned char* haystack_ptr, const unsigned char* needle_ptr, size_t haystackLen, size_t needleLen)
+{
+	// LOCAL VARIABLES
+	void* retVal = NULL;
+	const unsigned char* curr_ptr = haystack_ptr;  // Current candidate
+	const unsigned char* last_ptr = NULL;  // Last offset the needle could start at
+
+	if (needleLen > 0 && needleLen <= haystackLen)
+	{
+		last_ptr = haystack_ptr + (haystackLen - needleLen);
+
+		while (curr_ptr <= last_ptr)
 		{
-			if (0 == memcmp(haystack_ptr + i, needle_ptr, needleLen))
+			// Skip to the next occurrence of the first byte
+			curr_ptr = memchr(curr_ptr, *needle_ptr, last_ptr - curr_ptr + 1);
+
+			if (!curr_ptr)
+			{
+				break;
+			}
+			else if (0 == memcmp(curr_ptr + 1, needle_ptr + 1, needleLen - 1))
 			{
-				retVal = haystack_ptr + i;
+				retVal = (void*)curr_ptr;
 				break;
 			}
+			curr_ptr++;
 		}
 	}
-	
+
+	// DONE
+	return retVal;
+}
+
+
+void* mem_hunt_bmh(const unsigned char* haystack_ptr, const unsigned char* needle_ptr, size_t haystackLen, size_t needleLen)
+{
+	// LOCAL VARIABLES
+	void* retVal = NULL;
+	size_t skipTable[256];  // Bad character shift table
+	size_t i = 0;  // Iterating variable
+	size_t lastIndex = needleLen - 1;  // Index of the needle's last byte
+	unsigned char lastByte = needle_ptr[lastIndex];  // The needle's last byte
+	unsigned char currByte = 0;  // Haystack byte aligned with the needle's last byte
+
+	// BUILD THE SKIP TABLE
+	for (i = 0; i < 256; i++)
+	{
+		skipTable[i] = needleLen;
+	}
+
+	for (i = 0; i < lastIndex; i++)
+	{
+		skipTable[needle_ptr[i]] = lastIndex - i;
+	}
+
+	// FIND IT
+	i = 0;
+	while (i <= haystackLen - needleLen)
+	{
+		currByte = haystack_ptr[i + lastIndex];
+
+		if (currByte == lastByte && 0 == memcmp(haystack_ptr + i, needle_ptr, lastIndex))
+		{
+			retVal = (void*)(haystack_ptr + i);
+			break;
+		}
+		i += skipTable[currByte];
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+#ifdef MROAD_HUNT_X86
+void* mem_hunt_sse2(const unsigned char* haystack_ptr, const unsigned char* needle_ptr, size_t haystackLen, size_t needleLen)
+{
+	// LOCAL VARIABLES
+	void* retVal = NULL;
+	size_t i = 0;  // Haystack offset of the current block
+	size_t lastIndex = needleLen - 1;  // Index of the needle's last byte
+	unsigned int mask = 0;  // One bit per candidate offset in the current block
+	unsigned int bitPos = 0;  // Candidate offset within the current block
+	__m128i firstVec = _mm_set1_epi8((char)needle_ptr[0]);
+	__m128i lastVec = _mm_set1_epi8((char)needle_ptr[lastIndex]);
+	__m128i firstBlock;  // 16 haystack bytes lined up with the needle's first byte
+	__m128i lastBlock;  // 16 haystack bytes lined up with the needle's last byte
+
+	// FIND IT
+	for (i = 0; i + 16 + lastIndex <= haystackLen; i += 16)
+	{
+		firstBlock = _mm_loadu_si128((const __m128i*)(haystack_ptr + i));
+		lastBlock = _mm_loadu_si128((const __m128i*)(haystack_ptr + i + lastIndex));
+		mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(firstVec, firstBlock), \
+		                                                     _mm_cmpeq_epi8(lastVec, lastBlock)));
+
+		while (mask)
+		{
+			bitPos = __builtin_ctz(mask);
+
+			if (0 == memcmp(haystack_ptr + i + bitPos + 1, needle_ptr + 1, lastIndex - 1))
+			{
+				retVal = (void*)(haystack_ptr + i + bitPos);
+				break;
+			}
+			mask &= mask - 1;  // Clear the lowest set bit
+		}
+
+		if (retVal)
+		{
+			break;
+		}
+	}
+
+	// TAIL
+	if (!retVal && i < haystackLen)
+	{
+		retVal = mem_hunt_memchr(haystack_ptr + i, needle_ptr, haystackLen - i, needleLen);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+void* mem_hunt_avx2(const unsigned char* haystack_ptr, const unsigned char* needle_ptr, size_t haystackLen, size_t needleLen)
+{
+	// LOCAL VARIABLES
+	void* retVal = NULL;
+	size_t i = 0;  // Haystack offset of the current block
+	size_t lastIndex = needleLen - 1;  // Index of the needle's last byte
+	unsigned int mask = 0;  // One bit per candidate offset in the current block
+	unsigned int bitPos = 0;  // Candidate offset within the current block
+	__m256i firstVec = _mm256_set1_epi8((char)needle_ptr[0]);
+	__m256i lastVec = _mm256_set1_epi8((char)needle_ptr[lastIndex]);
+	__m256i firstBlock;  // 32 haystack bytes lined up with the needle's first byte
+	__m256i lastBlock;  // 32 haystack bytes lined up with the needle's last byte
+
+	// FIND IT
+	for (i = 0; i + 32 + lastIndex <= haystackLen; i += 32)
+	{
+		firstBlock = _mm256_loadu_si256((const __m256i*)(haystack_ptr + i));
+		lastBlock = _mm256_loadu_si256((const __m256i*)(haystack_ptr + i + lastIndex));
+		mask = (unsigned int)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(firstVec, firstBlock), \
+		                                                           _mm256_cmpeq_epi8(lastVec, lastBlock)));
+
+		while (mask)
+		{
+			bitPos = __builtin_ctz(mask);
+
+			if (0 == memcmp(haystack_ptr + i + bitPos + 1, needle_ptr + 1, lastIndex - 1))
+			{
+				retVal = (void*)(haystack_ptr + i + bitPos);
+				break;
+			}
+			mask &= mask - 1;  // Clear the lowest set bit
+		}
+
+		if (retVal)
+		{
+			break;
+		}
+	}
+
+	// TAIL
+	if (!retVal && i < haystackLen)
+	{
+		retVal = mem_hunt_memchr(haystack_ptr + i, needle_ptr, haystackLen - i, needleLen);
+	}
+
 	// DONE
 	return retVal;
 }
 
 
+void pick_mem_hunt_engine(void)
+{
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx2"))
+	{
+		mroadHuntEngine = mem_hunt_avx2;
+	}
+	else if (__builtin_cpu_supports("sse2"))
+	{
+		mroadHuntEngine = mem_hunt_sse2;
+	}
+}
+#endif  // MROAD_HUNT_X86
+
+
 void *harkleset(void *s, int c, size_t n)
 {
-	// return memset(s, c, n);
-	void *(*func_ptr)(void*, int, size_t) = memset;
-	return func_ptr(s, c, n);
+	// LOCAL VARIABLES
+	void* retVal = memset(s, c, n);  // Plain memset() so it inlines and uses wide stores
+
+#ifdef __GNUC__
+	// Compiler barrier: claims to read s so the memset() is never a dead store
+	__asm__ __volatile__("" : : "r"(s) : "memory");
+#else
+	// Fall back to calling memset through a volatile function pointer
+	void *(*volatile func_ptr)(void*, int, size_t) = memset;
+	retVal = func_ptr(s, c, n);
+#endif  // __GNUC__
+
+	// DONE
+	return retVal;
 }
 
 
@@ -4,9 +4,13 @@
 #define _GNU_SOURCE							// process_vm_readv() and process_vm_writev() are only available when GNU extensions are enabled
 #include <stdbool.h>						// bool, true, false
 #include <stddef.h>							// size_t
+#include <stdint.h>							// int32_t
 #include <sys/mman.h>						// PROT_* MACROS
 #include <sys/uio.h>						// struct iovec
 
+// Map_Memory's mapMem (see: mem_hunt_multi_mapMem())
+struct mappedMemory;
+
 /* change_mmap_prot() "newProt" MACRO FLAGS */
 // MROAD_PROT_NONE
 #ifdef PROT_NONE
@@ -64,6 +68,67 @@
 #define MROAD_PROT_GROWSDOWN 0
 #endif  // PROT_GROWSDOWN
 
+// Compiled multi-needle matcher (Aho-Corasick automaton)
+typedef struct memHuntAutomaton
+{
+	int32_t* gotoTable;					// numStates * 256 transitions, failures already folded in
+	int32_t* termNeedle;				// Per state: first needle ID ending here, -1 if none
+	int32_t* dictLink;					// Per state: nearest suffix state with a needle, 0 if none
+	int32_t* needleNext;				// Per needle: next needle ID ending at the same state, -1 if none
+	size_t* needleLen_arr;				// Per needle: length
+	size_t numStates;					// Number of states in the automaton
+	size_t numNeedles;					// Number of needles compiled in
+} memHunter, *memHunter_ptr;
+
+// A single multi-needle match
+typedef struct memHuntHit
+{
+	size_t needleID;					// Index of the needle in the array it was built from
+	size_t offset;						// Offset of the match into the haystack
+} memHit, *memHit_ptr;
+
+// One contiguous region of a memArena
+typedef struct memoroadArenaBlock
+{
+	struct memoroadArenaBlock* next;	// Next block in the arena, NULL if last
+	size_t blockSize;					// Usable bytes in data
+	size_t used;						// Bytes of data handed out
+	_Alignas(max_align_t) unsigned char data[];	// Storage
+} memBlock, *memBlock_ptr;
+
+// Region (bump) allocator
+typedef struct memoroadArena
+{
+	memBlock_ptr first;					// First block, NULL until the first allocation
+	memBlock_ptr current;				// Block allocations are currently bumped from
+	size_t blockSize;					// Default size of new blocks
+} memArena, *memArena_ptr;
+
+// One slot of a memStrSet
+typedef struct memoroadStringSlot
+{
+	uint64_t hash;						// Hash of str
+	const char* str;					// Member string, NULL if the slot is empty
+} memStrSlot, *memStrSlot_ptr;
+
+// Open-addressed hash set of nul-terminated strings
+typedef struct memoroadStringSet
+{
+	memStrSlot_ptr slot_arr;			// numSlots slots, linear probing
+	size_t numSlots;					// Always a power of two
+	size_t numStrings;					// Number of occupied slots
+	memArena_ptr arena_ptr;				// Interned copies live here, NULL if the set borrows its strings
+} memStrSet, *memStrSet_ptr;
+
+/*
+	mem_hunt_multi() callback
+		needleID - Index of the needle that matched
+		offset - Offset of the match into the haystack
+		userData - Passed through from mem_hunt_multi()
+	Return true to keep scanning, false to stop
+ */
+typedef bool (*memHuntCallback)(size_t needleID, size_t offset, void* userData);
+
 //////////////////////////////////////////////////////////////////////////////
 ///////////////////////// ALLOCATION FUNCTIONS START /////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -136,6 +201,168 @@ struct iovec* allocate_iovec_struct(void);
 ///////////////////////// ALLOCATION FUNCTIONS STOP //////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
+//////////////////////////////////////////////////////////////////////////////
+/////////////////////////// ARENA FUNCTIONS START ////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+/*
+	Purpose - Allocate a region allocator that hands out memory by bumping a
+		pointer through large blocks
+	Input
+		blockSize - Size of each block, 0 for MROAD_ARENA_BLOCK_SIZE
+	Output
+		On success, a heap-allocated memArena struct pointer
+		On failure, NULL
+	Notes:
+		Memory handed out by the arena is never free()d individually.  Use
+			reset_mem_arena() or free_mem_arena() to release all of it at once.
+		Blocks are allocated lazily
+		It is the caller's responsibility to call free_mem_arena()
+ */
+memArena_ptr create_mem_arena(size_t blockSize);
+
+
+/*
+	Purpose - Allocate length bytes from an arena
+	Input
+		arena_ptr - Arena to allocate from
+		length - The length of what you want to store
+		zeroize - If true, the memory is memset to 0 (like get_me_memory())
+	Output
+		On success, a pointer aligned for any type
+		On failure, NULL
+	Notes:
+		Requests larger than the arena's blockSize get a dedicated block
+ */
+void* arena_get_memory(memArena_ptr arena_ptr, size_t length, bool zeroize);
+
+
+/*
+	Purpose - Arena version of get_me_a_buffer()
+	Input
+		arena_ptr - Arena to allocate from
+		length - The length of what you want to store
+	Output - Zeroized character array of size length + 1 on success, NULL on failure
+ */
+char* arena_get_a_buffer(memArena_ptr arena_ptr, size_t length);
+
+
+/*
+	Purpose - Arena version of get_me_a_buffer_array()
+	Input
+		arena_ptr - Arena to allocate from
+		arraySize - Number of char*s to include in the array
+		nullTerm - true if this array is to be NULL terminated
+	Output - Zeroized char* array on success, NULL on failure
+	Notes:
+		Do NOT call free_char_arr() on the return value
+ */
+char** arena_get_a_buffer_array(memArena_ptr arena_ptr, size_t arraySize, bool nullTerm);
+
+
+/*
+	Purpose - Arena version of copy_a_string()
+	Input
+		arena_ptr - Arena to allocate from
+		char_ptr - Nul-terminated character array
+	Output - An arena-allocated copy of char_ptr on success, NULL on failure
+	Notes:
+		Do NOT call release_a_string() on the return value
+ */
+char* arena_copy_a_string(memArena_ptr arena_ptr, const char* char_ptr);
+
+
+/*
+	Purpose - Release everything allocated from an arena at once while keeping
+		its blocks for reuse
+	Input
+		arena_ptr - Arena to reset
+		secureWipe - If true, every byte handed out is zeroized first
+	Output - On success, true.  Otherwise, false.
+	Notes:
+		All pointers previously returned by the arena become invalid
+ */
+bool reset_mem_arena(memArena_ptr arena_ptr, bool secureWipe);
+
+
+/*
+	Purpose - Zeroize (every block's full capacity) and free an arena and all of its blocks
+	Input
+		oldArena_ptr - Pointer to a memArena struct pointer
+	Output - On success, true.  Otherwise, false.
+	Notes:
+		*oldArena_ptr will be NULLed
+ */
+bool free_mem_arena(memArena_ptr* oldArena_ptr);
+
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////// ARENA FUNCTIONS STOP ////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+///////////////////////// STRING SET FUNCTIONS START /////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+/*
+	Purpose - Allocate a hash set of strings with O(1) expected membership tests
+	Input
+		numExpected - Number of strings the set should hold without growing, 0 for a default
+		internCopies - If true, the set keeps its own copies of the strings in a
+			memArena.  If false, the set stores the caller's pointers, which must
+			outlive the set.
+	Output
+		On success, a heap-allocated memStrSet struct pointer
+		On failure, NULL
+	Notes:
+		It is the caller's responsibility to call free_mem_str_set()
+ */
+memStrSet_ptr create_mem_str_set(size_t numExpected, bool internCopies);
+
+
+/*
+	Purpose - Add a string to a set, unless it's already there
+	Input
+		set_ptr - Set to add to
+		char_ptr - Nul-terminated string
+		isNew - [OUT] Optional.  true if char_ptr was added, false if it was
+			already a member.
+	Output
+		On success, the set's copy of the string (the interned pointer)
+		On failure, NULL
+	Notes:
+		The set doubles once it is half full
+ */
+const char* str_set_add(memStrSet_ptr set_ptr, const char* char_ptr, bool* isNew);
+
+
+/*
+	Purpose - Test a set for a string
+	Input
+		set_ptr - Set to search
+		char_ptr - Nul-terminated string
+	Output - true if char_ptr is a member, false otherwise
+ */
+bool str_set_contains(memStrSet_ptr set_ptr, const char* char_ptr);
+
+
+/*
+	Purpose - Zeroize and free a set, to include any interned copies
+	Input
+		oldSet_ptr - Pointer to a memStrSet struct pointer
+	Output - On success, true.  Otherwise, false.
+	Notes:
+		*oldSet_ptr will be NULLed
+ */
+bool free_mem_str_set(memStrSet_ptr* oldSet_ptr);
+
+
+//////////////////////////////////////////////////////////////////////////////
+////////////////////////// STRING SET FUNCTIONS STOP /////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////////// FREE FUNCTIONS START ////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -148,6 +375,8 @@ struct iovec* allocate_iovec_struct(void);
 	Output - On success, true. Otherwise, false.
 	Notes:
 		Will attempt to memset, free, and NULL "&char_ptr"
+		The entire allocation (see: malloc_usable_size()) is wiped, not just
+			the string, so no strlen() is needed
 		Call this function like this:
 			release_a_string(&myCharArray);
  */
@@ -175,6 +404,8 @@ bool release_a_string_len(char** charPtr_ptr, size_t buffSize);
 	Output - true on success, false on failure
 	Notes:
 		All C-strings will be memset to 0, free()d, and made NULL
+		Each string is handled in a single pass: its whole allocation (see:
+			malloc_usable_size()) is wiped without calling strlen() first
 		The array of C-strings will then be free()d and made NULL
  */
 bool free_char_arr(char*** charArr_ptr);
@@ -227,6 +458,53 @@ bool free_iovec_struct(struct iovec** oldStruct_ptr, bool freeAll);
 struct iovec* copy_remote_to_local(pid_t pid, void* remoteMem, size_t numBytes);
 
 
+/*
+	Purpose - Copy many remote ranges from "pid"s memory into caller-supplied
+		buffers using as few process_vm_readv() calls as possible
+	Input
+		pid - PID from which to copy the memory
+		local_arr - Array of numRanges local buffers.  local_arr[i].iov_len must
+			be at least remote_arr[i].iov_len.
+		remote_arr - Array of numRanges remote ranges to copy
+		numRanges - Number of ranges in local_arr and remote_arr
+		bytesRead_arr [Out][Optional] - Array of numRanges counts of the bytes
+			actually copied into each local buffer
+	Output
+		0 if every range was copied in full
+		EFAULT if one or more ranges could only be partially copied (or not at
+			all), see bytesRead_arr for the details
+		On failure, the errno set by process_vm_readv() (or EINVAL)
+	Notes:
+		Up to MROAD_IOV_BATCH (IOV_MAX) ranges are copied per system call
+		A range that faults part way through (e.g., an unmapped page) is
+			recorded as a partial read and the copy resumes with the next range
+		No memory is allocated by this function
+ */
+int copy_remote_to_local_vec(pid_t pid, struct iovec* local_arr, struct iovec* remote_arr, size_t numRanges, size_t* bytesRead_arr);
+
+
+/*
+	Purpose - Copy many remote ranges from "pid"s memory into a single pooled
+		buffer allocation
+	Input
+		pid - PID from which to copy the memory
+		remote_arr - Array of numRanges remote ranges to copy
+		local_arr [Out] - Array of numRanges iovec structs that will be pointed
+			at each range's slice of the pool
+		numRanges - Number of ranges in local_arr and remote_arr
+		bytesRead_arr [Out][Optional] - See copy_remote_to_local_vec()
+		errNum [Out] - The return value of copy_remote_to_local_vec(), ENOMEM,
+			EINVAL, or EOVERFLOW (the ranges' total length won't fit in a size_t)
+	Output
+		On success, the heap-allocated pool all of local_arr points into
+		On failure, NULL
+	Notes:
+		Partial reads still return the pool with errNum set to EFAULT
+		It is the caller's responsibility to free() the pool (only the pool)
+ */
+void* copy_remote_ranges(pid_t pid, struct iovec* remote_arr, struct iovec* local_arr, size_t numRanges, size_t* bytesRead_arr, int* errNum);
+
+
 /*
 	Purpose - Copy "numBytes" from localMem to "pid"s memory location at remoteMem
 	Input
@@ -272,6 +550,98 @@ int change_mmap_prot(void* mem_ptr, size_t memLen, int newProt);
 //////////////////////////////////////////////////////////////////////////////
 
 
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////// MULTI-PATTERN FUNCTIONS START ///////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
+/*
+	Purpose - Compile an array of needles into a single matcher so any number of
+		signatures can be found in one pass over a haystack
+	Input
+		needle_arr - Array of numNeedles pointers to needles
+		needleLen_arr - Array of numNeedles needle lengths
+		numNeedles - Number of needles
+	Output
+		On success, a heap-allocated memHunter struct pointer
+		On failure, NULL
+	Notes:
+		The needles are not referenced after this function returns
+		Each state gets a dense 256-entry goto row (1 KiB), and there can be
+			one state per needle byte, so memory grows with the total length
+			of the needles, not with how many there are
+		Needle IDs reported by mem_hunt_multi() are indices into needle_arr
+		It is the caller's responsibility to call free_mem_hunter()
+ */
+memHunter_ptr build_mem_hunter(void** needle_arr, size_t* needleLen_arr, size_t numNeedles);
+
+
+/*
+	Purpose - Report every occurrence of every needle in a haystack in a single pass
+	Input
+		hunter_ptr - Matcher built by build_mem_hunter()
+		haystack_ptr - A pointer to a memory area of length haystackLen
+		haystackLen - The size of the memory area haystack_ptr points to
+		callback - Called once per (needleID, offset) hit, in haystack order
+		userData - Passed to callback
+		errNum [Out] - Pointer to an integer in which to store errno on error
+	Output
+		On success, the number of hits reported to callback and errNum is 0
+		On failure, 0 and errNum is set
+	Notes:
+		Overlapping matches are all reported
+		Scanning stops early if callback returns false
+ */
+size_t mem_hunt_multi(memHunter_ptr hunter_ptr, void* haystack_ptr, size_t haystackLen, memHuntCallback callback, void* userData, int* errNum);
+
+
+/*
+	Purpose - Wrap mem_hunt_multi() for a Map_Memory mappedMemory struct (e.g., map_file())
+	Input
+		hunter_ptr - Matcher built by build_mem_hunter()
+		haystack_ptr - Mapped memory to scan
+		callback - Called once per (needleID, offset) hit, in haystack order
+		userData - Passed to callback
+		errNum [Out] - Pointer to an integer in which to store errno on error
+	Output - See mem_hunt_multi()
+ */
+size_t mem_hunt_multi_mapMem(memHunter_ptr hunter_ptr, struct mappedMemory* haystack_ptr, memHuntCallback callback, void* userData, int* errNum);
+
+
+/*
+	Purpose - Collect every mem_hunt_multi() hit into an array
+	Input
+		hunter_ptr - Matcher built by build_mem_hunter()
+		haystack_ptr - A pointer to a memory area of length haystackLen
+		haystackLen - The size of the memory area haystack_ptr points to
+		numHits [Out] - Number of memHit structs in the array returned
+		errNum [Out] - Pointer to an integer in which to store errno on error
+	Output
+		On success, a heap-allocated array of *numHits memHit structs in haystack
+			order, or NULL if nothing was found (*numHits is 0 and errNum is 0)
+		On failure, NULL and errNum is set
+	Notes:
+		It is the caller's responsibility to free() the array
+ */
+memHit_ptr mem_hunt_multi_arr(memHunter_ptr hunter_ptr, void* haystack_ptr, size_t haystackLen, size_t* numHits, int* errNum);
+
+
+/*
+	Purpose - Free a matcher built by build_mem_hunter()
+	Input
+		oldHunter_ptr - Pointer to a memHunter struct pointer
+	Output - On success, true.  Otherwise, false.
+	Notes:
+		*oldHunter_ptr will be NULLed
+ */
+bool free_mem_hunter(memHunter_ptr* oldHunter_ptr);
+
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////// MULTI-PATTERN FUNCTIONS STOP ////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// HELPER FUNCTIONS START ///////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -294,6 +664,18 @@ int change_mmap_prot(void* mem_ptr, size_t memLen, int newProt);
 long get_page_size(void);
 
 
+/*
+	Purpose - Decide how many threads to split numTasks units of work across
+	Input
+		numThreads - Number of threads asked for, less than 1 for one-per-CPU
+		maxThreads - Most threads the caller can run
+		numTasks - Units of work to split
+		minPerThread - Fewest units of work worth a thread of their own, 0 for no minimum
+	Output - The number of threads to use (including the calling thread), always at least 1
+ */
+size_t get_thread_count(int numThreads, size_t maxThreads, size_t numTasks, size_t minPerThread);
+
+
 /*
 	Purpose - Match a snippet of memory (needle) in a larger 'blob' of memory
 	Input
@@ -310,6 +692,11 @@ long get_page_size(void);
 	Notes:
 		If this function sounds like strstr() and memcmp() had a child, then you
 			understand what I'm trying to do here.
+		The search strategy is picked by needle length:
+			1 byte - memchr()
+			Less than MROAD_HUNT_LONG_NEEDLE - SIMD first/last byte candidate
+				filter (AVX2 or SSE2, chosen at runtime) or a memchr() skip
+			Everything else - Boyer-Moore-Horspool
  */
 void* mem_hunt(void* haystack_ptr, void* needle_ptr, size_t haystackLen, size_t needleLen);
 
@@ -323,6 +710,10 @@ void* mem_hunt(void* haystack_ptr, void* needle_ptr, size_t haystackLen, size_t
 		c - Constant byte to set the memory area "s" to
 		n - Number of bytes to set
 	Output - A pointer to the memory area "s" on success.
+	Notes:
+		memset() is called directly, so it runs at full (vectorized) bandwidth,
+			followed by an empty asm statement with a "memory" clobber that
+			the compiler must assume reads "s"
  */
 void *harkleset(void* s, int c, size_t n);
 
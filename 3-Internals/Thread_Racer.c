@@ -8,8 +8,8 @@
 #include "Harklecurse.h"			// hcCartCoord_ptr
 #include "Harklerror.h"				// HARKLE_ERROR
 #include "Harklethread.h"			// hThrDetails_ptr
-#include <stdlib.h>					// calloc()
-#include <string.h>					// strlen()
+#include <stdlib.h>					// calloc(), qsort()
+#include <string.h>					// memmove(), strlen()
 #include "Thread_Racer.h"			// struct threadGrandPrixRace
 
 #ifndef THREADRACER_MAX_TRIES
@@ -36,6 +36,33 @@
 char ithc(int num);
 
 
+/*
+	PURPOSE - Measure how far a racer has gone
+	INPUT
+		racer_ptr - Pointer to a tgpRacer struct
+	OUTPUT
+		Track positions covered, counting completed laps
+ */
+unsigned long racer_distance(tgpRacer_ptr racer_ptr);
+
+
+/*
+	PURPOSE - qsort() comparison function for tgpRacer_ptrs: farthest first,
+		ties to the lower tNum
+ */
+int compare_racers(const void* racer1_ptr, const void* racer2_ptr);
+
+
+/*
+	PURPOSE - Get the character a racer is shown as
+	INPUT
+		racer_ptr - Pointer to a tgpRacer struct
+	OUTPUT
+		The racer's hex digit, or '-' if it isn't drawn on the track
+ */
+char racer_symbol(tgpRacer_ptr racer_ptr);
+
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// STRUCT FUNCTIONS START ///////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -126,7 +153,7 @@ tgpRacer_ptr populate_tgpRacer_ptr(hThrDetails_ptr structDetails, int trkLen, hc
 			retVal->winner = false;  // Initialize this
 
 			// Update the currCoord
-			if (retVal->currCoord)
+			if (retVal->currCoord && structDetails->tNum <= TR_MAX_DRAWN)
 			{
 				if (false == add_racer_to_track(retVal, retVal->currCoord))
 				{
@@ -250,6 +277,10 @@ bool free_tgpRacer_ptr(tgpRacer_ptr* oldStruct_ptr)
 		(*oldStruct_ptr)->currCoord = NULL;
 		// bool winner;						// This thread won
 		(*oldStruct_ptr)->winner = false;
+		// int rankIdx;						// Index into its ranking's rank_arr
+		(*oldStruct_ptr)->rankIdx = 0;
+		// struct threadGrandPrixRanking* ranking_ptr;	// Ranking this racer is in, if any
+		(*oldStruct_ptr)->ranking_ptr = NULL;
 		
 		// Free the struct
 		free(*oldStruct_ptr);
@@ -302,6 +333,107 @@ bool free_tgpRacer_arr(tgpRacer_ptr** oldArr_ptr)
 }
 
 
+tgpRanking_ptr create_tgpRanking_ptr(tgpRacer_ptr* racerArr_ptr)
+{
+	// LOCAL VARIABLES
+	tgpRanking_ptr retVal = NULL;
+	bool success = true;  // Set this to false if anything fails
+	int numRacers = 0;  // Number of racers in racerArr_ptr
+	int i = 0;  // Iterating variable
+
+	// INPUT VALIDATION
+	if (!racerArr_ptr || !(*racerArr_ptr))
+	{
+		HARKLE_ERROR(Thread_Racer, create_tgpRanking_ptr, NULL racer array pointer);
+		success = false;
+	}
+	else
+	{
+		while (racerArr_ptr[numRacers])
+		{
+			numRacers++;
+		}
+	}
+
+	// ALLOCATION
+	if (true == success)
+	{
+		retVal = (tgpRanking_ptr)calloc(1, sizeof(tgpRanking));
+
+		if (retVal)
+		{
+			retVal->rank_arr = allocate_tgpRacer_arr(numRacers);
+		}
+
+		if (!retVal || !(retVal->rank_arr))
+		{
+			HARKLE_ERROR(Thread_Racer, create_tgpRanking_ptr, calloc failed);
+			free(retVal);
+			retVal = NULL;
+			success = false;
+		}
+	}
+
+	// RANK THE RACERS
+	if (true == success)
+	{
+		if (false == sort_racers(racerArr_ptr, retVal->rank_arr))
+		{
+			HARKLE_ERROR(Thread_Racer, create_tgpRanking_ptr, sort_racers failed);
+			free_tgpRanking_ptr(&retVal);
+		}
+		else
+		{
+			retVal->numRacers = numRacers;
+
+			for (i = 0; i < numRacers; i++)
+			{
+				retVal->rank_arr[i]->rankIdx = i;
+				retVal->rank_arr[i]->ranking_ptr = retVal;
+			}
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+bool free_tgpRanking_ptr(tgpRanking_ptr* oldStruct_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;
+	int i = 0;  // Iterating variable
+
+	// INPUT VALIDATION
+	if (!oldStruct_ptr || NULL == *oldStruct_ptr)
+	{
+		HARKLE_ERROR(Thread_Racer, free_tgpRanking_ptr, NULL pointer);
+		retVal = false;
+	}
+	else
+	{
+		// Forget the racers
+		if ((*oldStruct_ptr)->rank_arr)
+		{
+			for (i = 0; (*oldStruct_ptr)->rank_arr[i]; i++)
+			{
+				(*oldStruct_ptr)->rank_arr[i]->ranking_ptr = NULL;
+				(*oldStruct_ptr)->rank_arr[i]->rankIdx = 0;
+			}
+			free((*oldStruct_ptr)->rank_arr);
+		}
+
+		// Free the struct
+		free(*oldStruct_ptr);
+		*oldStruct_ptr = NULL;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// STRUCT FUNCTIONS STOP ////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -393,7 +525,7 @@ bool update_racer_pos(tgpRacer_ptr racer_ptr, hcCartCoord_ptr headNode, int lapN
 	// 	HARKLE_ERROR(Thread_Racer, update_racer_pos, Racer went backwards);
 	// 	retVal = false;
 	// }
-	else if (racer_ptr->F1Details->tNum < 0x0 || racer_ptr->F1Details->tNum > 0xF)
+	else if (racer_ptr->F1Details->tNum < 0x0)
 	{
 		HARKLE_ERROR(Thread_Racer, update_racer_pos, Invalid racer number);
 		retVal = false;
@@ -412,7 +544,7 @@ bool update_racer_pos(tgpRacer_ptr racer_ptr, hcCartCoord_ptr headNode, int lapN
 	// {
 
 	// REMOVE RACER FROM THE TRACK
-	if (true == retVal)
+	if (true == retVal && racer_ptr->F1Details->tNum <= TR_MAX_DRAWN)
 	{
 		retVal = remove_racer_from_track(racer_ptr);
 
@@ -424,7 +556,7 @@ bool update_racer_pos(tgpRacer_ptr racer_ptr, hcCartCoord_ptr headNode, int lapN
 
 	// ADD RACER TO THE TRACK
 	// if (true == retVal)
-	if (true == retVal && racer_ptr->currLap == lapNum)
+	if (true == retVal && racer_ptr->currLap == lapNum && racer_ptr->F1Details->tNum <= TR_MAX_DRAWN)
 	{
 		// if (racer_ptr->F1Details->tNum == 1)
 		// {
@@ -534,6 +666,7 @@ bool clear_racer_flag(hcCartCoord_ptr hcCoord, int racerNum)
 	if (true == retVal)
 	{
 		hcCoord->hcFlags &= ~racerFlag;
+		retVal = mark_cartCoord_dirty(hcCoord);
 	}
 
 	// DONE
@@ -672,6 +805,7 @@ bool set_racer_flag(hcCartCoord_ptr hcCoord, int racerNum)
 	if (true == retVal)
 	{
 		hcCoord->hcFlags |= racerFlag;
+		retVal = mark_cartCoord_dirty(hcCoord);
 	}
 
 	// DONE
@@ -782,6 +916,12 @@ bool update_coord_graphic(hcCartCoord_ptr hcCoord, int newRcrNum)
 		}
 	}
 
+	// REDRAW IT
+	if (true == retVal)
+	{
+		retVal = mark_cartCoord_dirty(hcCoord);
+	}
+
 	// DONE
 	return retVal;
 }
@@ -796,11 +936,113 @@ bool update_coord_graphic(hcCartCoord_ptr hcCoord, int newRcrNum)
 //////////////////////////////////////////////////////////////////////////////
 
 
+bool rerank_racer(tgpRacer_ptr racer_ptr)
+{
+	// LOCAL VARIABLES
+	bool retVal = true;  // Set this to false if anything fails
+	tgpRacer_ptr* rank_arr = NULL;  // The racer's ranking
+	int idx = 0;  // racer_ptr's current index into rank_arr
+	int low = 0;  // Binary search lower bound
+	int high = 0;  // Binary search upper bound
+	int mid = 0;  // Binary search midpoint
+	int i = 0;  // Iterating variable
+
+	// INPUT VALIDATION
+	if (!racer_ptr)
+	{
+		HARKLE_ERROR(Thread_Racer, rerank_racer, NULL racer pointer);
+		retVal = false;
+	}
+	else if (!(racer_ptr->ranking_ptr))
+	{
+		retVal = true;  // Not ranked
+	}
+	else
+	{
+		rank_arr = racer_ptr->ranking_ptr->rank_arr;
+		idx = racer_ptr->rankIdx;
+
+		if (idx < 0 || idx >= racer_ptr->ranking_ptr->numRacers || rank_arr[idx] != racer_ptr)
+		{
+			HARKLE_ERROR(Thread_Racer, rerank_racer, Racer is out of place);
+			retVal = false;
+		}
+	}
+
+	// RERANK
+	if (true == retVal && rank_arr)
+	{
+		// 1. Moved up?  Find the first racer ahead it now beats
+		if (idx > 0 && compare_racers(&racer_ptr, &rank_arr[idx - 1]) < 0)
+		{
+			low = 0;
+			high = idx - 1;
+
+			while (low < high)
+			{
+				mid = low + ((high - low) / 2);
+
+				if (compare_racers(&racer_ptr, &rank_arr[mid]) < 0)
+				{
+					high = mid;
+				}
+				else
+				{
+					low = mid + 1;
+				}
+			}
+
+			// Shift the passed racers back one
+			memmove(&rank_arr[low + 1], &rank_arr[low], (idx - low) * sizeof(tgpRacer_ptr));
+			rank_arr[low] = racer_ptr;
+
+			for (i = low; i <= idx; i++)
+			{
+				rank_arr[i]->rankIdx = i;
+			}
+		}
+		// 2. Moved back?  Find the last racer behind it that now beats it
+		else if (idx < (racer_ptr->ranking_ptr->numRacers - 1) \
+		         && compare_racers(&racer_ptr, &rank_arr[idx + 1]) > 0)
+		{
+			low = idx + 1;
+			high = racer_ptr->ranking_ptr->numRacers - 1;
+
+			while (low < high)
+			{
+				mid = low + ((high - low + 1) / 2);
+
+				if (compare_racers(&racer_ptr, &rank_arr[mid]) > 0)
+				{
+					low = mid;
+				}
+				else
+				{
+					high = mid - 1;
+				}
+			}
+
+			// Shift the racers that passed it up one
+			memmove(&rank_arr[idx], &rank_arr[idx + 1], (low - idx) * sizeof(tgpRacer_ptr));
+			rank_arr[low] = racer_ptr;
+
+			for (i = idx; i <= low; i++)
+			{
+				rank_arr[i]->rankIdx = i;
+			}
+		}
+	}
+
+	// DONE
+	return retVal;
+}
+
+
 /*
 	PURPOSE - Update the Grand Prix in-race stats window
 	INPUT
 		rankWin_ptr - Pointer to the WINDOW object holding the rank bar
-		racerArr_ptr - An NULL-terminated array of tgpRacer struct pointers
+		ranking_ptr - Pointer to the race's threadGrandPrixRanking struct
 	OUTPUT
 		On success, true
 		On failure, false
@@ -808,8 +1050,9 @@ bool update_coord_graphic(hcCartCoord_ptr hcCoord, int newRcrNum)
 		This function will not call wrefresh().  Instead, it will merely
 			update the WINDOW.  The calling function is responsible for
 			calling wrefresh().
+		Only the racers that fit in the window are visited
  */
-bool update_ranking_win(winDetails_ptr rankWin_ptr, tgpRacer_ptr* racerArr_ptr)
+bool update_ranking_win(winDetails_ptr rankWin_ptr, tgpRanking_ptr ranking_ptr)
 {
 	// LOCAL VARIABLES
 	bool retVal = true;
@@ -819,7 +1062,8 @@ bool update_ranking_win(winDetails_ptr rankWin_ptr, tgpRacer_ptr* racerArr_ptr)
 	char tmpString1[TR_BUFF_SIZE + 1] = { 0 };  // Temp array to prep printed lines
 	char tmpString2[TR_BUFF_SIZE + 1] = { 0 };  // Temp array to prep printed lines
 	int tmpInt = 0;  // Temp int for calculations
-	tgpRacer_ptr rankedRacerArr[TR_MAX_RACERS + 1] = { NULL };  // Holds the ranked racers
+	tgpRacer_ptr* rankedRacerArr = NULL;  // The ranked racers
+	unsigned long topDistance = 0;  // Distance covered by the racer in 1st place
 	int i = 0;  // Iterating variable
 	int topLap = 0;  // Highest lap number among the racers
 	int totalLaps = 0;  // Total laps
@@ -834,9 +1078,9 @@ bool update_ranking_win(winDetails_ptr rankWin_ptr, tgpRacer_ptr* racerArr_ptr)
 		HARKLE_ERROR(Thread_Racer, update_ranking_win, NULL struct pointer);
 		retVal = false;
 	}
-	else if (!racerArr_ptr || !(*racerArr_ptr))
+	else if (!ranking_ptr || !(ranking_ptr->rank_arr) || !(*(ranking_ptr->rank_arr)))
 	{
-		HARKLE_ERROR(Thread_Racer, update_ranking_win, NULL racer pointer);
+		HARKLE_ERROR(Thread_Racer, update_ranking_win, NULL ranking pointer);
 		retVal = false;
 	}
 	//////////////////////////// UPDATE THIS LATER ///////////////////////////
@@ -871,30 +1115,15 @@ bool update_ranking_win(winDetails_ptr rankWin_ptr, tgpRacer_ptr* racerArr_ptr)
 			// fprintf(stdout, "maxWid == %d - strlen(%lu) == %d\n", maxWid, strlen("THREAD GRAND PRIX"), tmpInt);  // DEBUGGING
 		}
 
-		// RANK RACERS
-		// for (i = 0; i < TR_MAX_RACERS; i++)
-		// {
-		// 	if (NULL == racerArr_ptr[i])
-		// 	{
-		// 		break;
-		// 	}
-		// 	else
-		// 	{
-		// 		rankedRacerArr[i] = racerArr_ptr[i];
-		// 	}
-		// }
-		if (false == sort_racers(racerArr_ptr, rankedRacerArr))
-		{
-			HARKLE_ERROR(Thread_Racer, update_ranking_win, sort_racers failed);
-			retVal = false;
-		}
-		else
-		{
-			// Get top lap
-			topLap = rankedRacerArr[0]->currLap;
-			// Get total laps
-			totalLaps = racerArr_ptr[0]->numLaps;
-		}
+		// RANKED RACERS
+		// rerank_racer() already keeps them in order
+		rankedRacerArr = ranking_ptr->rank_arr;
+		// Get top lap
+		topLap = rankedRacerArr[0]->currLap;
+		// Get total laps
+		totalLaps = rankedRacerArr[0]->numLaps;
+		// Get the leader's distance
+		topDistance = racer_distance(rankedRacerArr[0]);
 	}
 
 	// FORMAT ROWS
@@ -940,7 +1169,7 @@ bool update_ranking_win(winDetails_ptr rankWin_ptr, tgpRacer_ptr* racerArr_ptr)
 	// 3. Ranked Racers
 	if (true == retVal)
 	{
-		for (i = 0; i < TR_MAX_RACERS; i++)
+		for (i = 0; i < ranking_ptr->numRacers; i++)
 		{
 			// 3.0. Verify the bounds
 			// 3.0.1. Check number of racers
@@ -958,14 +1187,8 @@ bool update_ranking_win(winDetails_ptr rankWin_ptr, tgpRacer_ptr* racerArr_ptr)
 			{
 				// fprintf(stdout, "\nPrinting Thread #%d\n", rankedRacerArr[i]->F1Details->tNum);  // DEBUGGING
 				currPrintRow++;  // Print another racer
-				currentRacer = ithc(rankedRacerArr[i]->F1Details->tNum);
-
-				if (!currentRacer)
-				{
-					HARKLE_ERROR(Thread_Racer, update_ranking_win, ithc failed);
-					retVal = false;
-					break;
-				}
+				currentRacer = racer_symbol(rankedRacerArr[i]);
+				rankedRacerArr[i]->relPos = topDistance - racer_distance(rankedRacerArr[i]);
 
 				// 3.1. Setup temp buffers
 				if (rankedRacerArr[i]->F1Details->tName)
@@ -1028,17 +1251,8 @@ bool sort_racers(tgpRacer_ptr* racerArr_ptr, tgpRacer_ptr* rankedRacer_arr)
 	// LOCAL VARIABLES
 	bool retVal = true;  // Set this to false if anything fails
 	int i = 0;  // Iterating variable
-	// int j = 0;  // Iterating variable
-	tgpRacer_ptr realLeader = NULL;  // First place
-	tgpRacer_ptr currLeader = NULL;  // Temporary 'benchmark' to check against
-	// tgpRacer_ptr* dest_arr = NULL;  // Iterating pointer for rankedRacer_arr
-	// Set an index to nul if a racerArr_ptr index number has already been
-	//	sorted into rankedRacer_arr
-	char bookKeep[TR_MAX_RACERS + 1] = { 0 };  // Bookkeeping for the sorting
-	char bookChar = 'X';  // Bookkeeping char
-	int currLdrIndex = 0;  // Keep track of the index for the current leader
-	int numRacersRanked = 0;  // The number of racers that have already been sorted
 	int totalRacers = 0;  // Number of pointers in racerArr_ptr
+	unsigned long topDistance = 0;  // Distance covered by the leader
 
 	// INPUT VALIDATION
 	if (!racerArr_ptr || !(*racerArr_ptr))
@@ -1053,32 +1267,14 @@ bool sort_racers(tgpRacer_ptr* racerArr_ptr, tgpRacer_ptr* rankedRacer_arr)
 	}
 	else
 	{
-		// Verify racerArr_ptr doesn't exceed TR_MAX_RACERS
-		for (i = 0; i <= TR_MAX_RACERS; i++)
-		{
-			if (racerArr_ptr[i])
-			{
-				totalRacers++;
-			}
-			else
-			{
-				break;  // Found the NULL termination
-			}
-		}
-
-		if (totalRacers > TR_MAX_RACERS)
+		// Count the racers
+		while (racerArr_ptr[totalRacers])
 		{
-			HARKLE_ERROR(Thread_Racer, sort_racers, Too many racers);
-			retVal = false;
-		}
-		else if (totalRacers < 1)
-		{
-			HARKLE_ERROR(Thread_Racer, sort_racers, Too few racers);
-			retVal = false;
+			totalRacers++;
 		}
 
 		// Verify rankedRacer_arr is emtpy
-		for (i = 0; i <= TR_MAX_RACERS; i++)
+		for (i = 0; i <= totalRacers; i++)
 		{
 			if (NULL != rankedRacer_arr[i])
 			{
@@ -1089,90 +1285,19 @@ bool sort_racers(tgpRacer_ptr* racerArr_ptr, tgpRacer_ptr* rankedRacer_arr)
 		}
 	}
 
-	// PREPARE THE BOOKKEEPING ARRAY
-	if (true == retVal)
-	{
-		for (i = 0; i < totalRacers; i++)
-		{
-			bookKeep[i] = bookChar;
-		}
-	}
-
 	// SORT THE RACERS
 	if (true == retVal)
 	{
-		// 0. Prepare the destination pointer
-		// dest_arr = rankedRacer_arr;
+		// 1. Copy and sort
+		memcpy(rankedRacer_arr, racerArr_ptr, totalRacers * sizeof(tgpRacer_ptr));
+		qsort(rankedRacer_arr, totalRacers, sizeof(tgpRacer_ptr), compare_racers);
 
-		// 1. Find first place racer
-		while (true == retVal && numRacersRanked < totalRacers)
-		{
-			// Find the current leader in the race
-			for (i = 0; i < totalRacers; i++)
-			{
-				// End of racers?
-				if (NULL == racerArr_ptr[i])
-				{
-					break;
-				}
-				// Did we already sort this one?
-				else if (!bookKeep[i])
-				{
-					continue;
-				}
-				// Find a racer that's ahead of the current leader
-				else
-				{
-					// Haven't found one yet
-					if (!currLeader)
-					{
-						// You're the leader now!
-						currLeader = racerArr_ptr[i];
-						currLdrIndex = i;
-					}
-					// Ahead on laps
-					else if (racerArr_ptr[i]->currLap > currLeader->currLap)
-					{
-						currLeader = racerArr_ptr[i];
-						currLdrIndex = i;
-					}
-					// Same lap but ahead on position
-					else if (racerArr_ptr[i]->currLap == currLeader->currLap && \
-						     racerArr_ptr[i]->currPos > currLeader->currPos)
-					{
-						currLeader = racerArr_ptr[i];
-						currLdrIndex = i;
-					}
-				}
-			}
+		// 2. UPDATE RACERS RELATIVE POSITION
+		topDistance = racer_distance(rankedRacer_arr[0]);
 
-			// Did we find a current leader?
-			if (currLeader)
-			{
-				if (0 == numRacersRanked)
-				{
-					realLeader = currLeader;  // Store the current leader
-					realLeader->relPos = 0;  // Relative position is front of the pack
-				}
-				else
-				{
-					// UPDATE RACERS RELATIVE POSITION
-					currLeader->relPos = ((realLeader->currLap * realLeader->trackLen) + realLeader->currPos) - \
-					                     ((currLeader->currLap * currLeader->trackLen) + currLeader->currPos);
-				}
-				// Store this racer in the destination array
-				// fprintf(stdout, "Just sorted Thread #%d\n", currLeader->F1Details->tNum);  // DEBUGGING
-				(*(rankedRacer_arr + numRacersRanked)) = currLeader;
-				numRacersRanked++;  // Advance the iterating variable to the next index
-				bookKeep[currLdrIndex] = 0;  // Clear the book keeping char for this racer
-				currLeader = NULL;  // Reset temp variable
-			}
-			// How did we get here?!
-			else
-			{
-				HARKLE_ERROR(Thread_Racer, sort_racers, First place racer sorting logic error);
-				retVal = false;
-			}
+		for (i = 0; i < totalRacers; i++)
+		{
+			rankedRacer_arr[i]->relPos = topDistance - racer_distance(rankedRacer_arr[i]);
 		}
 	}
 
@@ -1207,7 +1332,7 @@ int highest_lap(tgpRacer_ptr* racerArr_ptr)
 	// EVALUATE RACERS
 	if (true == success)
 	{
-		for (i = 0; i <= TR_MAX_RACERS; i++)
+		for (i = 0; ; i++)
 		{
 			if (NULL == racerArr_ptr[i])
 			{
@@ -1234,7 +1359,7 @@ int highest_lap(tgpRacer_ptr* racerArr_ptr)
 	INPUT
 		rankWin_ptr - Pointer to the winDetails struct containing the final
 			results window information
-		racerArr_ptr - An NULL-terminated array of tgpRacer struct pointers
+		ranking_ptr - Pointer to the race's threadGrandPrixRanking struct
 	OUTPUT
 		On success, true
 		On failure, false
@@ -1242,15 +1367,17 @@ int highest_lap(tgpRacer_ptr* racerArr_ptr)
 		This function will not call wrefresh().  Instead, it will merely
 			update the WINDOW.  The calling function is responsible for
 			calling wrefresh().
+		Prints as many racers as fit
  */
-bool update_results_win(winDetails_ptr resWin_ptr, tgpRacer_ptr* racerArr_ptr)
+bool update_results_win(winDetails_ptr resWin_ptr, tgpRanking_ptr ranking_ptr)
 {
 	// LOCAL VARIABLES
 	bool retVal = true;
 	WINDOW* tWin_ptr = NULL;  // Get this from resWin_ptr for ease of reference
 	int maxWid = 0;  // Max printable window width
 	int maxLen = 0;  // Max printable window length
-	tgpRacer_ptr rankedRacerArr[TR_MAX_RACERS + 1] = { NULL };  // Holds the ranked racers
+	tgpRacer_ptr* rankedRacerArr = NULL;  // The ranked racers
+	unsigned long topDistance = 0;  // Distance covered by the racer in 1st place
 	char tmpString1[TR_BUFF_SIZE + 1] = { 0 };  // Temp array to prep printed lines
 	char tmpString2[TR_BUFF_SIZE + 1] = { 0 };  // Temp array to prep printed lines
 	int i = 0;  // Iterating variable
@@ -1276,6 +1403,11 @@ bool update_results_win(winDetails_ptr resWin_ptr, tgpRacer_ptr* racerArr_ptr)
 		HARKLE_ERROR(Thread_Racer, update_results_win, NULL WINDOW pointer);
 		retVal = false;
 	}
+	else if (!ranking_ptr || !(ranking_ptr->rank_arr) || !(*(ranking_ptr->rank_arr)))
+	{
+		HARKLE_ERROR(Thread_Racer, update_results_win, NULL ranking pointer);
+		retVal = false;
+	}
 	// "Official Results" is 69 characters long
 	// 2 spaces are required on either side 'readability'
 	else if (resWin_ptr->nCols < ((sizeof(offRes4)/sizeof(*offRes4)) + 4))
@@ -1283,10 +1415,10 @@ bool update_results_win(winDetails_ptr resWin_ptr, tgpRacer_ptr* racerArr_ptr)
 		HARKLE_ERROR(Thread_Racer, update_results_win, Invalid number of columns);
 		retVal = false;
 	}
-	// TR_MAX_RACERS to print all the results for all the racers
+	// 1 to print at least the winner (the rest are printed as they fit)
 	// 5 for the "Official Results"
 	// 2 for an empty upper and lower line
-	else if (resWin_ptr->nRows < (TR_MAX_RACERS + 5 + 2))
+	else if (resWin_ptr->nRows < (1 + 5 + 2))
 	{
 		HARKLE_ERROR(Thread_Racer, update_results_win, Invalid number of rows);
 		retVal = false;
@@ -1298,14 +1430,12 @@ bool update_results_win(winDetails_ptr resWin_ptr, tgpRacer_ptr* racerArr_ptr)
 		maxLen = resWin_ptr->nRows - 4;  // Empty buffer
 	}	
 	
-	// SORT THE RACERS
+	// RANKED RACERS
 	if (true == retVal)
 	{
-		if (false == sort_racers(racerArr_ptr, rankedRacerArr))
-		{
-			HARKLE_ERROR(Thread_Racer, update_results_win, sort_racers failed);
-			retVal = false;
-		}
+		// rerank_racer() already keeps them in order
+		rankedRacerArr = ranking_ptr->rank_arr;
+		topDistance = racer_distance(rankedRacerArr[0]);
 	}
 
 	// UPDATE WINDOW
@@ -1337,7 +1467,7 @@ bool update_results_win(winDetails_ptr resWin_ptr, tgpRacer_ptr* racerArr_ptr)
 		// 2. Print the racers
 		if (true == retVal)
 		{
-			for (i = 0; i < TR_MAX_RACERS; i++)
+			for (i = 0; i < ranking_ptr->numRacers; i++)
 			{
 				if (NULL == rankedRacerArr[i])
 				{
@@ -1350,43 +1480,35 @@ bool update_results_win(winDetails_ptr resWin_ptr, tgpRacer_ptr* racerArr_ptr)
 				else
 				{
 					// 2.1. Get racer's hex digit
-					currentRacer = ithc(rankedRacerArr[i]->F1Details->tNum);
+					currentRacer = racer_symbol(rankedRacerArr[i]);
+					rankedRacerArr[i]->relPos = topDistance - racer_distance(rankedRacerArr[i]);
 
-					if (!currentRacer)
+					// 2.2. Setup temp buffer two with everything but the time
+					if (rankedRacerArr[i]->F1Details->tName)
 					{
-						HARKLE_ERROR(Thread_Racer, update_results_win, ithc failed);
-						retVal = false;
-						break;
+						snprintf(tmpString2, TR_BUFF_SIZE, "%2d  (0x%c)  %-20s", i + 1, \
+								 currentRacer, rankedRacerArr[i]->F1Details->tName);
 					}
 					else
 					{
-						// 2.2. Setup temp buffer two with everything but the time
-						if (rankedRacerArr[i]->F1Details->tName)
-						{
-							snprintf(tmpString2, TR_BUFF_SIZE, "%2d  (0x%c)  %-20s", i + 1, \
-									 currentRacer, rankedRacerArr[i]->F1Details->tName);
-						}
-						else
-						{
-							snprintf(tmpString2, TR_BUFF_SIZE, "%2d  (0x%c)  %s%02d", i + 1, \
-									 currentRacer, "Thread #", rankedRacerArr[i]->F1Details->tNum);
-						}
-						
-						// 2.3. Setup temp buffer one with the temp buffer two and the time
-						if (i > 0)
-						{
-							snprintf(tmpString1, TR_BUFF_SIZE, "%-*s  -%05lu", maxWid - 8, \
-							         tmpString2, rankedRacerArr[i]->relPos);
-						}
-						else
-						{
-							snprintf(tmpString1, TR_BUFF_SIZE, "%-*s", maxWid, tmpString2);
-						}
-						// fprintf(stderr, "i:\t%d\n", i);  // DEBUGGING
-						// fprintf(stderr, "tmpString1:\t%s\n", tmpString1);  // DEBUGGING
-						// fprintf(stderr, "tmpString2:\t%s\n", tmpString2);  // DEBUGGING
+						snprintf(tmpString2, TR_BUFF_SIZE, "%2d  (0x%c)  %s%02d", i + 1, \
+								 currentRacer, "Thread #", rankedRacerArr[i]->F1Details->tNum);
 					}
 					
+					// 2.3. Setup temp buffer one with the temp buffer two and the time
+					if (i > 0)
+					{
+						snprintf(tmpString1, TR_BUFF_SIZE, "%-*s  -%05lu", maxWid - 8, \
+						         tmpString2, rankedRacerArr[i]->relPos);
+					}
+					else
+					{
+						snprintf(tmpString1, TR_BUFF_SIZE, "%-*s", maxWid, tmpString2);
+					}
+					// fprintf(stderr, "i:\t%d\n", i);  // DEBUGGING
+					// fprintf(stderr, "tmpString1:\t%s\n", tmpString1);  // DEBUGGING
+					// fprintf(stderr, "tmpString2:\t%s\n", tmpString2);  // DEBUGGING
+					
 					// 2.3. Print the line
 					if (OK != mvwprintw(tWin_ptr, currPrintRow + i, 2, "%-*s", maxWid, tmpString1))
 					{
@@ -1440,6 +1562,51 @@ char ithc(int num)
 }
 
 
+unsigned long racer_distance(tgpRacer_ptr racer_ptr)
+{
+	return ((unsigned long)racer_ptr->currLap * racer_ptr->trackLen) + racer_ptr->currPos;
+}
+
+
+int compare_racers(const void* racer1_ptr, const void* racer2_ptr)
+{
+	// LOCAL VARIABLES
+	int retVal = 0;
+	tgpRacer_ptr racer1 = *((tgpRacer_ptr*)racer1_ptr);  // First racer
+	tgpRacer_ptr racer2 = *((tgpRacer_ptr*)racer2_ptr);  // Second racer
+	unsigned long distance1 = racer_distance(racer1);  // First racer's distance
+	unsigned long distance2 = racer_distance(racer2);  // Second racer's distance
+
+	// COMPARE
+	if (distance1 != distance2)
+	{
+		retVal = distance1 > distance2 ? -1 : 1;  // Farthest first
+	}
+	else if (racer1->F1Details->tNum != racer2->F1Details->tNum)
+	{
+		retVal = racer1->F1Details->tNum < racer2->F1Details->tNum ? -1 : 1;
+	}
+
+	// DONE
+	return retVal;
+}
+
+
+char racer_symbol(tgpRacer_ptr racer_ptr)
+{
+	// LOCAL VARIABLES
+	char retVal = '-';  // Not drawn on the track
+
+	if (racer_ptr->F1Details->tNum <= TR_MAX_DRAWN)
+	{
+		retVal = ithc(racer_ptr->F1Details->tNum);
+	}
+
+	// DONE
+	return retVal;
+}
+
+
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////// LOCAL HELPER FUNCTIONS STOP /////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -13,7 +13,11 @@
 #include <ncurses.h>				// WINDOW
 #include <stdbool.h>				// bool, true, false
 
-#define TR_MAX_RACERS 17
+// Highest tNum that can be drawn on the track (one hcFlags bit and one hex digit each).
+//	Racers beyond this are still ranked, they just aren't drawn.
+#define TR_MAX_DRAWN 0xF
+
+struct threadGrandPrixRanking;
 
 typedef struct threadGrandPrixRace
 {
@@ -25,8 +29,17 @@ typedef struct threadGrandPrixRace
 	unsigned long relPos;			// Distance behind the leader
 	hcCartCoord_ptr currCoord;		// Current cartesian coordinate location
 	bool winner;					// This thread won
+	int rankIdx;					// Index into its ranking's rank_arr
+	struct threadGrandPrixRanking* ranking_ptr;	// Ranking this racer is in, if any
 } tgpRacer, *tgpRacer_ptr;
 
+// Every racer, kept in ranking order as they report in (see: rerank_racer())
+typedef struct threadGrandPrixRanking
+{
+	tgpRacer_ptr* rank_arr;			// NULL-terminated, leader first
+	int numRacers;					// Number of racers in rank_arr
+} tgpRanking, *tgpRanking_ptr;
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// STRUCT FUNCTIONS START ///////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -109,6 +122,35 @@ bool free_tgpRacer_ptr(tgpRacer_ptr* oldStruct_ptr);
 bool free_tgpRacer_arr(tgpRacer_ptr** oldArr_ptr);
 
 
+/*
+	PURPOSE - Rank an array of racers once so they can be kept in order
+		incrementally afterwards
+	INPUT
+		racerArr_ptr - A NULL-terminated array of tgpRacer struct pointers
+	OUTPUT
+		On success, heap-allocated threadGrandPrixRanking struct pointer
+		On failure, NULL
+	NOTES
+		Calls Thread_Racer::sort_racers() once
+		Sets every racer's rankIdx and ranking_ptr
+		It is the caller's responsibility to call free_tgpRanking_ptr()
+ */
+tgpRanking_ptr create_tgpRanking_ptr(tgpRacer_ptr* racerArr_ptr);
+
+
+/*
+	PURPOSE - Zeroize, free, and NULL a heap-allocated threadGrandPrixRanking struct
+	INPUT
+		oldStruct_ptr - Pointer to a heap-allocated threadGrandPrixRanking struct pointer
+	OUTPUT
+		On success, true
+		On failure, false
+	NOTES
+		The racers themselves are not freed, but their ranking_ptr is cleared
+ */
+bool free_tgpRanking_ptr(tgpRanking_ptr* oldStruct_ptr);
+
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// STRUCT FUNCTIONS STOP ////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -149,6 +191,7 @@ bool update_all_racer_pos(tgpRacer_ptr* racer_arr, hcCartCoord_ptr headNode, int
 		Calls Thread_Racer::remove_racer_from_track()
 		Calls Thread_Racer::add_racer_to_track()
 		Will not add racer's that aren't on lapNum`
+		Racers numbered above TR_MAX_DRAWN are left off the track
  */
 bool update_racer_pos(tgpRacer_ptr racer_ptr, hcCartCoord_ptr headNode, int lapNum);
 
@@ -182,6 +225,7 @@ bool remove_racer_from_track(tgpRacer_ptr racer_ptr);
 		This function will first verify the racer's flag was raised
 			in the first place before trying to clear it
 		A racer's flag has a value equal to 2^racerNum
+		Marks hcCoord dirty (see: Harklecurse::mark_cartCoord_dirty())
  */
 bool clear_racer_flag(hcCartCoord_ptr hcCoord, int racerNum);
 
@@ -216,6 +260,7 @@ bool add_racer_to_track(tgpRacer_ptr racer_ptr, hcCartCoord_ptr headNode);
 		This function will first verify the racer's flag was not raised
 			before trying to clear it
 		A racer's flag has a value equal to 2^racerNum
+		Marks hcCoord dirty (see: Harklecurse::mark_cartCoord_dirty())
  */
 bool set_racer_flag(hcCartCoord_ptr hcCoord, int racerNum);
 
@@ -239,6 +284,7 @@ bool set_racer_flag(hcCartCoord_ptr hcCoord, int racerNum);
 		If newRcrNum is present in the flags and no other racers are here,
 			the graphic will be set to newRcrNum's hex digit.  Otherwise,
 			no change.
+		Marks hcCoord dirty (see: Harklecurse::mark_cartCoord_dirty())
  */
 bool update_coord_graphic(hcCartCoord_ptr hcCoord, int newRcrNum);
 
@@ -252,12 +298,33 @@ bool update_coord_graphic(hcCartCoord_ptr hcCoord, int newRcrNum);
 //////////////////////////////////////////////////////////////////////////////
 
 
+/*
+	PURPOSE - Move a racer to its place in its ranking after its currLap
+		or currPos changed
+	INPUT
+		racer_ptr - Pointer to the tgpRacer struct that just reported in
+	OUTPUT
+		On success, true
+		On failure, false
+	NOTES
+		Binary searches the racers it may have passed (or been passed by)
+			for its new slot, then shifts only those racers down (or up)
+		That's O(log n) comparisons but O(d) moves, where d is how many
+			racers it passed.  A racer moving one step only passes the
+			racers tied with it, so d stays small unless the field is
+			bunched up.  rank_arr stays a flat array so the windows can
+			index it directly.
+		A racer without a ranking_ptr is left alone
+ */
+bool rerank_racer(tgpRacer_ptr racer_ptr);
+
+
 /*
 	PURPOSE - Update the Grand Prix in-race stats window
 	INPUT
 		rankWin_ptr - Pointer to the winDetails struct containing the rank
 			bar information
-		racerArr_ptr - An NULL-terminated array of tgpRacer struct pointers
+		ranking_ptr - Pointer to the race's threadGrandPrixRanking struct
 	OUTPUT
 		On success, true
 		On failure, false
@@ -265,8 +332,9 @@ bool update_coord_graphic(hcCartCoord_ptr hcCoord, int newRcrNum);
 		This function will not call wrefresh().  Instead, it will merely
 			update the WINDOW.  The calling function is responsible for
 			calling wrefresh().
+		Only the racers that fit in the window are visited
  */
-bool update_ranking_win(winDetails_ptr rankWin_ptr, tgpRacer_ptr* racerArr_ptr);
+bool update_ranking_win(winDetails_ptr rankWin_ptr, tgpRanking_ptr ranking_ptr);
 
 
 /*
@@ -275,17 +343,16 @@ bool update_ranking_win(winDetails_ptr rankWin_ptr, tgpRacer_ptr* racerArr_ptr);
 	INPUT
 		racerArr_ptr - [IN] A NULL-terminated array of tgpRacer struct 
 			pointers to sort
-		rankedRacer_arr - [OUT] An entirely NULL array of minimum dimension
-			TR_MAX_RACERS + 1 into which the tgpRacer struct pointers will
+		rankedRacer_arr - [OUT] An entirely NULL array, one longer than
+			racerArr_ptr, into which the tgpRacer struct pointers will
 			be sorted
 	OUTPUT
 		On success, true
 		On failure, false
 	NOTES
-		rankedRacer_arr must be NULL from index 0 to index TR_MAX_RACERS
-		I'm currently undecided on whether or not I'll write a helper
-			function to also update each racer's relPos member or just
-			add the logic into this function
+		Racers are ordered by lap, then position.  Ties go to the lower tNum.
+		Each racer's relPos is updated
+		Use a threadGrandPrixRanking instead of calling this every update
  */
 bool sort_racers(tgpRacer_ptr* racerArr_ptr, tgpRacer_ptr* rankedRacer_arr);
 
@@ -307,7 +374,7 @@ int highest_lap(tgpRacer_ptr* racerArr_ptr);
 	INPUT
 		rankWin_ptr - Pointer to the winDetails struct containing the final
 			results window information
-		racerArr_ptr - An NULL-terminated array of tgpRacer struct pointers
+		ranking_ptr - Pointer to the race's threadGrandPrixRanking struct
 	OUTPUT
 		On success, true
 		On failure, false
@@ -315,8 +382,9 @@ int highest_lap(tgpRacer_ptr* racerArr_ptr);
 		This function will not call wrefresh().  Instead, it will merely
 			update the WINDOW.  The calling function is responsible for
 			calling wrefresh().
+		Prints as many racers as fit
  */
-bool update_results_win(winDetails_ptr resWin_ptr, tgpRacer_ptr* racerArr_ptr);
+bool update_results_win(winDetails_ptr resWin_ptr, tgpRanking_ptr ranking_ptr);
 
 
 //////////////////////////////////////////////////////////////////////////////
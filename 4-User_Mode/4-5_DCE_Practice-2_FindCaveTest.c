@@ -52,6 +52,12 @@ int main(void)
     // 9. Equal
     char array9[] = { 'a', 'b', 'c', 'd', 'e', 0x0, 0x0, 0x0, 0x0, 'f', 'g', 0x0, 0x0, 0x0, 0x0, 'h' };
     size_t array9size = sizeof(array9) / sizeof(char);
+    // 10. Trailing, across several 64 byte blocks
+    char array10[150] = { 'a' };
+    size_t array10size = sizeof(array10) / sizeof(char);
+    // 11. Two competing across a 64 byte block boundary (1st wins)
+    char array11[130] = { [70] = 'x' };
+    size_t array11size = sizeof(array11) / sizeof(char);
 
     // Array of test input
     testStruct unitTests[] = { \
@@ -65,6 +71,8 @@ int main(void)
         { array7, array7size, MM_TYPE_HEAP, array7,      5, NULL, DEFAULT_SIZE }, \
         { array8, array8size, MM_TYPE_HEAP, array8 + 11, 5, NULL, DEFAULT_SIZE }, \
         { array9, array9size, MM_TYPE_HEAP, array9 + 5,  4, NULL, DEFAULT_SIZE }, \
+        { array10, array10size, MM_TYPE_HEAP, array10 + 1, 149, NULL, DEFAULT_SIZE }, \
+        { array11, array11size, MM_TYPE_HEAP, array11,      70, NULL, DEFAULT_SIZE }, \
     };
 
     // RUN THE TESTS
@@ -0,0 +1,198 @@
+/*
+ *	The purpose of this file is to compare the original byte-by-byte find_code_cave()
+ *	loop against the current zero-run scanner, and a single-threaded
+ *	audit_code_caves() against a parallel one.
+ *
+ *	Usage: find_cave_benchmark.exe [ELF file to audit ...]
+ */
+
+#include "Elf_Manipulation.h"					// find_code_cave(), audit_code_caves()
+#include "Harklerror.h"							// HARKLE_ERROR
+#include <stdbool.h>							// bool, true, false
+#include <stdint.h>								// uintmax_t
+#include <stdio.h>								// fprintf()
+#include <stdlib.h>								// calloc()
+#include <time.h>								// clock_gettime()
+
+#define FC_HAYSTACK_MIB 256						// Size of the synthetic binary
+#define FC_TOP_K 3								// Runs to keep per audited file
+#define FC_MIN_SIZE 16							// Shortest run worth auditing
+#define FC_PRINT_FILES 10						// Number of audited files to print
+
+
+/*
+	Purpose - The original find_code_cave() search loop, kept as the control
+	Output - Largest run of 0x00 bytes in *cave_ptr/*caveSize (first one wins ties)
+ */
+void legacy_find_code_cave(const char* buf_ptr, size_t bufLen, const char** cave_ptr, size_t* caveSize)
+{
+	// LOCAL VARIABLES
+	const char* tempAddr_ptr = buf_ptr;  // Pointer to the beginning of the current section
+	const char* currChar_ptr = buf_ptr;  // Pointer used to validate each char
+	size_t byteCounter = 0;  // Counts the size of the 'nothing' segment
+
+	*cave_ptr = NULL;
+	*caveSize = 0;
+
+	while (currChar_ptr < buf_ptr + bufLen)
+	{
+		if (0x0 == *currChar_ptr)
+		{
+			byteCounter++;
+		}
+		else
+		{
+			if (byteCounter > *caveSize)
+			{
+				*cave_ptr = tempAddr_ptr;
+				*caveSize = byteCounter;
+			}
+			byteCounter = 0;
+			tempAddr_ptr = currChar_ptr + 1;
+		}
+		currChar_ptr++;
+	}
+
+	// Trailing "code cave"
+	if (byteCounter > *caveSize)
+	{
+		*cave_ptr = tempAddr_ptr;
+		*caveSize = byteCounter;
+	}
+}
+
+
+/*
+	Purpose - Monotonic time in seconds
+ */
+double get_seconds(void)
+{
+	struct timespec now = { 0 };
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + (now.tv_nsec / 1e9);
+}
+
+
+int main(int argc, char* argv[])
+{
+	// LOCAL VARIABLES
+	mapMem haystack = { NULL, (size_t)FC_HAYSTACK_MIB * 1024 * 1024, MM_TYPE_HEAP, false };  // Synthetic binary
+	mapMem_ptr newRes = NULL;  // Return value from find_code_cave()
+	const char* legacyCave_ptr = NULL;  // Largest run, per legacy_find_code_cave()
+	size_t legacySize = 0;  // Length of legacyCave_ptr
+	elfAudit_ptr serial_arr = NULL;  // Single-threaded audit
+	elfAudit_ptr parallel_arr = NULL;  // One thread per CPU audit
+	elfCave_ptr cave_ptr = NULL;  // Largest run in an audited file
+	unsigned int seed = 0x1337;  // Deterministic haystack
+	size_t runLen = 0;  // Length of the next run of synthetic bytes
+	size_t numFiles = argc - 1;  // Number of files to audit
+	double legacyTime = 0;  // Seconds spent in the control
+	double newTime = 0;  // Seconds spent in the current code
+	double startTime = 0;  // Timer
+	size_t i = 0;  // Iterating variable
+	size_t j = 0;  // Iterating variable
+	bool success = true;  // Make this false if any results differ
+
+	// BUILD THE HAYSTACK
+	// Mostly 'code', with the occasional run of padding
+	haystack.fileMem_ptr = calloc(haystack.memSize, 1);
+
+	if (!haystack.fileMem_ptr)
+	{
+		HARKLE_ERROR(find_cave_benchmark, main, calloc failed);
+		return 1;
+	}
+
+	for (i = 0; i < haystack.memSize; i += runLen)
+	{
+		seed = seed * 1103515245 + 12345;
+		runLen = 1 + ((seed >> 16) % 512);
+
+		if ((seed >> 8) % 4)
+		{
+			for (j = i; j < i + runLen && j < haystack.memSize; j++)
+			{
+				haystack.fileMem_ptr[j] = (char)(0x90 | (j & 0x0F));
+			}
+		}
+	}
+
+	// RUN
+	startTime = get_seconds();
+	legacy_find_code_cave(haystack.fileMem_ptr, haystack.memSize, &legacyCave_ptr, &legacySize);
+	legacyTime = get_seconds() - startTime;
+
+	startTime = get_seconds();
+	newRes = find_code_cave(&haystack);
+	newTime = get_seconds() - startTime;
+
+	fprintf(stdout, "Haystack: %d MiB\n", FC_HAYSTACK_MIB);
+	fprintf(stdout, "%-12s %-14s %-8s\n", "Legacy (s)", "find_code_cave", "Speedup");
+	fprintf(stdout, "%-12.4f %-14.4f %.1fx\n", legacyTime, newTime, newTime > 0 ? legacyTime / newTime : 0);
+
+	if (!newRes || newRes->fileMem_ptr != legacyCave_ptr || newRes->memSize != legacySize)
+	{
+		HARKLE_ERROR(find_cave_benchmark, main, Results differ);
+		success = false;
+	}
+
+	// AUDIT
+	if (numFiles > 0)
+	{
+		startTime = get_seconds();
+		serial_arr = audit_code_caves((const char**)(argv + 1), numFiles, FC_TOP_K, FC_MIN_SIZE, 1);
+		legacyTime = get_seconds() - startTime;
+
+		startTime = get_seconds();
+		parallel_arr = audit_code_caves((const char**)(argv + 1), numFiles, FC_TOP_K, FC_MIN_SIZE, 0);
+		newTime = get_seconds() - startTime;
+
+		if (!serial_arr || !parallel_arr)
+		{
+			HARKLE_ERROR(find_cave_benchmark, main, audit_code_caves failed);
+			success = false;
+		}
+		else
+		{
+			fprintf(stdout, "\nFiles: %zu\n", numFiles);
+			fprintf(stdout, "%-12s %-12s %-8s\n", "1 thread (s)", "N threads", "Speedup");
+			fprintf(stdout, "%-12.4f %-12.4f %.1fx\n\n", legacyTime, newTime, newTime > 0 ? legacyTime / newTime : 0);
+			fprintf(stdout, "%-10s %-10s %-5s %-5s %s\n", "Offset", "Size", "Phdr", "Shdr", "File");
+
+			for (i = 0; i < numFiles; i++)
+			{
+				if (serial_arr[i].numCaves != parallel_arr[i].numCaves)
+				{
+					HARKLE_ERROR(find_cave_benchmark, main, Audits differ);
+					success = false;
+				}
+
+				for (j = 0; j < serial_arr[i].numCaves && true == success; j++)
+				{
+					if (serial_arr[i].cave_arr[j].caveOffset != parallel_arr[i].cave_arr[j].caveOffset \
+					    || serial_arr[i].cave_arr[j].caveSize != parallel_arr[i].cave_arr[j].caveSize)
+					{
+						HARKLE_ERROR(find_cave_benchmark, main, Audits differ);
+						success = false;
+					}
+				}
+
+				if (i < FC_PRINT_FILES && parallel_arr[i].numCaves > 0)
+				{
+					cave_ptr = parallel_arr[i].cave_arr;
+					fprintf(stdout, "0x%-8jx %-10zu %-5d %-5d %s\n", (uintmax_t)cave_ptr->caveOffset, cave_ptr->caveSize, \
+					        cave_ptr->prgmHdrNum, cave_ptr->sectHdrNum, parallel_arr[i].filename);
+				}
+			}
+		}
+	}
+
+	// CLEAN UP
+	free_struct(&newRes);
+	free(haystack.fileMem_ptr);
+	free_code_cave_audit(&serial_arr, numFiles);
+	free_code_cave_audit(&parallel_arr, numFiles);
+
+	// DONE
+	return true == success ? 0 : 1;
+}
@@ -1,11 +1,14 @@
 #include <elf.h>
 #include "Elf_Manipulation.h"
+#include <fcntl.h>                              // O_RDONLY
 #include "Harklerror.h"                         // HARKLE_ERROR
 #include <inttypes.h>                           // uint format specifiers
 #include "Map_Memory.h"
+#include <pthread.h>                            // pthread_create(), pthread_join()
 #include <stdbool.h>		                    // bool, true, false
 #include <stdio.h>                              // fprintf
 #include <string.h>                             // strstr
+#include <unistd.h>                             // sysconf()
 
 
 #ifndef MAX_TRIES
@@ -13,6 +16,112 @@
 #define MAX_TRIES 3
 #endif // MAX_TRIES
 
+#ifndef ELF_CAVE_LIST_LEN
+// Starting capacity of find_code_caves()' list of runs
+#define ELF_CAVE_LIST_LEN 64
+#endif  // ELF_CAVE_LIST_LEN
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ELF_CAVE_X86                            // SSE2/AVX2 zero-run scanning is available
+#include <immintrin.h>                          // _mm_*(), _mm256_*()
+#endif  // x86 GCC/Clang
+
+
+typedef struct Elf_Code_Cave_List
+{
+    elfCave_ptr cave_arr;  // Runs found so far (a min-heap of the best runs when topK is set)
+    size_t numCaves;  // Number of entries in cave_arr
+    size_t arrLen;  // Capacity of cave_arr
+    size_t topK;  // Keep this many runs, 0 for all of them
+} elfCaveList, *elfCaveList_ptr;
+
+
+typedef struct Elf_Code_Cave_Audit_Job
+{
+    elfAudit_ptr audit_arr;  // One audit per file
+    size_t numFiles;  // Number of entries in audit_arr
+    size_t topK;  // Passed to find_code_caves()
+    size_t minSize;  // Passed to find_code_caves()
+    size_t nextFile;  // Index of the next file to claim, shared by every worker
+} elfAuditJob, *elfAuditJob_ptr;
+
+
+/*
+    Purpose - find_code_caves() engines:  find the next edge of a run of 0x00 bytes
+    Input
+        buf_ptr - Buffer to search
+        bufLen - Length of buf_ptr
+        index - Index to start searching from
+        wantZero - true to find the next 0x00 byte, false to find the next non-0x00 byte
+    Output - Index of the byte found, bufLen if there isn't one
+    Notes
+        The SWAR engine skips 8 bytes at a time; the SSE2 and AVX2 engines build a
+            64 bit mask of zero bytes per step and jump straight to its lowest set bit
+ */
+size_t find_zero_edge_swar(const unsigned char* buf_ptr, size_t bufLen, size_t index, bool wantZero);
+#ifdef ELF_CAVE_X86
+size_t find_zero_edge_sse2(const unsigned char* buf_ptr, size_t bufLen, size_t index, bool wantZero) __attribute__((target("sse2")));
+size_t find_zero_edge_avx2(const unsigned char* buf_ptr, size_t bufLen, size_t index, bool wantZero) __attribute__((target("avx2")));
+#endif  // ELF_CAVE_X86
+
+
+// find_code_caves() engine, upgraded by the CPU's capabilities where available (see: pick_zero_edge_engine())
+size_t (*elfZeroEdgeEngine)(const unsigned char*, size_t, size_t, bool) = find_zero_edge_swar;
+
+
+#ifdef ELF_CAVE_X86
+/*
+    Purpose - Choose the fastest find_zero_edge_*() engine this CPU supports
+    Input - None
+    Output - None
+    Notes
+        Runs as a constructor, before main() and any threads, so find_code_caves()
+            only ever reads elfZeroEdgeEngine
+ */
+void pick_zero_edge_engine(void) __attribute__((constructor));
+#endif  // ELF_CAVE_X86
+
+
+/*
+    Purpose - Add a run to a code cave list
+    Input
+        caveList - List to add to
+        caveOffset - Offset of the run
+        caveSize - Length of the run
+    Output - true on success, false if the list could not grow
+    Notes
+        With topK set, the list is a min-heap so a run only displaces the
+            smallest (and, among equals, the latest) run kept so far
+ */
+bool keep_code_cave(elfCaveList_ptr caveList, Elf64_Off caveOffset, size_t caveSize);
+
+
+/*
+    Purpose - Order code caves largest first, then by offset
+    Input - Two elfCave pointers (see: qsort())
+    Output - Less than, equal to, or greater than zero (see: qsort())
+ */
+int compare_code_caves(const void* cave1_ptr, const void* cave2_ptr);
+
+
+/*
+    Purpose - Populate a Mapped_Memory_Elf64 struct if, and only if, a binary
+        is a 64-bit ELF whose header tables fit inside it
+    Input - binary_ptr - struct* mappedMemory
+    Output - Dynamically allocated Mapped_Memory_Elf64 pointer, NULL otherwise
+    Notes
+        Unlike populate_mapElf64_struct(), this is quiet about non-ELF input
+ */
+mapElf64_ptr map_elf64_headers(mapMem_ptr binary_ptr);
+
+
+/*
+    Purpose - audit_code_caves() worker thread
+    Input - job_ptr - elfAuditJob pointer shared by every worker
+    Output - NULL
+ */
+void* audit_code_caves_worker(void* job_ptr);
+
 bool is_elf(mapMem_ptr file)
 {
     // LOCAL VARIABLES
@@ -206,7 +315,7 @@ Elf64_Phdr* find_this_prgm_hdr_64addr(mapElf64_ptr elf64File, Elf64_Addr addr)
 	int progHdrNum = 0;
 	
 	// INPUT VALIDATION
-	if (NULL != elf64File && 0 != addr)
+	if (NULL != elf64File)
 	{
 		currProgHdr = elf64File->binaryPhdr_ptr;
 		progHdrNum = 1;
@@ -220,8 +329,8 @@ Elf64_Phdr* find_this_prgm_hdr_64addr(mapElf64_ptr elf64File, Elf64_Addr addr)
 			// fprintf(stdout, "\tp_paddr == %p\n", (void*) currProgHdr->p_paddr);
 			
 
-			// If found it, store, and continue checking
-			if (currProgHdr->p_offset < addr)  // IMPLEMENT THIS LATER
+			// If found it, store, and continue checking for a more specific (later) one
+			if (currProgHdr->p_offset <= addr && addr - currProgHdr->p_offset < currProgHdr->p_filesz)
 			{
                 // Already found one
                 if (NULL != retVal)
@@ -264,7 +373,7 @@ Elf64_Shdr* find_this_sect_hdr_64addr(mapElf64_ptr elf64File, Elf64_Addr addr)
     int sectHdrNum = 0;
     
     // INPUT VALIDATION
-    if (NULL != elf64File && 0 != addr)
+    if (NULL != elf64File)
     {
         currSectHdr = elf64File->binaryShdr_ptr;
         sectHdrNum = 1;
@@ -277,8 +386,10 @@ Elf64_Shdr* find_this_sect_hdr_64addr(mapElf64_ptr elf64File, Elf64_Addr addr)
             // fprintf(stdout, "\tp_paddr == %p\n", (void*) currSectHdr->sh_addr);
             
 
-            // If found it, store, and continue checking
-            if (currSectHdr->sh_offset < addr)  // IMPLEMENT THIS LATER
+            // If found it, store, and continue checking for a more specific (later) one
+            // SHT_NOBITS sections (e.g., .bss) take up no room in the file
+            if (SHT_NOBITS != currSectHdr->sh_type && currSectHdr->sh_offset <= addr \
+                && addr - currSectHdr->sh_offset < currSectHdr->sh_size)
             {
                 // Already found one
                 if (NULL != retVal)
@@ -313,87 +424,245 @@ Elf64_Shdr* find_this_sect_hdr_64addr(mapElf64_ptr elf64File, Elf64_Addr addr)
 }
 
 
-/*
-    Purpose - Search an ELF binary for the largest section of 'nothing'
-    Input - elfBinary - struct* mappedMemory
-    Output - struct* mappedMemory which holds the address and size of the 
-        largest section of 'nothing'
- */
 mapMem_ptr find_code_cave(mapMem_ptr elfBinary)
 {
     // LOCAL VARIABLES
     mapMem_ptr retVal = NULL;
-    char* tempAddr_ptr = NULL;  // Pointer to the beginning of the current section
-    char* currChar_ptr = NULL;  // Pointer used to validate each char
-    int byteCounter = 0;        // Counts the size of the 'nothing' segment
+    elfCave_ptr cave_arr = NULL;  // Largest run of 0x00 bytes
+    size_t numCaves = 0;  // Number of entries in cave_arr
 
     // INPUT VALIDATION
     if (true == validate_struct(elfBinary))
     {
-        // puts("MADE IT PAST validate_struct()");  // DEBUGGING
         // 1. Create the return struct
         retVal = create_mapMem_ptr();
-        retVal->fileMem_ptr = elfBinary->fileMem_ptr;
-        retVal->memSize = 0;
-        retVal->memType = MM_TYPE_CAVE;
-        currChar_ptr = elfBinary->fileMem_ptr;
-        tempAddr_ptr = elfBinary->fileMem_ptr;
-
-        // puts("MADE IT HERE!");  // DEBUGGING
-        // 2. Start counting
-        while (currChar_ptr < (elfBinary->fileMem_ptr + elfBinary->memSize))
-        {
-            // puts("ITERATING!");  // DEBUGGING
-            // putchar(*currChar_ptr);  // DEBUGGING
-            // Found empty char
-            if (0x0 == *currChar_ptr)
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Elf_Manipulation, find_code_cave, create_mapMem_ptr failed);
+        }
+        else
+        {
+            retVal->fileMem_ptr = NULL;  // Never found one
+            retVal->memSize = 0;
+            retVal->memType = MM_TYPE_CAVE;
+
+            // 2. Find the largest run
+            if (false == find_code_caves(elfBinary, 1, 1, &cave_arr, &numCaves))
             {
-                // puts("MADE IT HERE!");  // DEBUGGING
-                byteCounter++;
+                HARKLE_ERROR(Elf_Manipulation, find_code_cave, find_code_caves failed);
+                free_struct(&retVal);
             }
-            // End of empty chars
-            else
+            else if (numCaves > 0)
+            {
+                retVal->fileMem_ptr = cave_arr->cave_ptr;
+                retVal->memSize = cave_arr->caveSize;
+            }
+        }
+    }
+
+    // CLEAN UP
+    free(cave_arr);
+
+    // DONE
+    return retVal;
+}
+
+
+bool find_code_caves(mapMem_ptr elfBinary, size_t topK, size_t minSize, elfCave_ptr* cave_arr, size_t* numCaves)
+{
+    // LOCAL VARIABLES
+    bool success = true;
+    elfCaveList caveList = { NULL, 0, 0, topK };  // Runs found
+    mapElf64_ptr elf64File = NULL;  // ELF header details, if elfBinary is a 64-bit ELF
+    const unsigned char* buf_ptr = NULL;  // elfBinary's memory
+    size_t bufLen = 0;  // Length of buf_ptr
+    size_t caveStart = 0;  // Index of the first 0x00 in a run
+    size_t caveStop = 0;  // Index of the first non-0x00 after a run
+    elfCave_ptr currCave_ptr = NULL;  // Run being annotated
+    size_t i = 0;  // Iterating variable
+
+    // INPUT VALIDATION
+    if (!cave_arr || !numCaves)
+    {
+        HARKLE_ERROR(Elf_Manipulation, find_code_caves, NULL pointer);
+        success = false;
+    }
+    else if (false == validate_struct(elfBinary))
+    {
+        HARKLE_ERROR(Elf_Manipulation, find_code_caves, Invalid mapMem struct);
+        success = false;
+    }
+    else
+    {
+        *cave_arr = NULL;
+        *numCaves = 0;
+        buf_ptr = (const unsigned char*)elfBinary->fileMem_ptr;
+        bufLen = elfBinary->memSize;
+
+        if (0 == minSize)
+        {
+            minSize = 1;
+        }
+    }
+
+    // FIND THE RUNS
+    if (true == success)
+    {
+        while (true == success && caveStop < bufLen)
+        {
+            caveStart = elfZeroEdgeEngine(buf_ptr, bufLen, caveStop, true);
+
+            if (caveStart >= bufLen)
             {
-                // Larger than value stored in retVal
-                if (byteCounter > retVal->memSize)
+                break;  // No more 0x00 bytes
+            }
+
+            caveStop = elfZeroEdgeEngine(buf_ptr, bufLen, caveStart, false);
+
+            if (caveStop - caveStart >= minSize)
+            {
+                success = keep_code_cave(&caveList, caveStart, caveStop - caveStart);
+            }
+        }
+    }
+
+    // SORT AND ANNOTATE THEM
+    if (true == success && caveList.numCaves > 0)
+    {
+        qsort(caveList.cave_arr, caveList.numCaves, sizeof(elfCave), compare_code_caves);
+        elf64File = map_elf64_headers(elfBinary);
+
+        for (i = 0; i < caveList.numCaves; i++)
+        {
+            currCave_ptr = caveList.cave_arr + i;
+            currCave_ptr->cave_ptr = elfBinary->fileMem_ptr + currCave_ptr->caveOffset;
+            currCave_ptr->prgmHdrNum = -1;
+            currCave_ptr->sectHdrNum = -1;
+
+            if (elf64File)
+            {
+                currCave_ptr->prgmHdr_ptr = find_this_prgm_hdr_64addr(elf64File, currCave_ptr->caveOffset);
+                currCave_ptr->sectHdr_ptr = find_this_sect_hdr_64addr(elf64File, currCave_ptr->caveOffset);
+
+                if (currCave_ptr->prgmHdr_ptr)
                 {
-                    // puts("FOUND ONE!");  // DEBUGGING
-                    // Set struct to beginning of this section
-                    retVal->fileMem_ptr = tempAddr_ptr;
-                    // Set the size
-                    retVal->memSize = byteCounter;
-                    // fprintf(stdout, "Current winner pointer:\t%p\n", retVal->fileMem_ptr);  // DEBUGGING
-                    // fprintf(stdout, "Current winner length:\t%zu\n", retVal->memSize);  // DEBUGGING
+                    currCave_ptr->prgmHdrNum = currCave_ptr->prgmHdr_ptr - elf64File->binaryPhdr_ptr;
                 }
+                if (currCave_ptr->sectHdr_ptr)
+                {
+                    currCave_ptr->sectHdrNum = currCave_ptr->sectHdr_ptr - elf64File->binaryShdr_ptr;
+                }
+            }
+        }
+
+        *cave_arr = caveList.cave_arr;
+        *numCaves = caveList.numCaves;
+    }
+
+    // CLEAN UP
+    // elf64File doesn't own binary_ptr
+    free(elf64File);
+
+    if (caveList.cave_arr && (false == success || 0 == caveList.numCaves))
+    {
+        free(caveList.cave_arr);
+        caveList.cave_arr = NULL;
+    }
+
+    // DONE
+    return success;
+}
+
+
+elfAudit_ptr audit_code_caves(const char** filename_arr, size_t numFiles, size_t topK, size_t minSize, int numThreads)
+{
+    // LOCAL VARIABLES
+    elfAudit_ptr retVal = NULL;
+    bool success = true;
+    elfAuditJob job = { NULL, numFiles, topK, minSize, 0 };  // Shared by every worker
+    pthread_t* thread_arr = NULL;  // Worker thread IDs
+    int numStarted = 0;  // Number of workers actually running
+    size_t i = 0;  // Iterating variable
+
+    // INPUT VALIDATION
+    if (!filename_arr || 0 == numFiles)
+    {
+        HARKLE_ERROR(Elf_Manipulation, audit_code_caves, Invalid filename array);
+        success = false;
+    }
+    else if (numThreads < 0)
+    {
+        HARKLE_ERROR(Elf_Manipulation, audit_code_caves, Invalid number of threads);
+        success = false;
+    }
+    else if (0 == numThreads)
+    {
+        numThreads = sysconf(_SC_NPROCESSORS_ONLN);
+
+        if (numThreads < 1)
+        {
+            numThreads = 1;
+        }
+    }
+
+    // ALLOCATE
+    if (true == success)
+    {
+        if ((size_t)numThreads > numFiles)
+        {
+            numThreads = numFiles;
+        }
+
+        retVal = (elfAudit_ptr)calloc(numFiles, sizeof(elfAudit));
+        thread_arr = (pthread_t*)calloc(numThreads, sizeof(pthread_t));
+
+        if (!retVal || !thread_arr)
+        {
+            HARKLE_ERROR(Elf_Manipulation, audit_code_caves, calloc failed);
+            success = false;
+        }
+        else
+        {
+            for (i = 0; i < numFiles; i++)
+            {
+                retVal[i].filename = filename_arr[i];
+            }
+            job.audit_arr = retVal;
+        }
+    }
 
-                // Reset...
-                // ...byteCounter
-                byteCounter = 0;
-                // ...tempAddr_ptr
-                tempAddr_ptr = currChar_ptr + 1;
+    // AUDIT
+    if (true == success)
+    {
+        for (numStarted = 0; numStarted < numThreads; numStarted++)
+        {
+            if (pthread_create(thread_arr + numStarted, NULL, audit_code_caves_worker, &job))
+            {
+                HARKLE_ERROR(Elf_Manipulation, audit_code_caves, pthread_create failed);
+                break;
             }
+        }
 
-            // Increment to next byte
-            currChar_ptr++;
+        // No workers?  Do it ourselves.
+        if (0 == numStarted)
+        {
+            audit_code_caves_worker(&job);
         }
-        // Trailing "code cave"
-        // Larger than value stored in retVal
-        if (byteCounter > retVal->memSize)
+
+        while (numStarted > 0)
         {
-            // puts("FOUND ONE!");  // DEBUGGING
-            // Set struct to beginning of this section
-            retVal->fileMem_ptr = tempAddr_ptr;
-            // Set the size
-            retVal->memSize = byteCounter;
-            // fprintf(stdout, "Current winner pointer:\t%p\n", retVal->fileMem_ptr);  // DEBUGGING
-            // fprintf(stdout, "Current winner length:\t%zu\n", retVal->memSize);  // DEBUGGING
+            numStarted--;
+            pthread_join(thread_arr[numStarted], NULL);
         }
     }
 
-    // Never found one
-    if (0 == retVal->memSize && retVal->fileMem_ptr == elfBinary->fileMem_ptr)
+    // CLEAN UP
+    free(thread_arr);
+
+    if (false == success && retVal)
     {
-        retVal->fileMem_ptr = NULL;
+        free_code_cave_audit(&retVal, numFiles);
     }
 
     // DONE
@@ -401,6 +670,30 @@ mapMem_ptr find_code_cave(mapMem_ptr elfBinary)
 }
 
 
+void free_code_cave_audit(elfAudit_ptr* oldAudit_ptr, size_t numFiles)
+{
+    // LOCAL VARIABLES
+    size_t i = 0;  // Iterating variable
+
+    // INPUT VALIDATION
+    if (oldAudit_ptr && *oldAudit_ptr)
+    {
+        for (i = 0; i < numFiles; i++)
+        {
+            free((*oldAudit_ptr)[i].cave_arr);
+            (*oldAudit_ptr)[i].cave_arr = NULL;
+            (*oldAudit_ptr)[i].numCaves = 0;
+        }
+
+        free(*oldAudit_ptr);
+        *oldAudit_ptr = NULL;
+    }
+
+    // DONE
+    return;
+}
+
+
 bool search_sect_hdr64_und_func(mapMem_ptr elf64File, const char *undFuncName)
 {
     // LOCAL VARIABLES
@@ -745,6 +1038,295 @@ Elf64_Shdr* find_sect_hdr64_strtab(mapElf64_ptr elf64File)
 }
 
 
+size_t find_zero_edge_swar(const unsigned char* buf_ptr, size_t bufLen, size_t index, bool wantZero)
+{
+    // LOCAL VARIABLES
+    uint64_t word = 0;  // 8 bytes of buf_ptr
+    uint64_t highBits = 0;  // 0x80 in every byte of word that isn't 0x00
+    const uint64_t lowMask = 0x7F7F7F7F7F7F7F7FULL;  // Every bit but the high bit of each byte
+
+    // SKIP 8 BYTES AT A TIME
+    while (index + sizeof(word) <= bufLen)
+    {
+        memcpy(&word, buf_ptr + index, sizeof(word));
+        highBits = (((word & lowMask) + lowMask) | word) & ~lowMask;
+
+        // Stop at the word holding the edge
+        if ((true == wantZero && highBits != ~lowMask) || (false == wantZero && highBits))
+        {
+            break;
+        }
+        index += sizeof(word);
+    }
+
+    // FIND THE EXACT BYTE
+    while (index < bufLen && (0x0 == buf_ptr[index]) != wantZero)
+    {
+        index++;
+    }
+
+    // DONE
+    return index;
+}
+
+
+#ifdef ELF_CAVE_X86
+size_t find_zero_edge_sse2(const unsigned char* buf_ptr, size_t bufLen, size_t index, bool wantZero)
+{
+    // LOCAL VARIABLES
+    size_t retVal = bufLen;
+    uint64_t mask = 0;  // One bit per byte in the current block, set for each 0x00
+    uint64_t flipIt = true == wantZero ? 0 : ~0ULL;  // Flips mask to hunt for non-0x00 bytes
+    __m128i zeroVec = _mm_setzero_si128();
+
+    // 64 BYTES AT A TIME
+    for (; index + 64 <= bufLen; index += 64)
+    {
+        mask = (uint64_t)(unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(zeroVec, _mm_loadu_si128((const __m128i*)(buf_ptr + index))))
+               | ((uint64_t)(unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(zeroVec, _mm_loadu_si128((const __m128i*)(buf_ptr + index + 16)))) << 16)
+               | ((uint64_t)(unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(zeroVec, _mm_loadu_si128((const __m128i*)(buf_ptr + index + 32)))) << 32)
+               | ((uint64_t)(unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(zeroVec, _mm_loadu_si128((const __m128i*)(buf_ptr + index + 48)))) << 48);
+        mask ^= flipIt;
+
+        if (mask)
+        {
+            retVal = index + __builtin_ctzll(mask);
+            break;
+        }
+    }
+
+    // TAIL
+    if (bufLen == retVal)
+    {
+        retVal = find_zero_edge_swar(buf_ptr, bufLen, index, wantZero);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+size_t find_zero_edge_avx2(const unsigned char* buf_ptr, size_t bufLen, size_t index, bool wantZero)
+{
+    // LOCAL VARIABLES
+    size_t retVal = bufLen;
+    uint64_t mask = 0;  // One bit per byte in the current block, set for each 0x00
+    uint64_t flipIt = true == wantZero ? 0 : ~0ULL;  // Flips mask to hunt for non-0x00 bytes
+    __m256i zeroVec = _mm256_setzero_si256();
+
+    // 64 BYTES AT A TIME
+    for (; index + 64 <= bufLen; index += 64)
+    {
+        mask = (uint64_t)(unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(zeroVec, _mm256_loadu_si256((const __m256i*)(buf_ptr + index))))
+               | ((uint64_t)(unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(zeroVec, _mm256_loadu_si256((const __m256i*)(buf_ptr + index + 32)))) << 32);
+        mask ^= flipIt;
+
+        if (mask)
+        {
+            retVal = index + __builtin_ctzll(mask);
+            break;
+        }
+    }
+
+    // TAIL
+    if (bufLen == retVal)
+    {
+        retVal = find_zero_edge_swar(buf_ptr, bufLen, index, wantZero);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+void pick_zero_edge_engine(void)
+{
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+    {
+        elfZeroEdgeEngine = find_zero_edge_avx2;
+    }
+    else if (__builtin_cpu_supports("sse2"))
+    {
+        elfZeroEdgeEngine = find_zero_edge_sse2;
+    }
+}
+#endif  // ELF_CAVE_X86
+
+
+bool keep_code_cave(elfCaveList_ptr caveList, Elf64_Off caveOffset, size_t caveSize)
+{
+    // LOCAL VARIABLES
+    bool success = true;
+    elfCave_ptr heap_arr = NULL;  // caveList->cave_arr, as a min-heap
+    elfCave newCave = { NULL, caveOffset, caveSize, NULL, NULL, -1, -1 };  // Run to add
+    elfCave tmpCave;  // Swap space
+    size_t newLen = 0;  // Capacity of a grown cave_arr
+    size_t child = 0;  // Index of a heap node's smaller child
+    size_t i = 0;  // Heap index
+
+    // FULL HEAP: REPLACE THE SMALLEST RUN
+    // Runs arrive in offset order, so an equal run is always the later one and loses
+    if (caveList->topK && caveList->numCaves == caveList->topK)
+    {
+        heap_arr = caveList->cave_arr;
+
+        if (caveSize > heap_arr[0].caveSize)
+        {
+            heap_arr[0] = newCave;
+
+            // Sift down
+            while ((child = (2 * i) + 1) < caveList->numCaves)
+            {
+                if (child + 1 < caveList->numCaves && compare_code_caves(heap_arr + child + 1, heap_arr + child) > 0)
+                {
+                    child++;
+                }
+                if (compare_code_caves(heap_arr + child, heap_arr + i) <= 0)
+                {
+                    break;
+                }
+                tmpCave = heap_arr[i];
+                heap_arr[i] = heap_arr[child];
+                heap_arr[child] = tmpCave;
+                i = child;
+            }
+        }
+    }
+    else
+    {
+        // GROW
+        if (caveList->numCaves == caveList->arrLen)
+        {
+            newLen = caveList->arrLen ? caveList->arrLen * 2 : ELF_CAVE_LIST_LEN;
+
+            if (caveList->topK && newLen > caveList->topK)
+            {
+                newLen = caveList->topK;
+            }
+            heap_arr = (elfCave_ptr)realloc(caveList->cave_arr, newLen * sizeof(elfCave));
+
+            if (!heap_arr)
+            {
+                HARKLE_ERROR(Elf_Manipulation, keep_code_cave, realloc failed);
+                success = false;
+            }
+            else
+            {
+                caveList->cave_arr = heap_arr;
+                caveList->arrLen = newLen;
+            }
+        }
+
+        // APPEND
+        if (true == success)
+        {
+            heap_arr = caveList->cave_arr;
+            i = caveList->numCaves++;
+            heap_arr[i] = newCave;
+
+            // Sift up (compare_code_caves() sorts the worse run later)
+            while (caveList->topK && i > 0 && compare_code_caves(heap_arr + i, heap_arr + ((i - 1) / 2)) > 0)
+            {
+                tmpCave = heap_arr[i];
+                heap_arr[i] = heap_arr[(i - 1) / 2];
+                heap_arr[(i - 1) / 2] = tmpCave;
+                i = (i - 1) / 2;
+            }
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+int compare_code_caves(const void* cave1_ptr, const void* cave2_ptr)
+{
+    // LOCAL VARIABLES
+    const elfCave* cave1 = (const elfCave*)cave1_ptr;
+    const elfCave* cave2 = (const elfCave*)cave2_ptr;
+    int retVal = 0;
+
+    // Largest first
+    if (cave1->caveSize != cave2->caveSize)
+    {
+        retVal = cave1->caveSize > cave2->caveSize ? -1 : 1;
+    }
+    // Then by offset
+    else if (cave1->caveOffset != cave2->caveOffset)
+    {
+        retVal = cave1->caveOffset < cave2->caveOffset ? -1 : 1;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+mapElf64_ptr map_elf64_headers(mapMem_ptr binary_ptr)
+{
+    // LOCAL VARIABLES
+    mapElf64_ptr retVal = NULL;
+    Elf64_Ehdr* elfHdr_ptr = (Elf64_Ehdr*)binary_ptr->fileMem_ptr;  // ELF header, if it is one
+
+    // VALIDATE THE HEADERS
+    if (binary_ptr->memSize >= sizeof(Elf64_Ehdr) \
+        && 0 == memcmp(elfHdr_ptr->e_ident, ELFMAG, SELFMAG) \
+        && ELFCLASS64 == elfHdr_ptr->e_ident[EI_CLASS] \
+        && elfHdr_ptr->e_phoff <= binary_ptr->memSize \
+        && elfHdr_ptr->e_phnum <= (binary_ptr->memSize - elfHdr_ptr->e_phoff) / sizeof(Elf64_Phdr) \
+        && elfHdr_ptr->e_shoff <= binary_ptr->memSize \
+        && elfHdr_ptr->e_shnum <= (binary_ptr->memSize - elfHdr_ptr->e_shoff) / sizeof(Elf64_Shdr))
+    {
+        retVal = populate_mapElf64_struct(binary_ptr);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+void* audit_code_caves_worker(void* job_ptr)
+{
+    // LOCAL VARIABLES
+    elfAuditJob_ptr job = (elfAuditJob_ptr)job_ptr;  // Shared job details
+    elfAudit_ptr currAudit_ptr = NULL;  // File this worker claimed
+    mapMem_ptr currFile_ptr = NULL;  // currAudit_ptr's file, mapped read-only
+    size_t fileNum = 0;  // Index of the claimed file
+    size_t i = 0;  // Iterating variable
+
+    while ((fileNum = __atomic_fetch_add(&(job->nextFile), 1, __ATOMIC_RELAXED)) < job->numFiles)
+    {
+        currAudit_ptr = job->audit_arr + fileNum;
+        currFile_ptr = map_file_mode(currAudit_ptr->filename, O_RDONLY);
+
+        if (!currFile_ptr)
+        {
+            HARKLE_ERROR(Elf_Manipulation, audit_code_caves_worker, map_file_mode failed);
+            continue;
+        }
+
+        currAudit_ptr->success = find_code_caves(currFile_ptr, job->topK, job->minSize, \
+                                                 &(currAudit_ptr->cave_arr), &(currAudit_ptr->numCaves));
+
+        // The mapping is about to go away
+        for (i = 0; i < currAudit_ptr->numCaves; i++)
+        {
+            currAudit_ptr->cave_arr[i].cave_ptr = NULL;
+            currAudit_ptr->cave_arr[i].prgmHdr_ptr = NULL;
+            currAudit_ptr->cave_arr[i].sectHdr_ptr = NULL;
+        }
+
+        free_struct(&currFile_ptr);
+    }
+
+    // DONE
+    return NULL;
+}
+
+
 /*
 typedef uint64_t    Elf64_Addr;
 typedef uint16_t    Elf64_Half;
@@ -24,6 +24,27 @@ typedef struct Mapped_Memory_Elf64
 } mapElf64, *mapElf64_ptr;
 
 
+typedef struct Elf_Code_Cave
+{
+	char* cave_ptr;				// Start of the run of 0x00 bytes (only valid while the file is mapped)
+	Elf64_Off caveOffset;		// Offset of the run into the file
+	size_t caveSize;			// Length of the run
+	Elf64_Phdr* prgmHdr_ptr;	// Program header containing the run, NULL if none (only valid while mapped)
+	Elf64_Shdr* sectHdr_ptr;	// Section header containing the run, NULL if none (only valid while mapped)
+	int prgmHdrNum;				// Index of prgmHdr_ptr in the program header table, -1 if none
+	int sectHdrNum;				// Index of sectHdr_ptr in the section header table, -1 if none
+} elfCave, *elfCave_ptr;
+
+
+typedef struct Elf_Code_Cave_Audit
+{
+	const char* filename;		// File that was audited
+	elfCave_ptr cave_arr;		// Its code caves, largest first (see: find_code_caves())
+	size_t numCaves;			// Number of entries in cave_arr
+	bool success;				// false if filename could not be mapped or scanned
+} elfAudit, *elfAudit_ptr;
+
+
 /*
 	Purpose - Check an mmap()'d file for the ELF Magic Number
 	Input - file - struct* mappedMemory
@@ -77,6 +98,8 @@ Elf64_Addr get_elf64_base_address(mapElf64_ptr elf64File);
 	Notes
 		A valid use case of this function is that addr may not be contained within the program headers
 			so NULL does not mean "error"
+		addr is a file offset.  Only entries whose [p_offset, p_offset + p_filesz) holds it
+			match, and the one with the greatest p_offset wins.
  */
 Elf64_Phdr* find_this_prgm_hdr_64addr(mapElf64_ptr elf64File, Elf64_Addr addr);
 
@@ -92,6 +115,8 @@ Elf64_Phdr* find_this_prgm_hdr_64addr(mapElf64_ptr elf64File, Elf64_Addr addr);
 	Notes
 		A valid use case of this function is that addr may not be contained within the section headers
 			so NULL does not mean "error"
+		addr is a file offset.  Only entries whose [sh_offset, sh_offset + sh_size) holds it
+			match, SHT_NOBITS entries never do, and the one with the greatest sh_offset wins.
  */
 Elf64_Shdr* find_this_sect_hdr_64addr(mapElf64_ptr elf64File, Elf64_Addr addr);
 
@@ -101,10 +126,66 @@ Elf64_Shdr* find_this_sect_hdr_64addr(mapElf64_ptr elf64File, Elf64_Addr addr);
 	Input - elfBinary - struct* mappedMemory
 	Output - struct* mappedMemory which holds the address and size of the 
 		largest section of 'nothing'
+	Notes
+		Ties go to the earliest run
+		This is find_code_caves(elfBinary, 1, 1, ...) wrapped in a mappedMemory struct
  */
 mapMem_ptr find_code_cave(mapMem_ptr elfBinary);
 
 
+/*
+	Purpose - Search a binary for every run of 0x00 bytes, or the largest ones
+	Input
+		elfBinary - struct* mappedMemory
+		topK - Keep only the topK largest runs, 0 to keep every run
+		minSize - Ignore runs shorter than this (0 is treated as 1)
+		cave_arr - [OUT] Heap-allocated array of runs, largest first and then by
+			offset, or NULL if none were found
+		numCaves - [OUT] Number of entries in *cave_arr
+	Output - true on success, otherwise false
+	Notes
+		The caller is responsible for free()ing *cave_arr
+		Scans 64 bytes per step with SSE2/AVX2 (when the CPU supports it) and
+			only stops at the edges of the runs
+		If elfBinary holds a 64-bit ELF whose header tables fit inside the file,
+			each run is annotated with find_this_prgm_hdr_64addr() and
+			find_this_sect_hdr_64addr()
+ */
+bool find_code_caves(mapMem_ptr elfBinary, size_t topK, size_t minSize, elfCave_ptr* cave_arr, size_t* numCaves);
+
+
+/*
+	Purpose - Run find_code_caves() on many files in parallel
+	Input
+		filename_arr - Array of numFiles filenames
+		numFiles - Number of entries in filename_arr
+		topK - Passed to find_code_caves()
+		minSize - Passed to find_code_caves()
+		numThreads - Number of worker threads, 0 to use one per online CPU
+	Output - Heap-allocated array of numFiles audits, in filename_arr order, on
+		success, otherwise NULL
+	Notes
+		Each file is mapped read-only, scanned, and unmapped by whichever
+			worker claims it next, so the pointer members of each elfCave are
+			NULL; use caveOffset, prgmHdrNum, and sectHdrNum instead
+		A file that fails to map or scan has its audit's success set to false
+		The caller is responsible for calling free_code_cave_audit()
+ */
+elfAudit_ptr audit_code_caves(const char** filename_arr, size_t numFiles, size_t topK, size_t minSize, int numThreads);
+
+
+/*
+	Purpose - Free an array of audits from audit_code_caves()
+	Input
+		oldAudit_ptr - Pointer to the audit array
+		numFiles - Number of entries in the audit array
+	Output - None
+	Notes
+		Sets *oldAudit_ptr to NULL
+ */
+void free_code_cave_audit(elfAudit_ptr* oldAudit_ptr, size_t numFiles);
+
+
 /*
  *	PURPOSE - Search a 64-bit ELF binary's section headers looking for an
  *		undefined global (see: binding) function named "undFuncName"
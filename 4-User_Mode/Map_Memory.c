@@ -188,7 +188,7 @@ mapMem_ptr map_file_mode(const char* filename, int flags)
 		{
 			// 2. Get file descriptor for filename
 			// Determine read-only permissions
-			if (O_RDONLY == (flags & O_RDONLY) || O_RDONLY == flags)
+			if (O_RDONLY == (flags & O_ACCMODE))
 			{
 				retVal->readOnly = true;
 			}
@@ -198,7 +198,8 @@ mapMem_ptr map_file_mode(const char* filename, int flags)
 			}
 
 			// fileDesc = open(filename, flags);
-			fileDesc = open(filename, O_RDWR);
+			// Read-only files (e.g., running executables) can't be opened O_RDWR
+			fileDesc = open(filename, true == retVal->readOnly ? O_RDONLY : O_RDWR);
 			if (0 > fileDesc)
 			{
 				HARKLE_ERROR(Map_Memory, map_file_mode, Unable to open filename);
@@ -245,7 +246,7 @@ mapMem_ptr map_file_mode(const char* filename, int flags)
 							{
 								retVal->fileMem_ptr = mmap(NULL, \
 														   retVal->memSize, \
-														   PROT_READ | PROT_WRITE | PROT_EXEC, \
+														   PROT_READ, \
 														   MAP_SHARED, \
 														   fileDesc, \
 														   0);